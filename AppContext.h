@@ -18,10 +18,21 @@
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #pragma once
+#include <Arduino.h>
 
 class ThreadBase;
 
+typedef struct _ThreadConfig
+{
+    BaseType_t core;      // core affinity of the task
+    UBaseType_t priority; // priority of the task, 0 being the lowest
+} ThreadConfig;
+
 typedef struct _AppContext
 {
-    ThreadBase *threadApp;
+    ThreadBase *threadApp;   // low priority: init, connection bookkeeping, logging
+    ThreadBase *threadAudio; // high priority: sound update, volume
+
+    ThreadConfig threadAppConfig;
+    ThreadConfig threadAudioConfig;
 } AppContext;
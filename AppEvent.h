@@ -26,7 +26,15 @@ enum AppEvent : int16_t
     //
     /////////////////////////////////////////////////////////////////////////////
     EventNull = 0,
+    EventProfile,    // periodic task profiling
+    EventTraceDrain, // periodic TraceLog::drain()
+    EventStatus,     // periodic update of the I2cStatus counters
+    EventCueDecode,  // Mp3Cache::decodePending()
 
     /////////////////////////////////////////////////////////////////////////////
-    EventI2c = 100, // iParam=command, uParam=param
+    EventI2c = 100, // I2C commands, queued as I2cA2dp::CommandMessage; event of their CommandRecorder records
+
+    /////////////////////////////////////////////////////////////////////////////
+    EventA2dpConnectionState = 200, // iParam=esp_a2d_connection_state_t
+    EventA2dpAudioState,            // iParam=esp_a2d_audio_state_t
 };
@@ -19,21 +19,45 @@
  */
 #include "./src/ArduProf.h"
 #include "./src/thread/ThreadApp.h"
+#include "./src/thread/ThreadAudio.h"
 #include "./src/peripheral/i2c/I2cCommand.h"
+#include "./src/debug/TaskProfiler.h"
+#include "./src/debug/TraceLog.h"
+#include "./src/debug/CueLatency.h"
+#include "./src/debug/CommandRecorder.h"
+#include "./src/debug/SerialLock.h"
 #include "./AppContext.h"
 
+///////////////////////////////////////////////////////////////////////////////
+// #define RUNNING_CORE 0 // dedicate core 0 for Thread
+// #define RUNNING_CORE 1 // dedicate core 1 for Thread
+#define RUNNING_CORE ARDUINO_RUNNING_CORE
+
+#define THREAD_APP_PRIORITY 1   // init, connection bookkeeping, logging
+#define THREAD_AUDIO_PRIORITY 3 // sound update, volume
+
 ///////////////////////////////////////////////////////////////////////////////
 static AppContext appContext = {0};
 
 ///////////////////////////////////////////////////////////////////////////////
 static void initGlobalVar(void)
 {
+    appContext.threadAppConfig.core = RUNNING_CORE;
+    appContext.threadAppConfig.priority = THREAD_APP_PRIORITY;
+
+    appContext.threadAudioConfig.core = RUNNING_CORE;
+    appContext.threadAudioConfig.priority = THREAD_AUDIO_PRIORITY;
 }
 
 static void createTasks(void)
 {
+    static ThreadAudio threadAudio;
+    appContext.threadAudio = &threadAudio;
+
     static ThreadApp threadApp;
     appContext.threadApp = &threadApp;
+
+    threadAudio.start(&appContext);
     threadApp.start(&appContext);
 }
 
@@ -61,6 +85,7 @@ void setup()
     // LOG_SET_LEVEL(DebugLogLevel::LVL_NONE);
     LOG_SET_DELIMITER("");
     LOG_ATTACH_SERIAL(Serial);
+    SerialLock::init();
     /////////////////////////////////////////////////////////////////////////////
 
     printAppInfo();
@@ -95,11 +120,47 @@ static void testSound(void)
     }
     count %= 16;
 
-    appContext.threadApp->postEvent(EventI2c, I2cCommand::PlaySound, volume, sound.byte.data);
+    I2cA2dp::Frame frame = {3, {volume, sound.byte.data, 0}}; // volume, sound, CueLatency sequence
+    ThreadAudio::instance()->commandQueue()->post(I2cA2dp::CommandMessage(I2cCommand::PlaySound, frame));
 }
 
 void loop()
 {
     // testSound();
+
+    // send 'p' on the serial port to get a binary TaskProfiler snapshot,
+    // 't' to get a binary TraceLog dump (decode with tools/trace_decode.py),
+    // 'l' to get the binary PlaySound latency histogram,
+    // 'r' to get the recorded commands (decode with tools/command_decode.py)
+    while (Serial.available())
+    {
+        int c = Serial.read();
+        if (c != 'p' && c != 't' && c != 'l' && c != 'r')
+        {
+            continue;
+        }
+
+        // no text from the other tasks in the middle of the binary dump
+        SerialLock::beginDump();
+        switch (c)
+        {
+        case 'p':
+            TaskProfiler::write(Serial);
+            break;
+        case 't':
+            TraceLog::write(Serial);
+            break;
+        case 'l':
+            CueLatency::write(Serial);
+            break;
+        case 'r':
+            CommandRecorder::write(Serial);
+            break;
+        default:
+            break;
+        }
+        Serial.flush();
+        SerialLock::endDump();
+    }
     delay(1000);
 }
\ No newline at end of file
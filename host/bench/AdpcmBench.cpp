@@ -0,0 +1,153 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// IMA-ADPCM cues (AdpcmSoundData): decode time per frame, and quality against
+// the 8-bit output of OneChannel8BitSoundData for the built-in cues, encoded
+// here as tools/asset_compiler.py --format adpcm does. Also checks that a read
+// starting in the middle of a block (a seek) gives the sequential output.
+#include "HostBench.h"
+#include "data/AdpcmSoundData.h"
+#include "data/CueStore.h"
+#include <math.h>
+#include <vector>
+
+// one sample of AdpcmSoundData::decodeBlock(), as adpcm_step() of the compiler
+static void adpcmStep(int32_t &predictor, int32_t &index, uint8_t nibble)
+{
+    static const int16_t steps[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+    static const int8_t indexSteps[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+    int32_t step = steps[index];
+    int32_t diff = (step >> 3) + ((nibble & 4) ? step : 0) + ((nibble & 2) ? step >> 1 : 0) + ((nibble & 1) ? step >> 2 : 0);
+    predictor = std::min<int32_t>(INT16_MAX, std::max<int32_t>(INT16_MIN, predictor + ((nibble & 8) ? -diff : diff)));
+    index = std::min<int32_t>(88, std::max<int32_t>(0, index + indexSteps[nibble & 7]));
+}
+
+// adpcm_encode() of tools/asset_compiler.py: the closest nibble for each sample
+static std::vector<uint8_t> adpcmEncode(const int8_t *samples, int32_t count)
+{
+    std::vector<uint8_t> blocks;
+    int32_t predictor = 0;
+    int32_t index = 0;
+    for (int32_t start = 0; start < count; start += AdpcmSoundData::BLOCK_SAMPLES)
+    {
+        const AdpcmSoundData::AdpcmBlockHeader header = {.predictor = (int16_t)predictor, .index = (uint8_t)index, .reserved = 0};
+        blocks.insert(blocks.end(), (const uint8_t *)&header, (const uint8_t *)&header + sizeof(header));
+        uint8_t byte = 0;
+        for (int32_t i = 0; i < AdpcmSoundData::BLOCK_SAMPLES; i++)
+        {
+            int32_t target = (start + i < count) ? samples[start + i] * 256 : 0;
+            uint8_t best = 0;
+            int32_t bestError = INT32_MAX;
+            for (uint8_t nibble = 0; nibble < 16; nibble++)
+            {
+                int32_t p = predictor;
+                int32_t x = index;
+                adpcmStep(p, x, nibble);
+                if (abs(p - target) < bestError)
+                {
+                    best = nibble;
+                    bestError = abs(p - target);
+                }
+            }
+            adpcmStep(predictor, index, best);
+            if (i & 1)
+            {
+                blocks.push_back(byte | (best << 4));
+            }
+            else
+            {
+                byte = best;
+            }
+        }
+    }
+    return blocks;
+}
+
+HOST_BENCH(adpcm_decode_and_quality)
+{
+    CHECK(CueStore::begin());
+    const uint8_t cues[] = {I2cParam::CueEdgePool, I2cParam::CueLaneLeft, I2cParam::CueLaneMiddle, I2cParam::CueLaneRight, I2cParam::CueError};
+    const int REPEAT = 20;
+    double minSnr = 1000;
+
+    printf("cue  samples  8-bit bytes  adpcm bytes  decode (ns/frame)  SNR vs 8-bit (dB)\n");
+    for (uint8_t cue : cues)
+    {
+        const CueBundleEntry *entry = CueStore::find(cue);
+        CHECK(entry && entry->format == CueFormatS8);
+        if (!entry || entry->format != CueFormatS8)
+        {
+            continue;
+        }
+        int8_t *pcm = (int8_t *)CueStore::samples(*entry);
+        int32_t count = entry->length;
+        std::vector<uint8_t> blocks = adpcmEncode(pcm, count);
+
+        OneChannel8BitSoundData reference(pcm, count);
+        AdpcmSoundData adpcm;
+        adpcm.setBlocks(blocks.data(), blocks.size());
+        CHECK(adpcm.sampleCount() >= count);
+
+        // sequential, as SoundBuffer reads it: one block decode per BLOCK_SAMPLES frames
+        std::vector<int16_t> decoded(count);
+        uint64_t start = HostBench::nowNs();
+        for (int r = 0; r < REPEAT; r++)
+        {
+            for (int32_t i = 0; i < count; i++)
+            {
+                Frame frame;
+                adpcm.getData(i, frame);
+                decoded[i] = frame.channel1;
+            }
+        }
+        uint64_t decodeNs = HostBench::nowNs() - start;
+
+        double signal = 0;
+        double noise = 0;
+        for (int32_t i = 0; i < count; i++)
+        {
+            Frame frame;
+            reference.getData(i, frame);
+            signal += (double)frame.channel1 * frame.channel1;
+            noise += (double)(frame.channel1 - decoded[i]) * (frame.channel1 - decoded[i]);
+        }
+        double snr = noise > 0 ? 10 * log10(signal / noise) : 99;
+        minSnr = std::min(minSnr, snr);
+
+        // seeks into the middle of blocks, backwards, give the same frames
+        for (int32_t i = count - 1; i >= 0; i -= 97)
+        {
+            Frame frame;
+            adpcm.getData(i, frame);
+            CHECK(frame.channel1 == decoded[i] && frame.channel2 == decoded[i]);
+        }
+
+        printf("%3u  %7d  %11d  %11u  %17.2f  %17.1f\n", cue, count, count, (uint32_t)blocks.size(), (double)decodeNs / REPEAT / count, snr);
+        // half a byte per sample plus a 4-byte header per block
+        CHECK(blocks.size() == (size_t)(count + AdpcmSoundData::BLOCK_SAMPLES - 1) / AdpcmSoundData::BLOCK_SAMPLES * AdpcmSoundData::BLOCK_SIZE);
+    }
+    // measured 19.5 to 30 dB on the built-in cues, the bound catches a broken coder
+    CHECK(minSnr > 15);
+}
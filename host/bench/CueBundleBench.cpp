@@ -0,0 +1,76 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Cue bundle read in place from the "cues" partition: the linked bundle is
+// written to a file which the host stubs map as the partition (mmap), then
+// every cue found by id must point into the mapping, with no copy, and hold
+// the same samples as the linked bundle.
+#include "HostBench.h"
+#include "HostStubs.h"
+#include "data/CueStore.h"
+#include "data/CueBundle.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+HOST_BENCH(cue_bundle_mapped_in_place)
+{
+    char path[] = "/tmp/cue_bundle_XXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0 && write(fd, cueBundleData, cueBundleSize) == (ssize_t)cueBundleSize);
+    close(fd);
+
+    // the linked bundle stays valid: a SoundBuffer made before keeps working
+    CueStore::end();
+    CHECK(hostMapPartition("cues", path));
+    uint64_t start = HostBench::nowNs();
+    CHECK(CueStore::begin());
+    uint64_t beginNs = HostBench::nowNs() - start;
+    unlink(path);
+    CHECK(CueStore::isMapped());
+
+    const CueBundleHeader *header = (const CueBundleHeader *)cueBundleData;
+    const CueBundleEntry *linked = (const CueBundleEntry *)(cueBundleData + sizeof(CueBundleHeader));
+    const uint8_t *bundle = CueStore::samples(*CueStore::find(linked[0].id)) - linked[0].offset;
+    CHECK(bundle != cueBundleData);
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        const CueBundleEntry *entry = CueStore::find(linked[i].id);
+        CHECK(entry && entry->id == linked[i].id && entry->length == linked[i].length);
+        if (entry)
+        {
+            const uint8_t *samples = CueStore::samples(*entry);
+            CHECK((const uint8_t *)entry > bundle && samples >= bundle && samples + entry->length <= bundle + cueBundleSize);
+            CHECK(memcmp(samples, cueBundleData + linked[i].offset, entry->length) == 0);
+        }
+    }
+    CHECK(CueStore::find(0xff) == nullptr);
+
+    const uint32_t LOOKUPS = 100000;
+    uint32_t found = 0;
+    start = HostBench::nowNs();
+    for (uint32_t n = 0; n < LOOKUPS; n++)
+    {
+        found += CueStore::find(linked[n % header->count].id) ? 1 : 0;
+    }
+    uint64_t findNs = HostBench::nowNs() - start;
+    CHECK(found == LOOKUPS);
+
+    printf("cue bundle: %u cues, %u bytes mapped, 0 bytes copied; begin() %.1f us, find() %.1f ns\n",
+           header->count, cueBundleSize, beginNs / 1000.0, (double)findNs / LOOKUPS);
+}
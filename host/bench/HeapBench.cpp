@@ -0,0 +1,125 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Zero heap after init: every malloc of the process, operator new included, is
+// counted while the firmware plays a steady command stream through the stub
+// Wire, ThreadAudio and the A2DP data callback. Unlike HeapMonitor on the
+// device, this also sees plain malloc (e.g. the heap fallback of
+// bt_app_work_dispatch or a decoder library).
+#include "HostBench.h"
+#include "I2cMaster.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <vector>
+
+// glibc entry points, malloc and friends of this executable take precedence
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *ptr, size_t size);
+
+static volatile bool isCounting = false;
+static volatile uint32_t mallocCount = 0;
+
+extern "C" void *malloc(size_t size)
+{
+    mallocCount += isCounting ? 1 : 0;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    mallocCount += isCounting ? 1 : 0;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size)
+{
+    mallocCount += isCounting ? 1 : 0;
+    return __libc_realloc(ptr, size);
+}
+
+HOST_BENCH(zero_steady_state_allocations)
+{
+    ThreadAudio &threadAudio = HostBench::audioThread();
+    I2cA2dp i2cA2dp(threadAudio.commandQueue(), EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+
+    const I2cParam::Timeline timeline = {
+        .sequence = 1,
+        .repeat = 0,
+        .slotCount = 3,
+        .slot = {{I2cParam::CueLaneLeft, 100}, {I2cParam::CueNone, 0}, {I2cParam::CueError, 60}},
+    };
+    I2cParam::Pattern pattern = {.id = 2, .stepCount = 4, .step = {}};
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        pattern.step[i] = {.cue = (uint8_t)(I2cParam::CueEdgePool + i), .gain = 80, .duration = 5, .repeat = 2};
+    }
+    const I2cParam::ToneParam tone = {
+        .frequency = 660, .waveform = I2cParam::WaveTriangle, .gain = 70, .attack = 2, .decay = 10, .sustain = 60, .release = 20, .fmFrequency = 0, .fmIndex = 0};
+    I2cFrame setTone{I2cCommand::SetTone, 1};
+    setTone.insert(setTone.end(), (const uint8_t *)&tone, (const uint8_t *)&tone + sizeof(tone));
+
+    // built before counting: the frames are the master's, not the firmware's
+    const I2cFrame script[] = {
+        I2cMaster::playSound(60, 0x23),
+        I2cMaster::playTimeline(timeline),
+        I2cMaster::definePattern(pattern),
+        I2cMaster::playPattern(pattern.id, 0),
+        I2cMaster::playAt(0, I2cParam::CueError, 90),
+        I2cFrame{I2cCommand::PlayUrgent, I2cParam::CueLaneRight, 100, 1},
+        setTone,
+        I2cFrame{I2cCommand::PlayUrgent, (uint8_t)(I2cParam::CueTone + 1), 100, 1},
+        I2cMaster::playSound(40, 0x11),
+    };
+    const uint32_t COMMAND_INTERVAL = 40; // packets, the urgent and PlayAt cues are over by the next one
+    const uint32_t PACKETS = COMMAND_INTERVAL * (sizeof(script) / sizeof(script[0]));
+    std::vector<uint8_t> packet(A2DP_PACKET_SIZE);
+
+    // the first pass initialises what is initialised on first use, the second one is counted
+    uint32_t warmUpCount = 0;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        mallocCount = 0;
+        isCounting = true;
+        uint64_t start = HostBench::nowNs();
+        for (uint32_t n = 0; n < PACKETS; n++)
+        {
+            if (n % COMMAND_INTERVAL == 0)
+            {
+                CHECK(I2cMaster::transfer(script[n / COMMAND_INTERVAL]) == I2cResponse::Success);
+            }
+            HostBench::pullPacket(packet.data());
+        }
+        uint64_t elapsedNs = HostBench::nowNs() - start;
+        isCounting = false;
+
+        if (pass == 0)
+        {
+            warmUpCount = mallocCount;
+        }
+        else
+        {
+            printf("allocations: %u on the first pass, %u in steady state (%u packets, %u commands, %.1f us per packet)\n",
+                   warmUpCount, mallocCount, PACKETS, (uint32_t)(sizeof(script) / sizeof(script[0])), elapsedNs / 1000.0 / PACKETS);
+            CHECK(mallocCount == 0);
+        }
+    }
+    Wire.end();
+}
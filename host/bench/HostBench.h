@@ -0,0 +1,78 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Host benchmarks: HOST_BENCH(name) defines one in host_bench, which shares the
+// runner of the host tests (../test/HostTest.h): "host_bench <name>" runs one,
+// "host_bench" all of them. A benchmark prints its figures and CHECK()s the
+// bounds it must keep; only the bounds which do not depend on the speed of the
+// host are checked, so that ctest can run them, see ../CMakeLists.txt.
+#include "HostTest.h"
+#include "HostA2dpSource.h"
+#include "thread/ThreadAudio.h"
+#include "../../AppContext.h"
+#include "../../AppEvent.h"
+#include <chrono>
+
+#define HOST_BENCH(name) HOST_TEST(name)
+
+class HostBench
+{
+public:
+    // frames the A2DP stack asks for per data callback
+    static const uint32_t PACKET_FRAMES = A2DP_PACKET_SIZE / sizeof(Frame);
+
+    // host time in ns
+    static uint64_t nowNs(void)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // The ThreadAudio of the firmware without a task, connected and played by
+    // hostA2dpSource(); pullPacket() runs it. There is one for the whole process:
+    // its queue and stack are static.
+    static ThreadAudio &audioThread(void)
+    {
+        static ThreadAudio threadAudio;
+        static AppContext context = {.threadApp = nullptr, .threadAudio = &threadAudio, .threadAppConfig = {}, .threadAudioConfig = {.core = 1, .priority = 3}};
+        static bool isStarted = false;
+        if (!isStarted)
+        {
+            threadAudio.start(&context);
+            BluetoothA2DPSource &source = hostA2dpSource();
+            threadAudio.setA2dpSource(&source);
+            source.write_data(threadAudio.soundBuffer());
+            threadAudio.postEvent(EventA2dpConnectionState, ESP_A2D_CONNECTION_STATE_CONNECTED);
+            isStarted = true;
+        }
+        return threadAudio;
+    }
+
+    // dispatches the messages queued to audioThread(), as the high priority task
+    // does before the next data callback, then pulls one A2DP packet
+    static void pullPacket(uint8_t *packet)
+    {
+        ThreadAudio &threadAudio = audioThread();
+        while (threadAudio.messagesWaiting() > 0)
+        {
+            threadAudio.messageLoop(0);
+        }
+        ccall_bt_app_a2d_data_cb(packet, A2DP_PACKET_SIZE);
+    }
+};
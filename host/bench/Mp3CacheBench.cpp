@@ -0,0 +1,272 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// MP3 cues (Mp3Cache): decode time per MP3 frame, and the hit rate of the
+// decode-ahead cache over the PlaySound sequences of a swim. The bundle holds
+// the built-in cues as MP3 streams, mapped as the "cues" partition; the worker
+// is run here as ThreadApp does, on each PlaySound (EventCueDecode) and every
+// STATUS_INTERVAL_MS (EventStatus). Built with HELIX_DIR, the streams are the
+// mp3 files of data/ decoded by libhelix; otherwise they are the linked 8-bit
+// cues packed for the fake decoder of stubs/helix_fake, which checks the cache
+// bit exact but leaves out the cost of the MP3 decode itself.
+#include "HostBench.h"
+#include "HostStubs.h"
+#include "data/CueStore.h"
+#include "data/CueBundle.h"
+#include "data/SoundBuffer.h"
+#include <MP3DecoderHelix.h>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+static const uint32_t STATUS_INTERVAL_MS = 100; // ThreadApp
+static const uint16_t MP3_FRAME_SAMPLES = 1152; // per channel, MPEG-1 layer III
+
+// the cue of each PlaySound bit, as soundCues of SoundBuffer.cpp
+static const struct
+{
+    uint8_t bits;
+    uint8_t cue;
+} soundCues[] = {{0x18, I2cParam::CueEdgePool}, {0x02, I2cParam::CueLaneMiddle}, {0x01, I2cParam::CueLaneLeft}, {0x04, I2cParam::CueLaneRight}, {0x20, I2cParam::CueError}};
+
+typedef struct _Swim
+{
+    const char *name;
+    std::vector<uint8_t> sounds; // PlaySound sound, one per 0.5s cycle
+} Swim;
+
+// the linked 8-bit cue, nullptr if it is not one
+static const int8_t *linkedCue(uint8_t id)
+{
+    const CueBundleHeader *header = (const CueBundleHeader *)cueBundleData;
+    const CueBundleEntry *entry = (const CueBundleEntry *)(cueBundleData + sizeof(CueBundleHeader));
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        if (entry[i].id == id && entry[i].format == CueFormatS8 && entry[i].rate == CUE_SAMPLE_RATE)
+        {
+            return (const int8_t *)(cueBundleData + entry[i].offset);
+        }
+    }
+    return nullptr;
+}
+
+// what Mp3Cache makes of a whole slot of 8-bit PCM: the leading silence trimmed,
+// normalised to a peak of 127 and padded with silence
+static std::vector<int8_t> trimmedCue(const int8_t *pcm)
+{
+    uint32_t start = 0;
+    while (start < CUE_SLOT_SAMPLES && abs(pcm[start]) < Mp3Cache::TRIM_THRESHOLD)
+    {
+        start++;
+    }
+    int32_t peak = 1;
+    for (uint32_t i = start; i < CUE_SLOT_SAMPLES; i++)
+    {
+        peak = std::max<int32_t>(peak, abs(pcm[i]));
+    }
+    std::vector<int8_t> slab(CUE_SLOT_SAMPLES, 0);
+    for (uint32_t i = start; i < CUE_SLOT_SAMPLES; i++)
+    {
+        int32_t value = pcm[i] * 127;
+        slab[i - start] = (int8_t)((value + (value < 0 ? -peak : peak) / 2) / peak);
+    }
+    return slab;
+}
+
+// the built-in cues as MP3 streams: the files of data/, or for the fake decoder
+// the 8-bit cues, mono and stereo in turn
+static std::vector<uint8_t> mp3Bundle(void)
+{
+    const uint16_t count = I2cParam::CueCount - 1;
+    std::vector<std::vector<uint8_t>> streams(count);
+    for (uint8_t i = 0; i < count; i++)
+    {
+#ifdef HOST_HELIX
+        static const char *files[] = {"soundEdgePool.mp3", "soundLeftLane.mp3", "soundMiddleLane.mp3", "soundRightLane.mp3", "error.mp3"};
+        std::ifstream file(std::string(HOST_MP3_DIR "/") + files[i], std::ios::binary);
+        streams[i].assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+#else
+        const int8_t *cue = linkedCue(i + 1);
+        uint8_t channels = 1 + i % 2;
+        std::vector<int16_t> pcm;
+        for (uint32_t n = 0; n < CUE_SLOT_SAMPLES; n++)
+        {
+            pcm.insert(pcm.end(), channels, (int16_t)(cue[n] * 256));
+        }
+        for (uint32_t n = 0; n < CUE_SLOT_SAMPLES; n += MP3_FRAME_SAMPLES)
+        {
+            uint16_t samples = (uint16_t)std::min<uint32_t>(MP3_FRAME_SAMPLES, CUE_SLOT_SAMPLES - n);
+            libhelix::fakeMp3Frame(streams[i], &pcm[n * channels], samples * channels, channels, CUE_SAMPLE_RATE);
+        }
+#endif
+    }
+
+    const CueBundleHeader header = {.magic = {'C', 'U', 'E', 'B'}, .version = CUE_BUNDLE_VERSION, .count = count};
+    std::vector<uint8_t> bundle((const uint8_t *)&header, (const uint8_t *)&header + sizeof(header));
+    uint32_t offset = sizeof(CueBundleHeader) + count * sizeof(CueBundleEntry);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const CueBundleEntry entry = {.id = (uint8_t)(i + 1), .format = CueFormatMp3, .reserved = 0, .rate = CUE_SAMPLE_RATE,
+                                      .offset = offset, .length = (uint32_t)streams[i].size()};
+        bundle.insert(bundle.end(), (const uint8_t *)&entry, (const uint8_t *)&entry + sizeof(entry));
+        offset += (entry.length + CUE_BUNDLE_ALIGN - 1) / CUE_BUNDLE_ALIGN * CUE_BUNDLE_ALIGN;
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+        bundle.insert(bundle.end(), streams[i].begin(), streams[i].end());
+        bundle.resize((bundle.size() + CUE_BUNDLE_ALIGN - 1) / CUE_BUNDLE_ALIGN * CUE_BUNDLE_ALIGN);
+    }
+    return bundle;
+}
+
+static bool mapCues(const std::vector<uint8_t> &bundle)
+{
+    char path[] = "/tmp/mp3_bundle_XXXXXX";
+    int fd = mkstemp(path);
+    bool isWritten = fd >= 0 && write(fd, bundle.data(), bundle.size()) == (ssize_t)bundle.size();
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    CueStore::end();
+    bool result = isWritten && hostMapPartition("cues", path) && CueStore::begin();
+    unlink(path);
+    return result;
+}
+
+// decodes the pending cues as the worker, returns the ns spent
+static uint64_t runWorker(void)
+{
+    uint64_t start = HostBench::nowNs();
+    Mp3Cache::decodePending();
+    return HostBench::nowNs() - start;
+}
+
+HOST_BENCH(mp3_cache_decode_and_hit_rate)
+{
+    CHECK(mapCues(mp3Bundle()) && CueStore::isMapped());
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+
+    // each cue decoded alone, as PCM the 8-bit cue it was made from
+    uint64_t decodeNs = 0;
+    Mp3Cache::Stats before = Mp3Cache::stats();
+    for (uint8_t cue = I2cParam::CueNone + 1; cue < I2cParam::CueCount; cue++)
+    {
+        OneChannel8BitSoundData *soundData = Mp3Cache::soundData(cue);
+        CHECK(soundData != nullptr);
+        if (soundData == nullptr)
+        {
+            continue;
+        }
+        hostAdvanceTicks(pdMS_TO_TICKS(Mp3Cache::EVICT_IDLE_MS));
+        Mp3Cache::request(cue);
+        decodeNs += runWorker();
+
+        Frame frame;
+        soundData->getData(0, frame);
+        CHECK(frame.channel1 != 0);
+#ifndef HOST_HELIX
+        std::vector<int8_t> pcm = trimmedCue(linkedCue(cue));
+        int32_t mismatches = 0;
+        for (int32_t i = 0; i < Mp3Cache::SLAB_SIZE; i++)
+        {
+            soundData->getData(i, frame);
+            mismatches += (frame.channel1 != SampleS8::toLevel(pcm[i])) ? 1 : 0;
+        }
+        CHECK(mismatches == 0);
+#endif
+    }
+    Mp3Cache::Stats after = Mp3Cache::stats();
+    CHECK(after.decodes - before.decodes == I2cParam::CueCount - 1);
+    uint32_t frames = after.frames - before.frames;
+    printf("%s decoder: %u cues, %u MP3 frames, %.2f us per frame, %.1f us per cue\n",
+#ifdef HOST_HELIX
+           "libhelix",
+#else
+           "fake",
+#endif
+           I2cParam::CueCount - 1, frames, decodeNs / 1000.0 / frames, decodeNs / 1000.0 / (I2cParam::CueCount - 1));
+
+    const Swim swims[] = {
+        {"one lane", {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02}},
+        {"lane changes", {0x02, 0x01, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01, 0x02, 0x04, 0x02, 0x02}},
+        {"lengths and turns", {0x02, 0x02, 0x02, 0x08, 0x08, 0x02, 0x02, 0x02, 0x10, 0x10, 0x02, 0x02}},
+        {"edge off the lane", {0x01, 0x09, 0x09, 0x02, 0x04, 0x14, 0x14, 0x02}},
+        {"lost connection", {0x02, 0x20, 0x20, 0x22, 0x02, 0x20}},
+        {"every cue", {0x01, 0x02, 0x04, 0x08, 0x20, 0x01, 0x02, 0x04, 0x08, 0x20}},
+    };
+    const uint32_t CYCLE_FRAMES = SoundBuffer::SAMPLING_PER_SLOT * SoundBuffer::TOTAL_SLOTS;
+    const uint32_t STATUS_FRAMES = SoundBuffer::SAMPLING_RATE * STATUS_INTERVAL_MS / 1000;
+    std::vector<uint8_t> packet(A2DP_PACKET_SIZE);
+    uint32_t pos = 0;
+    uint32_t streamFrames = 0;
+    uint8_t sequence = 0;
+
+    printf("swim                PlaySound  references  hits  hit rate  decodes  evictions\n");
+    for (const Swim &swim : swims)
+    {
+        before = Mp3Cache::stats();
+        for (uint8_t sound : swim.sounds)
+        {
+            soundBuffer->updateSoundSignal(sound, sequence++);
+            runWorker();
+            for (uint32_t frame = 0; frame < CYCLE_FRAMES; frame += HostBench::PACKET_FRAMES)
+            {
+                pos += soundBuffer->get2ChannelData(pos, A2DP_PACKET_SIZE, packet.data());
+                uint32_t ms = (streamFrames + HostBench::PACKET_FRAMES) * 1000ULL / SoundBuffer::SAMPLING_RATE - streamFrames * 1000ULL / SoundBuffer::SAMPLING_RATE;
+                hostAdvanceTicks(pdMS_TO_TICKS(ms));
+                streamFrames += HostBench::PACKET_FRAMES;
+                if (streamFrames % STATUS_FRAMES < HostBench::PACKET_FRAMES)
+                {
+                    runWorker();
+                }
+            }
+        }
+        after = Mp3Cache::stats();
+        uint32_t references = after.prefetches - before.prefetches;
+        uint32_t hits = after.hits - before.hits;
+        CHECK(hits <= references);
+        printf("%-18s  %9u  %10u  %4u  %7.1f%%  %7u  %9u\n", swim.name, (unsigned)swim.sounds.size(), references, hits, 100.0 * hits / references,
+               after.decodes - before.decodes, after.evictions - before.evictions);
+
+        // the cues of the last PlaySound are cached by the end of its cycle
+        for (const auto &soundCue : soundCues)
+        {
+            if (swim.sounds.back() & soundCue.bits)
+            {
+                Frame frame;
+                Mp3Cache::soundData(soundCue.cue)->getData(0, frame);
+                CHECK(frame.channel1 != 0);
+            }
+        }
+    }
+    after = Mp3Cache::stats();
+    printf("overall: %u references, %.1f%% hits, %u decodes, %u evictions, longest decode %u us\n", after.prefetches,
+           100.0 * after.hits / after.prefetches, after.decodes, after.evictions, after.maxCueUs);
+
+    // back to the linked bundle for the other benchmarks; an empty partition is not a bundle
+    soundBuffer->~SoundBuffer();
+    CHECK(mapCues(std::vector<uint8_t>()) && !CueStore::isMapped());
+}
@@ -0,0 +1,128 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// PatternSequencer: compile time and render time per frame of patterns of 1, 4,
+// 16 and MAX_EVENTS events, with repeats and rests, rendered in A2DP packets.
+// The render walks the events with a cursor and no per-frame branch or
+// division, so its time per frame must not grow with the size of the pattern.
+// The cues are below full gain, so that all of them take the same render path.
+#include "HostBench.h"
+#include "data/CueStore.h"
+#include "data/PatternSequencer.h"
+#include <vector>
+
+typedef struct _BenchPattern
+{
+    const char *name;
+    int32_t events; // the steps compile to
+    std::vector<I2cParam::PatternStep> step;
+} BenchPattern;
+
+static OneChannel8BitSoundData cueData[I2cParam::CueCount];
+
+// the built-in cues as SoundBuffer resolves them: one slot of 8-bit PCM
+static OneChannel8BitSoundData *resolveCue(uint8_t cue, const int8_t **pcm)
+{
+    const CueBundleEntry *entry = CueStore::find(cue);
+    if (entry == nullptr || entry->format != CueFormatS8 || entry->length != (uint32_t)PatternSequencer::CUE_FRAMES)
+    {
+        *pcm = nullptr;
+        return nullptr;
+    }
+    *pcm = (const int8_t *)CueStore::samples(*entry);
+    cueData[cue].setData((int8_t *)*pcm, entry->length);
+    return &cueData[cue];
+}
+
+// ns per frame of count frames rendered in packets, best of 5 runs
+static double renderNs(PatternSequencer &sequencer, uint32_t count)
+{
+    SampleS16::Sample mono[HostBench::PACKET_FRAMES];
+    double best = 1e9;
+    for (int32_t run = 0; run < 5; run++)
+    {
+        uint64_t start = HostBench::nowNs();
+        for (uint32_t frame = 0; frame < count; frame += HostBench::PACKET_FRAMES)
+        {
+            int32_t rendered = 0;
+            while (rendered < (int32_t)HostBench::PACKET_FRAMES)
+            {
+                rendered += sequencer.render(mono + rendered, HostBench::PACKET_FRAMES - rendered);
+            }
+            __asm__ volatile("" : : "r"(mono) : "memory");
+        }
+        best = std::min(best, (double)(HostBench::nowNs() - start) / count);
+    }
+    return best;
+}
+
+HOST_BENCH(pattern_sequencer_scaling)
+{
+    const uint8_t REST = I2cParam::CueNone;
+    const uint8_t EDGE = I2cParam::CueEdgePool;
+    const uint8_t LEFT = I2cParam::CueLaneLeft;
+    const uint8_t MIDDLE = I2cParam::CueLaneMiddle;
+    const uint8_t RIGHT = I2cParam::CueLaneRight;
+    const uint8_t ERROR = I2cParam::CueError;
+    const BenchPattern patterns[] = {
+        {"1 event", 1, {{LEFT, 80, 10, 1}}},
+        {"4 events", 4, {{LEFT, 90, 5, 2}, {REST, 100, 7, 1}, {EDGE, 60, 8, 1}}},
+        {"16 events", 16, {{EDGE, 90, 3, 4}, {REST, 100, 2, 1}, {LEFT, 80, 12, 1}, {REST, 100, 5, 1}, {MIDDLE, 90, 6, 3}, {RIGHT, 50, 15, 2}, {ERROR, 90, 2, 1}, {REST, 100, 1, 1}}},
+        {"48 events", PatternSequencer::MAX_EVENTS,
+         {{EDGE, 90, 3, 4}, {REST, 100, 2, 1}, {LEFT, 80, 12, 3}, {REST, 100, 5, 1}, {MIDDLE, 90, 6, 3}, {RIGHT, 50, 15, 2}, {ERROR, 90, 2, 5}, {REST, 100, 1, 1},
+          {EDGE, 30, 2, 3}, {LEFT, 90, 6, 4}, {REST, 100, 1, 1}, {MIDDLE, 70, 1, 2}, {RIGHT, 90, 2, 5}, {ERROR, 90, 11, 2}, {EDGE, 90, 1, 4}, {REST, 100, 3, 1}}},
+    };
+
+    CHECK(CueStore::begin());
+    static PatternSequencer sequencer(resolveCue);
+    const uint32_t FRAMES = 10 * PatternSequencer::SAMPLING_RATE;
+    const int32_t COMPILES = 10000;
+    double minNs = 1e9;
+    double maxNs = 0;
+
+    printf("pattern     events  cycle ms  compile ns  render ns/frame\n");
+    for (const BenchPattern &pattern : patterns)
+    {
+        uint8_t stepCount = (uint8_t)pattern.step.size();
+        CHECK(PatternSequencer::eventCount(pattern.step.data(), stepCount) == pattern.events);
+
+        uint64_t start = HostBench::nowNs();
+        for (int32_t n = 0; n < COMPILES; n++)
+        {
+            CHECK(sequencer.compile(pattern.step.data(), stepCount));
+        }
+        double compileNs = (double)(HostBench::nowNs() - start) / COMPILES;
+        sequencer.commit();
+
+        // a whole number of cycles, starting at the first event
+        while (sequencer.position() != 0)
+        {
+            SampleS16::Sample mono[HostBench::PACKET_FRAMES];
+            sequencer.render(mono, HostBench::PACKET_FRAMES);
+        }
+        double frameNs = renderNs(sequencer, FRAMES);
+        minNs = std::min(minNs, frameNs);
+        maxNs = std::max(maxNs, frameNs);
+        printf("%-10s  %6d  %8u  %10.1f  %15.3f\n", pattern.name, pattern.events, sequencer.length() * 1000 / PatternSequencer::SAMPLING_RATE, compileNs, frameNs);
+    }
+
+    // flat: within a factor of 2 from 1 to MAX_EVENTS events
+    CHECK(maxNs < 2 * minNs);
+    printf("render time per frame, slowest against fastest pattern: x%.2f\n", maxNs / minNs);
+}
@@ -0,0 +1,103 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// PlaySound-to-audible latency under load (ThreadApp/ThreadAudio split): the
+// PlaySound frame reaches ThreadAudio behind a backlog of other commands, and
+// the latency runs from the packet it was received before to its first audible
+// frame. On the device the backlog is all that can delay the audio thread: the
+// housekeeping runs on the lower priority ThreadApp.
+#include "HostBench.h"
+#include "I2cMaster.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <vector>
+
+static bool isAudible(const uint8_t *packet)
+{
+    const Frame *frames = (const Frame *)packet;
+    for (uint32_t i = 0; i < HostBench::PACKET_FRAMES; i++)
+    {
+        if (frames[i].channel1 != 0 || frames[i].channel2 != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+HOST_BENCH(playsound_latency_under_load)
+{
+    ThreadAudio &threadAudio = HostBench::audioThread();
+    I2cA2dp i2cA2dp(threadAudio.commandQueue(), EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+
+    const uint32_t CYCLE_PACKETS = SoundBuffer::SAMPLING_RATE / 2 / HostBench::PACKET_FRAMES;
+    const uint32_t TRIALS = 64;
+    std::vector<uint8_t> packet(A2DP_PACKET_SIZE);
+
+    printf("backlog  latency min/avg/max (ms)  handlers (us per command)\n");
+    for (uint32_t backlog : {0u, 8u, 24u})
+    {
+        uint32_t minPackets = UINT32_MAX;
+        uint32_t maxPackets = 0;
+        uint64_t sumPackets = 0;
+        uint64_t handlerNs = 0;
+        for (uint32_t trial = 0; trial < TRIALS; trial++)
+        {
+            // silence, then a different phase of the 0.5s cycle for each trial
+            CHECK(I2cMaster::transfer(I2cMaster::playSound(60, 0)) == I2cResponse::Success);
+            for (uint32_t n = 0; n < 1 + trial * 7 % CYCLE_PACKETS; n++)
+            {
+                HostBench::pullPacket(packet.data());
+            }
+
+            // the commands queued ahead are PlaySound too, the heaviest handler
+            for (uint32_t n = 0; n < backlog; n++)
+            {
+                CHECK(I2cMaster::transfer(I2cMaster::playSound(50 + n % 10, 0)) == I2cResponse::Success);
+            }
+            CHECK(I2cMaster::transfer(I2cMaster::playSound(60, 0x02)) == I2cResponse::Success); // laneLeft
+
+            uint64_t start = HostBench::nowNs();
+            while (threadAudio.messagesWaiting() > 0)
+            {
+                threadAudio.messageLoop(0);
+            }
+            handlerNs += HostBench::nowNs() - start;
+
+            uint32_t packets = 0;
+            do
+            {
+                HostBench::pullPacket(packet.data());
+                packets++;
+            } while (!isAudible(packet.data()) && packets <= 2 * CYCLE_PACKETS);
+
+            minPackets = std::min(minPackets, packets);
+            maxPackets = std::max(maxPackets, packets);
+            sumPackets += packets;
+        }
+
+        // the cue waits for its slot, at most one cycle, rounded up to the packet
+        CHECK(maxPackets <= CYCLE_PACKETS + 1);
+        const double packetMs = 1000.0 * HostBench::PACKET_FRAMES / SoundBuffer::SAMPLING_RATE;
+        printf("%7u  %6.1f / %6.1f / %6.1f       %.2f\n", backlog, minPackets * packetMs, sumPackets * packetMs / TRIALS, maxPackets * packetMs,
+               handlerNs / 1000.0 / TRIALS / (backlog + 1));
+    }
+    Wire.end();
+}
@@ -0,0 +1,103 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Resampler of the low rate cues (ResampledSoundData): time per output frame,
+// and distortion of 8-bit sine tones upsampled from each supported input rate
+// to 44.1 kHz. SINAD is the ratio of the fitted sine to everything else
+// (images, filter error, rounding); the 8-bit input alone is given for
+// comparison.
+#include "HostBench.h"
+#include "data/ResampledSoundData.h"
+#include <math.h>
+#include <vector>
+
+// ratio in dB of the sine at frequency (cycles per sample, a whole number of
+// cycles over count samples) to the residual of the signal
+static double sinad(const int32_t *signal, int32_t count, double frequency)
+{
+    double s = 0;
+    double c = 0;
+    double mean = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        s += signal[i] * sin(2 * M_PI * frequency * i);
+        c += signal[i] * cos(2 * M_PI * frequency * i);
+        mean += signal[i];
+    }
+    s *= 2.0 / count;
+    c *= 2.0 / count;
+    mean /= count;
+
+    double noise = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        double residual = signal[i] - mean - s * sin(2 * M_PI * frequency * i) - c * cos(2 * M_PI * frequency * i);
+        noise += residual * residual;
+    }
+    return 10 * log10((s * s + c * c) / 2 / (noise / count));
+}
+
+HOST_BENCH(resampler_cost_and_distortion)
+{
+    const uint32_t rates[] = {8000, 11025, 16000, 22050};
+    const double tones[] = {500, 1000, 3000};
+    const uint32_t OUTPUT_RATE = ResampledSoundData::OUTPUT_RATE;
+    const int32_t ANALYSED = OUTPUT_RATE / 5; // 0.2s, a whole number of cycles of each tone
+    const int32_t SKIPPED = OUTPUT_RATE / 20; // the edges of the cue are faded by the filter
+    double minSinad = 1000;
+
+    printf("input rate  tone (Hz)  8-bit input (dB)  SINAD (dB)  resample (ns/frame)\n");
+    for (uint32_t rate : rates)
+    {
+        for (double tone : tones)
+        {
+            // 0.3s of a sine at 100/127 of full scale
+            std::vector<int8_t> input(rate * 3 / 10);
+            std::vector<int32_t> inputLevel(input.size());
+            for (size_t i = 0; i < input.size(); i++)
+            {
+                input[i] = (int8_t)lround(100 * sin(2 * M_PI * tone * i / rate));
+                inputLevel[i] = input[i];
+            }
+            ResampledSoundData resampled;
+            resampled.setSamples(input.data(), input.size(), rate);
+
+            std::vector<int32_t> output(ANALYSED);
+            uint64_t start = HostBench::nowNs();
+            for (int32_t i = 0; i < ANALYSED; i++)
+            {
+                Frame frame;
+                resampled.getData(SKIPPED + i, frame);
+                output[i] = frame.channel1;
+            }
+            uint64_t elapsedNs = HostBench::nowNs() - start;
+
+            double inputSinad = sinad(&inputLevel[rate / 20], rate / 5, tone / rate);
+            double outputSinad = sinad(output.data(), ANALYSED, tone / OUTPUT_RATE);
+            if (tone <= rate / 4)
+            {
+                minSinad = std::min(minSinad, outputSinad);
+            }
+            printf("%10u  %9.0f  %16.1f  %10.1f  %19.2f\n", rate, tone, inputSinad, outputSinad, (double)elapsedNs / ANALYSED);
+        }
+    }
+    // up to a quarter of the input rate; nearer to the cutoff (0.45) the 8 taps
+    // leave the image at rate - tone less attenuated, e.g. 3kHz from 8kHz
+    CHECK(minSinad > 40);
+}
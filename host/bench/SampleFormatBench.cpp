@@ -0,0 +1,119 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Bytes moved per second of audio by the sample formats of SampleFormat.h: each
+// conversion on its own, then a block of two cues mixed the way SoundBuffer
+// renders it (8-bit cues mixed into a 16-bit mono buffer, widened to Frame once)
+// against the former render on Frame from the first stage. The byte counts are
+// those of the formats; the times are of the host.
+#include "HostBench.h"
+#include "data/SampleFormat.h"
+#include "data/SoundBuffer.h"
+#include <vector>
+
+static const int32_t SECOND = SoundBuffer::SAMPLING_RATE;
+static const int32_t REPEAT = 50;
+
+// ns per second of audio of fn(), best of REPEAT runs
+template <typename Fn>
+static double secondNs(Fn fn)
+{
+    uint64_t best = UINT64_MAX;
+    for (int32_t n = 0; n < REPEAT; n++)
+    {
+        uint64_t start = HostBench::nowNs();
+        fn();
+        best = std::min(best, HostBench::nowNs() - start);
+    }
+    return (double)best;
+}
+
+template <typename From, typename To>
+static void convertBench(const char *name, const typename From::Sample *from, typename To::Sample *to)
+{
+    double ns = secondNs([&]()
+                         {
+                             convertSamples<From, To>(from, to, SECOND);
+                             __asm__ volatile("" : : "r"(to) : "memory");
+                         });
+    uint32_t bytes = SECOND * (sizeof(typename From::Sample) + sizeof(typename To::Sample));
+    printf("%-12s  %9u  %8.1f  %6.2f\n", name, bytes, ns / 1000, bytes / ns);
+}
+
+HOST_BENCH(sample_format_bytes_moved)
+{
+    std::vector<SampleS8::Sample> cueA(SECOND), cueB(SECOND);
+    for (int32_t i = 0; i < SECOND; i++)
+    {
+        cueA[i] = (int8_t)(((i * 7) % 255) - 127);
+        cueB[i] = (int8_t)(((i * 13) % 251) - 125);
+    }
+    std::vector<SampleS16::Sample> mono(SECOND);
+    std::vector<SampleFrame::Sample> frames(SECOND), wide(SECOND);
+    std::vector<SampleS8::Sample> back(SECOND);
+
+    printf("conversion    bytes/s   us/s  host GB/s\n");
+    convertBench<SampleS8, SampleS16>("S8 -> S16", cueA.data(), mono.data());
+    convertBench<SampleS16, SampleS8>("S16 -> S8", mono.data(), back.data());
+    convertBench<SampleS16, SampleFrame>("S16 -> Frame", mono.data(), frames.data());
+    convertBench<SampleS8, SampleFrame>("S8 -> Frame", cueA.data(), frames.data());
+    convertBench<SampleFrame, SampleFrame>("Frame copy", frames.data(), wide.data());
+    CHECK(back == cueA);
+    bool isStereo = true;
+    for (int32_t i = 0; i < SECOND; i++)
+    {
+        isStereo = isStereo && frames[i].channel1 == SampleS8::toLevel(cueA[i]) && frames[i].channel2 == frames[i].channel1;
+    }
+    CHECK(isStereo);
+
+    // narrow: both cues read as 8-bit and mixed into 16-bit mono, then widened
+    double narrowNs = secondNs([&]()
+                               {
+                                   for (int32_t i = 0; i < SECOND; i++)
+                                   {
+                                       mono[i] = SampleS16::fromLevel(SampleS8::toLevel(cueA[i]) + SampleS8::toLevel(cueB[i]));
+                                   }
+                                   convertSamples<SampleS16, SampleFrame>(mono.data(), frames.data(), SECOND);
+                                   __asm__ volatile("" : : "r"(frames.data()) : "memory");
+                               });
+    uint32_t narrowBytes = SECOND * (2 * sizeof(SampleS8::Sample) + 2 * sizeof(SampleS16::Sample) + sizeof(SampleFrame::Sample));
+
+    // wide: the first cue widened to Frame, the second mixed into the Frames in place
+    double wideNs = secondNs([&]()
+                             {
+                                 convertSamples<SampleS8, SampleFrame>(cueA.data(), wide.data(), SECOND);
+                                 for (int32_t i = 0; i < SECOND; i++)
+                                 {
+                                     wide[i] = SampleFrame::fromLevel(SampleFrame::toLevel(wide[i]) + SampleS8::toLevel(cueB[i]));
+                                 }
+                                 __asm__ volatile("" : : "r"(wide.data()) : "memory");
+                             });
+    uint32_t wideBytes = SECOND * (2 * sizeof(SampleS8::Sample) + 3 * sizeof(SampleFrame::Sample));
+
+    bool isSame = true;
+    for (int32_t i = 0; i < SECOND; i++)
+    {
+        isSame = isSame && frames[i].channel1 == wide[i].channel1 && frames[i].channel2 == wide[i].channel2;
+    }
+    CHECK(isSame);
+    CHECK(narrowBytes < wideBytes);
+
+    printf("two cues mixed, per second of audio: %u bytes and %.1f us on 16-bit mono, %u bytes and %.1f us on Frame (%.0f%% of the bytes)\n",
+           narrowBytes, narrowNs / 1000, wideBytes, wideNs / 1000, 100.0 * narrowBytes / wideBytes);
+}
@@ -0,0 +1,102 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Tone synthesiser (ToneSoundData) against the A2DP block budget: time per
+// frame of each waveform with and without FM, then the render of whole packets
+// by SoundBuffer with four tones scheduled on the voices plus an urgent tone,
+// the most the render path mixes at once. The budget is the playing time of a
+// packet; the host share is printed, the device has to be measured on target.
+#include "HostBench.h"
+#include "data/SoundBuffer.h"
+#include "data/ToneSoundData.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <new>
+#include <vector>
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+static I2cParam::ToneParam toneParam(uint16_t frequency, uint8_t waveform, uint16_t fmFrequency)
+{
+    return I2cParam::ToneParam{.frequency = frequency, .waveform = waveform, .gain = 80, .attack = 5, .decay = 20, .sustain = 50, .release = 30,
+                               .fmFrequency = fmFrequency, .fmIndex = (uint8_t)(fmFrequency ? 32 : 0)};
+}
+
+// renders count packets, returns the ns spent in get2ChannelData()
+static uint64_t renderPackets(SoundBuffer *soundBuffer, uint32_t &pos, uint32_t count)
+{
+    std::vector<uint8_t> packet(A2DP_PACKET_SIZE);
+    uint64_t elapsedNs = 0;
+    for (uint32_t n = 0; n < count; n++)
+    {
+        uint64_t start = HostBench::nowNs();
+        pos += soundBuffer->get2ChannelData(pos, A2DP_PACKET_SIZE, packet.data());
+        elapsedNs += HostBench::nowNs() - start;
+    }
+    return elapsedNs;
+}
+
+HOST_BENCH(tone_synth_block_budget)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    const double budgetNs = 1e9 * HostBench::PACKET_FRAMES / SoundBuffer::SAMPLING_RATE;
+    const char *waveforms[] = {"sine", "triangle", "square"};
+
+    printf("waveform  fm     ns/frame  share of the budget per voice\n");
+    for (uint8_t waveform = I2cParam::WaveSine; waveform <= I2cParam::WaveSquare; waveform++)
+    {
+        for (uint16_t fm : {0, 220})
+        {
+            CHECK(ToneSoundData::set(0, toneParam(880, waveform, fm)));
+            OneChannel8BitSoundData *tone = ToneSoundData::soundData(0);
+            int64_t sum = 0;
+            uint64_t start = HostBench::nowNs();
+            for (int32_t i = 0; i < ToneSoundData::LENGTH; i++)
+            {
+                Frame frame;
+                tone->getData(i, frame);
+                sum += abs(frame.channel1);
+            }
+            double frameNs = (double)(HostBench::nowNs() - start) / ToneSoundData::LENGTH;
+            CHECK(sum > 0);
+            printf("%-8s  %-5s  %8.2f  %6.3f%%\n", waveforms[waveform], fm ? "on" : "off", frameNs, 100 * frameNs * HostBench::PACKET_FRAMES / budgetNs);
+        }
+    }
+
+    // the pattern alone, then with every voice and the urgent cue on a tone
+    const uint32_t SLOT_PACKETS = SoundBuffer::SAMPLING_PER_SLOT / HostBench::PACKET_FRAMES;
+    uint32_t pos = 0;
+    soundBuffer->updateSoundSignal(0x23, 0);
+    renderPackets(soundBuffer, pos, SLOT_PACKETS);
+    uint64_t patternNs = renderPackets(soundBuffer, pos, SLOT_PACKETS);
+
+    for (uint8_t id = 0; id < ToneSoundData::MAX_TONES; id++)
+    {
+        CHECK(ToneSoundData::set(id, toneParam(440 + 220 * id, id % 3, id ? 110 * id : 0)));
+        CHECK(soundBuffer->scheduleCue(soundBuffer->streamFrame(), I2cParam::CueTone + id, 100));
+    }
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueTone, 100, 1) == I2cResponse::Success);
+    uint64_t tonesNs = renderPackets(soundBuffer, pos, SLOT_PACKETS);
+    renderPackets(soundBuffer, pos, 2 * SLOT_PACKETS); // the urgent cue is over
+    soundBuffer->~SoundBuffer();
+
+    printf("packet of %u frames: %.1f us with the pattern, %.1f us with %u tones and an urgent tone, %.2f%% of the %.0f us budget\n",
+           HostBench::PACKET_FRAMES, patternNs / 1000.0 / SLOT_PACKETS, tonesNs / 1000.0 / SLOT_PACKETS, ToneSoundData::MAX_TONES,
+           100.0 * tonesNs / SLOT_PACKETS / budgetNs, budgetNs / 1000);
+}
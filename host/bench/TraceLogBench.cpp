@@ -0,0 +1,93 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Per-log cost of TraceLog: TraceLog::log() on the hot path and the deferred
+// TraceLog::drain(), against formatting the same message synchronously as
+// LOG_TRACE did in the Wire callback. The output goes to a Print which only
+// counts bytes; the time a UART takes to send them is computed, not measured.
+#include "HostBench.h"
+#include "debug/TraceLog.h"
+
+class NullPrint : public Print
+{
+public:
+    size_t write(uint8_t) override
+    {
+        bytes++;
+        return 1;
+    }
+    size_t write(const uint8_t *, size_t size) override
+    {
+        bytes += size;
+        return size;
+    }
+
+    size_t bytes = 0;
+};
+
+HOST_BENCH(trace_log_cost)
+{
+    const uint32_t BATCH = TraceLog::RING_SIZE / 2; // drained before the ring overflows
+    const uint32_t BATCHES = 200;
+    const uint32_t COUNT = BATCH * BATCHES;
+
+    NullPrint out;
+    TraceLog::drain(out); // earlier records of the process
+    uint32_t dropped = TraceLog::dropped();
+
+    uint64_t logNs = 0;
+    uint64_t drainNs = 0;
+    uint32_t drained = 0;
+    for (uint32_t b = 0; b < BATCHES; b++)
+    {
+        uint64_t start = HostBench::nowNs();
+        for (uint32_t i = 0; i < BATCH; i++)
+        {
+            TraceLog::log(TraceI2cPlaySound, 50, 0x23, 0);
+        }
+        logNs += HostBench::nowNs() - start;
+
+        start = HostBench::nowNs();
+        drained += TraceLog::drain(out);
+        drainNs += HostBench::nowNs() - start;
+    }
+    CHECK(drained == COUNT);
+    CHECK(TraceLog::dropped() == dropped);
+    size_t traceBytes = out.bytes;
+
+    // the same text formatted at the call site
+    NullPrint formatted;
+    uint64_t start = HostBench::nowNs();
+    for (uint32_t i = 0; i < COUNT; i++)
+    {
+        uint32_t us = micros();
+        formatted.printf("[T %u.%06u] ", (unsigned)(us / 1000000), (unsigned)(us % 1000000));
+        formatted.printf("I2cCommand::PlaySound: paramVolume=%u, paramSound=(hex)%x, reply=%u", 50u, 0x23u, 0u);
+        formatted.println();
+    }
+    uint64_t formattedNs = HostBench::nowNs() - start;
+
+    const double uartUs = formatted.bytes * 10 * 1e6 / 115200 / COUNT; // 8N1 at 115200 bps
+    printf("TraceLog::log     %7.1f ns per record\n", (double)logNs / COUNT);
+    printf("TraceLog::drain   %7.1f ns per record, off the hot path\n", (double)drainNs / COUNT);
+    printf("formatted inline  %7.1f ns per message, + %.0f us on a 115200 bps UART once its buffer is full (%u bytes)\n",
+           (double)formattedNs / COUNT, uartUs, (uint32_t)(formatted.bytes / COUNT));
+    // the same text either way, up to a digit of the timestamp
+    CHECK(traceBytes / COUNT + 1 >= formatted.bytes / COUNT && formatted.bytes / COUNT + 1 >= traceBytes / COUNT);
+}
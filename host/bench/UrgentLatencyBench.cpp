@@ -0,0 +1,94 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Latency of PlayUrgent: the cue must start at the first frame of the next A2DP
+// packet whatever the position in the pattern, so that the added latency is at
+// most the one packet being played when the command arrives. The start is
+// found in the output as the first audible frame minus the leading silence of
+// the cue itself.
+#include "HostBench.h"
+#include "I2cMaster.h"
+#include "data/CueStore.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <vector>
+
+// index of the first non-silent frame in count frames, count if none
+static uint32_t firstAudible(const Frame *frames, uint32_t count)
+{
+    uint32_t i = 0;
+    while (i < count && frames[i].channel1 == 0 && frames[i].channel2 == 0)
+    {
+        i++;
+    }
+    return i;
+}
+
+HOST_BENCH(urgent_latency_one_packet)
+{
+    ThreadAudio &threadAudio = HostBench::audioThread();
+    I2cA2dp i2cA2dp(threadAudio.commandQueue(), EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+    CHECK(I2cMaster::transfer(I2cMaster::playSound(100, 0)) == I2cResponse::Success);
+
+    const uint8_t cues[] = {I2cParam::CueLaneLeft, I2cParam::CueLaneMiddle, I2cParam::CueLaneRight, I2cParam::CueError};
+    const uint32_t TRIALS = 16;
+    const uint32_t CUE_PACKETS = SoundBuffer::SAMPLING_PER_SLOT / HostBench::PACKET_FRAMES + 2;
+    std::vector<uint8_t> packet(2 * A2DP_PACKET_SIZE);
+    uint32_t trials = 0;
+    uint32_t onTime = 0;
+
+    for (uint8_t cue : cues)
+    {
+        const CueBundleEntry *entry = CueStore::find(cue);
+        CHECK(entry && entry->format == CueFormatS8 && entry->rate == (uint32_t)SoundBuffer::SAMPLING_RATE);
+        if (!entry)
+        {
+            continue;
+        }
+        const int8_t *pcm = (const int8_t *)CueStore::samples(*entry);
+        uint32_t leadIn = 0;
+        while (leadIn < entry->length && pcm[leadIn] == 0)
+        {
+            leadIn++;
+        }
+
+        for (uint32_t trial = 0; trial < TRIALS; trial++)
+        {
+            // the previous cue is over, then a different stream position for each trial
+            for (uint32_t n = 0; n < CUE_PACKETS + trial * 3; n++)
+            {
+                HostBench::pullPacket(packet.data());
+            }
+
+            CHECK(I2cMaster::transfer(I2cFrame{I2cCommand::PlayUrgent, cue, 100, 1}) == I2cResponse::Success);
+            HostBench::pullPacket(packet.data());
+            HostBench::pullPacket(packet.data() + A2DP_PACKET_SIZE);
+            uint32_t start = firstAudible((const Frame *)packet.data(), 2 * HostBench::PACKET_FRAMES) - leadIn;
+            onTime += (start == 0) ? 1 : 0;
+            trials++;
+        }
+    }
+    CHECK(onTime == trials);
+
+    const double packetMs = 1000.0 * HostBench::PACKET_FRAMES / SoundBuffer::SAMPLING_RATE;
+    printf("urgent cue started at frame 0 of the next packet in %u/%u trials: added latency <= %.1f ms (one %u-frame packet)\n",
+           onTime, trials, packetMs, HostBench::PACKET_FRAMES);
+    Wire.end();
+}
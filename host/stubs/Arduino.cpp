@@ -0,0 +1,175 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+unsigned long micros(void)
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long millis(void)
+{
+    return micros() / 1000;
+}
+
+void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield(void)
+{
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size-- > 0 && write(*buffer++) == 1)
+    {
+        n++;
+    }
+    return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (len < 0)
+    {
+        return 0;
+    }
+    if ((size_t)len < sizeof(buffer))
+    {
+        return write((const uint8_t *)buffer, len);
+    }
+
+    char *text = (char *)malloc(len + 1);
+    if (text == nullptr)
+    {
+        return 0;
+    }
+    va_start(args, format);
+    vsnprintf(text, len + 1, format, args);
+    va_end(args);
+    size_t n = write((const uint8_t *)text, len);
+    free(text);
+    return n;
+}
+
+size_t Print::print(long n, int base)
+{
+    return (base == HEX) ? printf("%lx", n) : printf("%ld", n);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+    return (base == HEX) ? printf("%lx", n) : printf("%lu", n);
+}
+
+size_t Print::print(double n, int digits)
+{
+    return printf("%.*f", digits, n);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush(void)
+{
+    fflush(stdout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// the host heap is not limited, report the size of the ESP32 DRAM heap at boot
+static const uint32_t HEAP_SIZE = 300 * 1024;
+
+uint32_t esp_get_free_heap_size(void)
+{
+    return HEAP_SIZE;
+}
+
+uint32_t esp_get_minimum_free_heap_size(void)
+{
+    return HEAP_SIZE;
+}
+
+uint32_t xPortGetFreeHeapSize(void)
+{
+    return HEAP_SIZE;
+}
+
+uint32_t xPortGetMinimumEverFreeHeapSize(void)
+{
+    return HEAP_SIZE;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void)caps;
+    return HEAP_SIZE;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    (void)caps;
+    return HEAP_SIZE;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    (void)caps;
+    return HEAP_SIZE;
+}
@@ -0,0 +1,57 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Host stand-in of https://github.com/hideakitai/DebugLog: logging is compiled
+// out, the host tools report through Serial (stdout) instead.
+
+namespace DebugLogLevel
+{
+    enum LogLevel
+    {
+        LVL_NONE = 0,
+        LVL_ERROR,
+        LVL_WARN,
+        LVL_INFO,
+        LVL_DEBUG,
+        LVL_TRACE,
+    };
+}
+
+struct DebugLogBase
+{
+    enum Radix
+    {
+        BIN = 2,
+        OCT = 8,
+        DEC = 10,
+        HEX = 16,
+    };
+};
+
+#define LOG_ERROR(...) ((void)0)
+#define LOG_WARN(...) ((void)0)
+#define LOG_INFO(...) ((void)0)
+#define LOG_DEBUG(...) ((void)0)
+#define LOG_TRACE(...) ((void)0)
+#define PRINT(...) ((void)0)
+#define PRINTLN(...) ((void)0)
+#define LOG_SET_LEVEL(level) ((void)(level))
+#define LOG_SET_DELIMITER(delimiter) ((void)(delimiter))
+#define LOG_ATTACH_SERIAL(serial) ((void)(serial))
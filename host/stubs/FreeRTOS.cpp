@@ -0,0 +1,366 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <Arduino.h>
+#include "HostStubs.h"
+#include <vector>
+
+struct HostQueue
+{
+    std::vector<uint8_t> storage;
+    UBaseType_t itemSize;
+    UBaseType_t length;
+    UBaseType_t head;
+    UBaseType_t count;
+    bool isStatic;
+    HostQueue *set; // queue set holding this queue, nullptr if none
+};
+
+struct HostTask
+{
+    const char *name;
+    UBaseType_t number;
+    UBaseType_t priority;
+    BaseType_t coreId;
+    uint32_t stackDepth;
+    bool isDeleted;
+};
+
+static TickType_t tickCount = 0;
+
+static const UBaseType_t MAX_TASKS = 16;
+static HostTask tasks[MAX_TASKS] = {
+    {"loopTask", 1, 1, 1, 8192, false}, // the caller of the host tools and tests
+    {"IDLE0", 2, 0, 0, 1024, false},
+    {"IDLE1", 3, 0, 1, 1024, false},
+};
+static UBaseType_t taskCount = 3;
+
+void hostAssertFailed(const char *expression, const char *file, int line)
+{
+    fflush(stdout);
+    fprintf(stderr, "%s:%d: assert failed: %s\n", file, line, expression);
+    abort();
+}
+
+void hostAdvanceTicks(TickType_t ticks)
+{
+    tickCount += ticks;
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+    return ARDUINO_RUNNING_CORE;
+}
+
+BaseType_t xPortInIsrContext(void)
+{
+    return pdFALSE;
+}
+
+BaseType_t xPortIsInsideInterrupt(void)
+{
+    return pdFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// tasks are registered for the task list (TaskProfiler) but never run
+static TaskHandle_t createTask(const char *name, uint32_t stackDepth, UBaseType_t priority, BaseType_t coreId)
+{
+    configASSERT(taskCount < MAX_TASKS);
+    HostTask *task = &tasks[taskCount++];
+    task->name = name;
+    task->number = taskCount;
+    task->priority = priority;
+    task->coreId = coreId;
+    task->stackDepth = stackDepth;
+    task->isDeleted = false;
+    return task;
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t pxTaskCode, const char *pcName, uint32_t ulStackDepth, void *pvParameters,
+                                           UBaseType_t uxPriority, StackType_t *puxStackBuffer, StaticTask_t *pxTaskBuffer, BaseType_t xCoreID)
+{
+    (void)pxTaskCode;
+    (void)pvParameters;
+    (void)puxStackBuffer;
+    (void)pxTaskBuffer;
+    return createTask(pcName, ulStackDepth, uxPriority, xCoreID);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pxTaskCode, const char *pcName, uint32_t usStackDepth, void *pvParameters,
+                                   UBaseType_t uxPriority, TaskHandle_t *pxCreatedTask, BaseType_t xCoreID)
+{
+    (void)pxTaskCode;
+    (void)pvParameters;
+    TaskHandle_t task = createTask(pcName, usStackDepth, uxPriority, xCoreID);
+    if (pxCreatedTask)
+    {
+        *pxCreatedTask = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char *pcName, uint32_t usStackDepth, void *pvParameters,
+                       UBaseType_t uxPriority, TaskHandle_t *pxCreatedTask)
+{
+    return xTaskCreatePinnedToCore(pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t xTask)
+{
+    if (xTask)
+    {
+        xTask->isDeleted = true;
+    }
+}
+
+void vTaskDelay(TickType_t xTicksToDelay)
+{
+    tickCount += xTicksToDelay;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return tickCount;
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return tickCount;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return &tasks[0];
+}
+
+TaskHandle_t xTaskGetIdleTaskHandleForCPU(UBaseType_t cpuid)
+{
+    return &tasks[1 + (cpuid & 1)];
+}
+
+const char *pcTaskGetTaskName(TaskHandle_t xTask)
+{
+    return (xTask ? xTask : xTaskGetCurrentTaskHandle())->name;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask)
+{
+    return (xTask ? xTask : xTaskGetCurrentTaskHandle())->priority;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask)
+{
+    return (xTask ? xTask : xTaskGetCurrentTaskHandle())->stackDepth / 2;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void)
+{
+    UBaseType_t n = 0;
+    for (UBaseType_t i = 0; i < taskCount; i++)
+    {
+        n += tasks[i].isDeleted ? 0 : 1;
+    }
+    return n;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *pxTaskStatusArray, UBaseType_t uxArraySize, uint32_t *pulTotalRunTime)
+{
+    UBaseType_t n = 0;
+    for (UBaseType_t i = 0; i < taskCount && n < uxArraySize; i++)
+    {
+        HostTask &task = tasks[i];
+        if (task.isDeleted)
+        {
+            continue;
+        }
+        TaskStatus_t &status = pxTaskStatusArray[n++];
+        memset(&status, 0, sizeof(status));
+        status.xHandle = &task;
+        status.pcTaskName = task.name;
+        status.xTaskNumber = task.number;
+        status.eCurrentState = (i == 0) ? eRunning : eBlocked;
+        status.uxCurrentPriority = task.priority;
+        status.uxBasePriority = task.priority;
+        status.usStackHighWaterMark = task.stackDepth / 2;
+        status.xCoreID = task.coreId;
+    }
+    if (pulTotalRunTime)
+    {
+        *pulTotalRunTime = 0;
+    }
+    return n;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+static QueueHandle_t createQueue(UBaseType_t uxQueueLength, UBaseType_t uxItemSize, bool isStatic)
+{
+    HostQueue *queue = new HostQueue();
+    queue->storage.resize((size_t)uxQueueLength * uxItemSize);
+    queue->itemSize = uxItemSize;
+    queue->length = uxQueueLength;
+    queue->head = 0;
+    queue->count = 0;
+    queue->isStatic = isStatic;
+    queue->set = nullptr;
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+    return createQueue(uxQueueLength, uxItemSize, false);
+}
+
+// the items are kept in host memory, the given storage is not used
+QueueHandle_t xQueueCreateStatic(UBaseType_t uxQueueLength, UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxQueueBuffer)
+{
+    configASSERT(pucQueueStorage != nullptr && pxQueueBuffer != nullptr);
+    return createQueue(uxQueueLength, uxItemSize, true);
+}
+
+void vQueueDelete(QueueHandle_t xQueue)
+{
+    delete xQueue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait)
+{
+    (void)xTicksToWait;
+    configASSERT(xQueue != nullptr);
+    if (xQueue->count >= xQueue->length)
+    {
+        return pdFALSE;
+    }
+    UBaseType_t tail = (xQueue->head + xQueue->count) % xQueue->length;
+    if (xQueue->itemSize > 0)
+    {
+        memcpy(&xQueue->storage[(size_t)tail * xQueue->itemSize], pvItemToQueue, xQueue->itemSize);
+    }
+    xQueue->count++;
+    if (xQueue->set)
+    {
+        // the set has room for every item of its members
+        BaseType_t result = xQueueSend(xQueue->set, &xQueue, 0);
+        configASSERT(result == pdTRUE);
+    }
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t xQueue, const void *pvItemToQueue, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    if (pxHigherPriorityTaskWoken)
+    {
+        *pxHigherPriorityTaskWoken = pdFALSE;
+    }
+    return xQueueSend(xQueue, pvItemToQueue, 0);
+}
+
+// nothing else can post while the caller waits: an empty queue times out at once
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait)
+{
+    configASSERT(xQueue != nullptr);
+    if (xQueue->count == 0)
+    {
+        if (xTicksToWait != portMAX_DELAY)
+        {
+            tickCount += xTicksToWait;
+        }
+        return pdFALSE;
+    }
+    if (xQueue->itemSize > 0)
+    {
+        memcpy(pvBuffer, &xQueue->storage[(size_t)xQueue->head * xQueue->itemSize], xQueue->itemSize);
+    }
+    xQueue->head = (xQueue->head + 1) % xQueue->length;
+    xQueue->count--;
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t xQueue)
+{
+    return xQueue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t xQueue)
+{
+    return xQueue->length - xQueue->count;
+}
+
+// a queue set is a queue of the handles of its members, one per item sent to them
+QueueSetHandle_t xQueueCreateSet(UBaseType_t uxEventQueueLength)
+{
+    return createQueue(uxEventQueueLength, sizeof(QueueHandle_t), false);
+}
+
+BaseType_t xQueueAddToSet(QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet)
+{
+    configASSERT(xQueueOrSemaphore != nullptr && xQueueSet != nullptr);
+    if (xQueueOrSemaphore->set != nullptr || xQueueOrSemaphore->count != 0)
+    {
+        return pdFAIL;
+    }
+    xQueueOrSemaphore->set = xQueueSet;
+    return pdPASS;
+}
+
+QueueSetMemberHandle_t xQueueSelectFromSet(QueueSetHandle_t xQueueSet, TickType_t xTicksToWait)
+{
+    QueueSetMemberHandle_t member = nullptr;
+    xQueueReceive(xQueueSet, &member, xTicksToWait);
+    return member;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// a mutex is a queue of one item without payload, taken when the item is there
+static SemaphoreHandle_t createMutex(bool isStatic)
+{
+    QueueHandle_t queue = createQueue(1, 0, isStatic);
+    xQueueSend(queue, nullptr, 0);
+    return queue;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return createMutex(false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *pxMutexBuffer)
+{
+    configASSERT(pxMutexBuffer != nullptr);
+    return createMutex(true);
+}
+
+// a single threaded host never waits for a mutex: taking a taken one is a deadlock on the device
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+    BaseType_t result = xQueueReceive(xSemaphore, nullptr, 0);
+    configASSERT(result == pdTRUE || xBlockTime != portMAX_DELAY);
+    return result;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+    return xQueueSend(xSemaphore, nullptr, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore)
+{
+    vQueueDelete(xSemaphore);
+}
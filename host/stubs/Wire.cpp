@@ -0,0 +1,67 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "Wire.h"
+
+TwoWire Wire;
+
+bool TwoWire::begin(uint8_t slaveAddr)
+{
+    _slaveAddr = slaveAddr;
+    return true;
+}
+
+void TwoWire::end(void)
+{
+    _onReceive = nullptr;
+    _onRequest = nullptr;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity)
+{
+    size_t n = std::min(quantity, BUFFER_SIZE - _txLength);
+    memcpy(&_txBuffer[_txLength], data, n);
+    _txLength += n;
+    return n;
+}
+
+// the slave driver truncates a frame to its buffer
+size_t TwoWire::masterWrite(const uint8_t *data, size_t len)
+{
+    _rxLength = std::min(len, BUFFER_SIZE);
+    _rxIndex = 0;
+    memcpy(_rxBuffer, data, _rxLength);
+    if (_onReceive)
+    {
+        _onReceive((int)_rxLength);
+    }
+    return _rxLength;
+}
+
+size_t TwoWire::masterRead(uint8_t *data, size_t len)
+{
+    _txLength = 0;
+    if (_onRequest)
+    {
+        _onRequest();
+    }
+    size_t n = std::min(len, _txLength);
+    memcpy(data, _txBuffer, n);
+    return n;
+}
@@ -0,0 +1,61 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Host stand-in of the Arduino-ESP32 TwoWire in slave mode. The bus master is
+// the test: masterWrite() delivers a frame to the onReceive() callback as the
+// slave driver does, masterRead() runs the onRequest() callback and returns
+// what it wrote.
+#include <Arduino.h>
+
+class TwoWire : public Stream
+{
+public:
+    static const size_t BUFFER_SIZE = 128; // I2C_BUFFER_LENGTH of the Arduino-ESP32 core
+
+    bool begin(uint8_t slaveAddr);
+    void end(void);
+    void onReceive(const std::function<void(int)> &callback) { _onReceive = callback; }
+    void onRequest(const std::function<void(void)> &callback) { _onRequest = callback; }
+
+    int available(void) override { return (int)(_rxLength - _rxIndex); }
+    int read(void) override { return (_rxIndex < _rxLength) ? _rxBuffer[_rxIndex++] : -1; }
+    int peek(void) override { return (_rxIndex < _rxLength) ? _rxBuffer[_rxIndex] : -1; }
+    size_t write(uint8_t data) override { return write(&data, 1); }
+    size_t write(const uint8_t *data, size_t quantity) override;
+    using Print::write;
+
+    // the master side, returns the number of bytes transferred
+    size_t masterWrite(const uint8_t *data, size_t len);
+    size_t masterRead(uint8_t *data, size_t len);
+
+    uint8_t slaveAddress(void) const { return _slaveAddr; }
+
+private:
+    std::function<void(int)> _onReceive;
+    std::function<void(void)> _onRequest;
+    uint8_t _slaveAddr = 0;
+    uint8_t _rxBuffer[BUFFER_SIZE];
+    size_t _rxLength = 0;
+    size_t _rxIndex = 0;
+    uint8_t _txBuffer[BUFFER_SIZE];
+    size_t _txLength = 0;
+};
+
+extern TwoWire Wire;
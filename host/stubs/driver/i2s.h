@@ -18,9 +18,10 @@
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #pragma once
-#include "../lib/ESP32-A2DP/src/SoundData.h"
+#include "esp_system.h"
 
-typedef struct _DataSlot
+typedef enum
 {
-    OneChannel8BitSoundData *data;
-} DataSlot;
+    I2S_NUM_0 = 0,
+    I2S_NUM_1 = 1,
+} i2s_port_t;
@@ -0,0 +1,98 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "esp_bt_defs.h"
+
+typedef enum
+{
+    ESP_A2D_CONNECTION_STATE_DISCONNECTED = 0,
+    ESP_A2D_CONNECTION_STATE_CONNECTING,
+    ESP_A2D_CONNECTION_STATE_CONNECTED,
+    ESP_A2D_CONNECTION_STATE_DISCONNECTING,
+} esp_a2d_connection_state_t;
+
+typedef enum
+{
+    ESP_A2D_AUDIO_STATE_REMOTE_SUSPEND = 0,
+    ESP_A2D_AUDIO_STATE_STOPPED,
+    ESP_A2D_AUDIO_STATE_STARTED,
+} esp_a2d_audio_state_t;
+
+typedef enum
+{
+    ESP_A2D_MEDIA_CTRL_NONE = 0,
+    ESP_A2D_MEDIA_CTRL_CHECK_SRC_RDY,
+    ESP_A2D_MEDIA_CTRL_START,
+    ESP_A2D_MEDIA_CTRL_STOP,
+    ESP_A2D_MEDIA_CTRL_SUSPEND,
+} esp_a2d_media_ctrl_t;
+
+typedef enum
+{
+    ESP_A2D_MEDIA_CTRL_ACK_SUCCESS = 0,
+    ESP_A2D_MEDIA_CTRL_ACK_FAILURE,
+    ESP_A2D_MEDIA_CTRL_ACK_BUSY,
+} esp_a2d_media_ctrl_ack_t;
+
+typedef enum
+{
+    ESP_A2D_CONNECTION_STATE_EVT = 0,
+    ESP_A2D_AUDIO_STATE_EVT,
+    ESP_A2D_AUDIO_CFG_EVT,
+    ESP_A2D_MEDIA_CTRL_ACK_EVT,
+} esp_a2d_cb_event_t;
+
+typedef union
+{
+    struct
+    {
+        esp_a2d_connection_state_t state;
+        esp_bd_addr_t remote_bda;
+        int disc_rsn;
+    } conn_stat;
+    struct
+    {
+        esp_a2d_audio_state_t state;
+        esp_bd_addr_t remote_bda;
+    } audio_stat;
+    struct
+    {
+        esp_bd_addr_t remote_bda;
+        uint8_t mcc[8];
+    } audio_cfg;
+    struct
+    {
+        esp_a2d_media_ctrl_t cmd;
+        esp_a2d_media_ctrl_ack_t status;
+    } media_ctrl_stat;
+} esp_a2d_cb_param_t;
+
+typedef void (*esp_a2d_cb_t)(esp_a2d_cb_event_t event, esp_a2d_cb_param_t *param);
+typedef int32_t (*esp_a2d_source_data_cb_t)(uint8_t *buf, int32_t len);
+
+esp_err_t esp_a2d_register_callback(esp_a2d_cb_t callback);
+esp_err_t esp_a2d_source_register_data_callback(esp_a2d_source_data_cb_t callback);
+esp_err_t esp_a2d_source_init(void);
+esp_err_t esp_a2d_source_deinit(void);
+esp_err_t esp_a2d_source_connect(esp_bd_addr_t remote_bda);
+esp_err_t esp_a2d_source_disconnect(esp_bd_addr_t remote_bda);
+esp_err_t esp_a2d_sink_connect(esp_bd_addr_t remote_bda);
+esp_err_t esp_a2d_sink_disconnect(esp_bd_addr_t remote_bda);
+esp_err_t esp_a2d_media_ctrl(esp_a2d_media_ctrl_t ctrl);
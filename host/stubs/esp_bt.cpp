@@ -0,0 +1,156 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <Arduino.h>
+#include "esp_bt.h"
+#include "esp_bt_main.h"
+#include "esp_bt_device.h"
+#include "esp_gap_bt_api.h"
+#include "esp_a2dp_api.h"
+#include "esp_avrc_api.h"
+#include "esp32-hal-bt.h"
+#include "nvs_flash.h"
+
+// The Bluetooth stack is not simulated: the calls succeed and nothing calls back.
+// A test plays the stack by calling the library's ccall_* callbacks itself.
+
+static esp_bt_controller_status_t controllerStatus = ESP_BT_CONTROLLER_STATUS_IDLE;
+
+bool btStart(void)
+{
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_ENABLED;
+    return true;
+}
+
+bool btStop(void)
+{
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_IDLE;
+    return true;
+}
+
+bool btStarted(void)
+{
+    return controllerStatus == ESP_BT_CONTROLLER_STATUS_ENABLED;
+}
+
+esp_err_t esp_bt_controller_init(esp_bt_controller_config_t *cfg)
+{
+    (void)cfg;
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_INITED;
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_deinit(void)
+{
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_IDLE;
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_enable(esp_bt_mode_t mode)
+{
+    (void)mode;
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_ENABLED;
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_disable(void)
+{
+    controllerStatus = ESP_BT_CONTROLLER_STATUS_INITED;
+    return ESP_OK;
+}
+
+esp_err_t esp_bt_controller_mem_release(esp_bt_mode_t mode)
+{
+    (void)mode;
+    return ESP_OK;
+}
+
+esp_bt_controller_status_t esp_bt_controller_get_status(void)
+{
+    return controllerStatus;
+}
+
+esp_err_t esp_bluedroid_init(void) { return ESP_OK; }
+esp_err_t esp_bluedroid_deinit(void) { return ESP_OK; }
+esp_err_t esp_bluedroid_enable(void) { return ESP_OK; }
+esp_err_t esp_bluedroid_disable(void) { return ESP_OK; }
+esp_err_t esp_bt_dev_set_device_name(const char *name) { return (name == nullptr) ? ESP_ERR_INVALID_ARG : ESP_OK; }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+esp_err_t esp_bt_gap_register_callback(esp_bt_gap_cb_t callback) { return (callback == nullptr) ? ESP_ERR_INVALID_ARG : ESP_OK; }
+esp_err_t esp_bt_gap_set_scan_mode(esp_bt_connection_mode_t c_mode, esp_bt_discovery_mode_t d_mode) { return ESP_OK; }
+esp_err_t esp_bt_gap_start_discovery(esp_bt_inq_mode_t mode, uint8_t inq_len, uint8_t num_rsps) { return ESP_OK; }
+esp_err_t esp_bt_gap_cancel_discovery(void) { return ESP_OK; }
+uint8_t *esp_bt_gap_resolve_eir_data(uint8_t *eir, esp_bt_eir_type_t type, uint8_t *length) { return nullptr; }
+uint32_t esp_bt_gap_get_cod_major_dev(uint32_t cod) { return (cod >> 8) & 0x1f; }
+esp_err_t esp_bt_gap_remove_bond_device(esp_bd_addr_t bd_addr) { return ESP_OK; }
+esp_err_t esp_bt_gap_set_security_param(esp_bt_sp_param_t param_type, void *value, uint8_t len) { return ESP_OK; }
+esp_err_t esp_bt_gap_ssp_confirm_reply(esp_bd_addr_t bd_addr, bool accept) { return ESP_OK; }
+esp_err_t esp_bt_gap_set_pin(esp_bt_pin_type_t pin_type, uint8_t pin_code_len, esp_bt_pin_code_t pin_code) { return ESP_OK; }
+esp_err_t esp_bt_gap_pin_reply(esp_bd_addr_t bd_addr, bool accept, uint8_t pin_code_len, esp_bt_pin_code_t pin_code) { return ESP_OK; }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+esp_err_t esp_a2d_register_callback(esp_a2d_cb_t callback) { return (callback == nullptr) ? ESP_ERR_INVALID_ARG : ESP_OK; }
+esp_err_t esp_a2d_source_register_data_callback(esp_a2d_source_data_cb_t callback) { return (callback == nullptr) ? ESP_ERR_INVALID_ARG : ESP_OK; }
+esp_err_t esp_a2d_source_init(void) { return ESP_OK; }
+esp_err_t esp_a2d_source_deinit(void) { return ESP_OK; }
+esp_err_t esp_a2d_source_connect(esp_bd_addr_t remote_bda) { return ESP_OK; }
+esp_err_t esp_a2d_source_disconnect(esp_bd_addr_t remote_bda) { return ESP_OK; }
+esp_err_t esp_a2d_sink_connect(esp_bd_addr_t remote_bda) { return ESP_OK; }
+esp_err_t esp_a2d_sink_disconnect(esp_bd_addr_t remote_bda) { return ESP_OK; }
+esp_err_t esp_a2d_media_ctrl(esp_a2d_media_ctrl_t ctrl) { return ESP_OK; }
+
+////////////////////////////////////////////////////////////////////////////////////////////
+esp_err_t esp_avrc_ct_init(void) { return ESP_OK; }
+esp_err_t esp_avrc_ct_deinit(void) { return ESP_OK; }
+esp_err_t esp_avrc_ct_register_callback(esp_avrc_ct_cb_t callback) { return (callback == nullptr) ? ESP_ERR_INVALID_ARG : ESP_OK; }
+esp_err_t esp_avrc_ct_send_get_rn_capabilities_cmd(uint8_t tl) { return ESP_OK; }
+esp_err_t esp_avrc_ct_send_register_notification_cmd(uint8_t tl, uint8_t event_id, uint32_t event_parameter) { return ESP_OK; }
+esp_err_t esp_avrc_ct_send_set_absolute_volume_cmd(uint8_t tl, uint8_t volume) { return ESP_OK; }
+esp_err_t esp_avrc_tg_set_rn_evt_cap(const esp_avrc_rn_evt_cap_mask_t *evt_set) { return ESP_OK; }
+
+bool esp_avrc_rn_evt_bit_mask_operation(esp_avrc_bit_mask_op_t op, esp_avrc_rn_evt_cap_mask_t *events, esp_avrc_rn_event_ids_t event_id)
+{
+    uint16_t bit = (uint16_t)(1 << event_id);
+    switch (op)
+    {
+    case ESP_AVRC_BIT_MASK_OP_SET:
+        events->bits |= bit;
+        return true;
+    case ESP_AVRC_BIT_MASK_OP_CLEAR:
+        events->bits &= ~bit;
+        return true;
+    default:
+        return (events->bits & bit) != 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// the last connection is never stored: the source starts with discovery
+esp_err_t nvs_flash_init(void) { return ESP_OK; }
+esp_err_t nvs_flash_erase(void) { return ESP_OK; }
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    *out_handle = 1;
+    return ESP_OK;
+}
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length) { return ESP_ERR_NVS_NOT_FOUND; }
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) { return ESP_OK; }
+esp_err_t nvs_commit(nvs_handle_t handle) { return ESP_OK; }
+void nvs_close(nvs_handle_t handle) {}
@@ -0,0 +1,140 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "HostStubs.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const size_t MAX_PARTITIONS = 4;
+static const size_t MAX_MAPS = 8;
+
+typedef struct _HostPartition
+{
+    esp_partition_t partition;
+    int fd;
+} HostPartition;
+
+typedef struct _HostMap
+{
+    void *ptr;
+    size_t size;
+} HostMap;
+
+static HostPartition partitions[MAX_PARTITIONS];
+static size_t partitionCount = 0;
+static HostMap maps[MAX_MAPS]; // handle - 1 indexes the map
+
+bool hostMapPartition(const char *label, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return false;
+    }
+
+    // a label registered again gets the new file, as if the partition was reflashed
+    size_t index = 0;
+    while (index < partitionCount && strcmp(partitions[index].partition.label, label) != 0)
+    {
+        index++;
+    }
+    if (index == partitionCount)
+    {
+        configASSERT(partitionCount < MAX_PARTITIONS);
+        partitionCount++;
+    }
+    else
+    {
+        close(partitions[index].fd);
+    }
+
+    HostPartition &host = partitions[index];
+    memset(&host, 0, sizeof(host));
+    host.partition.type = ESP_PARTITION_TYPE_DATA;
+    host.partition.subtype = ESP_PARTITION_SUBTYPE_ANY;
+    host.partition.address = 0x200000 + (uint32_t)index * 0x100000;
+    host.partition.size = (uint32_t)st.st_size;
+    strncpy(host.partition.label, label, sizeof(host.partition.label) - 1);
+    host.fd = fd;
+    return true;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label)
+{
+    (void)subtype;
+    for (size_t i = 0; i < partitionCount; i++)
+    {
+        const esp_partition_t &partition = partitions[i].partition;
+        if (partition.type == type && (label == nullptr || strcmp(partition.label, label) == 0))
+        {
+            return &partition;
+        }
+    }
+    return nullptr;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size, spi_flash_mmap_memory_t memory,
+                             const void **out_ptr, spi_flash_mmap_handle_t *out_handle)
+{
+    (void)memory;
+    if (partition == nullptr || offset + size > partition->size || size == 0)
+    {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const HostPartition *host = (const HostPartition *)partition;
+
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t base = offset - offset % page;
+    for (size_t i = 0; i < MAX_MAPS; i++)
+    {
+        if (maps[i].ptr == nullptr)
+        {
+            void *ptr = mmap(nullptr, size + offset - base, PROT_READ, MAP_PRIVATE, host->fd, (off_t)base);
+            if (ptr == MAP_FAILED)
+            {
+                return ESP_FAIL;
+            }
+            maps[i].ptr = ptr;
+            maps[i].size = size + offset - base;
+            *out_ptr = (const uint8_t *)ptr + (offset - base);
+            *out_handle = (spi_flash_mmap_handle_t)(i + 1);
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle)
+{
+    if (handle == 0 || handle > MAX_MAPS || maps[handle - 1].ptr == nullptr)
+    {
+        return;
+    }
+    munmap(maps[handle - 1].ptr, maps[handle - 1].size);
+    maps[handle - 1].ptr = nullptr;
+}
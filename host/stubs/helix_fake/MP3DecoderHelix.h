@@ -0,0 +1,121 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// FAKE MP3 DECODER, a test double of MP3DecoderHelix from arduino-libhelix
+// (https://github.com/pschatzmann/arduino-libhelix) for the host build without
+// HELIX_DIR, see ../../CMakeLists.txt. It does not decode MPEG audio: its
+// "stream" is a sequence of frames made by fakeMp3Frame(), each holding plain
+// 16-bit PCM, handed to the callback as the real decoder hands a decoded frame.
+// Time measured through it is the time of Mp3Cache alone.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// the fields of the libhelix MP3FrameInfo
+typedef struct _MP3FrameInfo
+{
+    int bitrate;
+    int nChans;
+    int samprate;
+    int bitsPerSample;
+    int outputSamps;
+    int layer;
+    int version;
+} MP3FrameInfo;
+
+namespace libhelix
+{
+    typedef void (*MP3DataCallback)(MP3FrameInfo &info, short *pcm, size_t len, void *ref);
+
+    // frame: "FMP3", channels, 0, samples per channel (uint16), rate (uint32), interleaved int16 samples
+    static const size_t FAKE_MP3_HEADER_SIZE = 12;
+
+    // appends a fake frame of samples interleaved values (all channels) to stream
+    inline void fakeMp3Frame(std::vector<uint8_t> &stream, const int16_t *pcm, uint16_t samples, uint8_t channels, uint32_t rate)
+    {
+        uint16_t perChannel = samples / channels;
+        const uint8_t header[FAKE_MP3_HEADER_SIZE] = {'F', 'M', 'P', '3', channels, 0, (uint8_t)perChannel, (uint8_t)(perChannel >> 8),
+                                                      (uint8_t)rate, (uint8_t)(rate >> 8), (uint8_t)(rate >> 16), (uint8_t)(rate >> 24)};
+        stream.insert(stream.end(), header, header + FAKE_MP3_HEADER_SIZE);
+        stream.insert(stream.end(), (const uint8_t *)pcm, (const uint8_t *)(pcm + perChannel * channels));
+    }
+
+    class MP3DecoderHelix
+    {
+    public:
+        MP3DecoderHelix(MP3DataCallback callback) : _callback(callback), _ref(nullptr) {}
+
+        void begin(void)
+        {
+            _input.clear();
+        }
+
+        void end(void)
+        {
+            _input.clear();
+            _input.shrink_to_fit();
+        }
+
+        void setReference(void *ref)
+        {
+            _ref = ref;
+        }
+
+        // buffers the input, decodes every complete frame; bytes out of sync are skipped
+        size_t write(const void *data, size_t len)
+        {
+            _input.insert(_input.end(), (const uint8_t *)data, (const uint8_t *)data + len);
+            size_t pos = 0;
+            while (_input.size() - pos >= FAKE_MP3_HEADER_SIZE)
+            {
+                const uint8_t *header = _input.data() + pos;
+                if (memcmp(header, "FMP3", 4) != 0 || header[4] < 1)
+                {
+                    pos++;
+                    continue;
+                }
+                MP3FrameInfo info = {};
+                info.nChans = header[4];
+                info.outputSamps = (header[6] | header[7] << 8) * info.nChans;
+                info.samprate = (int)(header[8] | header[9] << 8 | header[10] << 16 | (uint32_t)header[11] << 24);
+                info.bitsPerSample = 16;
+                info.layer = 3;
+                size_t frameSize = FAKE_MP3_HEADER_SIZE + info.outputSamps * sizeof(short);
+                if (_input.size() - pos < frameSize)
+                {
+                    break;
+                }
+                _pcm.resize(info.outputSamps);
+                memcpy(_pcm.data(), header + FAKE_MP3_HEADER_SIZE, info.outputSamps * sizeof(short));
+                _callback(info, _pcm.data(), _pcm.size(), _ref);
+                pos += frameSize;
+            }
+            _input.erase(_input.begin(), _input.begin() + pos);
+            return len;
+        }
+
+    private:
+        MP3DataCallback _callback;
+        void *_ref;
+        std::vector<uint8_t> _input;
+        std::vector<short> _pcm;
+    };
+}
@@ -0,0 +1,149 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of BluetoothA2DPSource::get_data_default() and the status register
+// which reports its underrun counter over I2C
+#include "HostTest.h"
+#include "HostA2dpSource.h"
+#include "data/SoundBuffer.h"
+#include "peripheral/i2c/I2cA2dp.h"
+#include "peripheral/i2c/I2cCommand.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include "peripheral/i2c/I2cStatus.h"
+#include <new>
+#include <vector>
+
+// requests count packets, returns the underruns counted meanwhile
+static uint32_t pull(uint32_t count, std::vector<int16_t> *pcm = nullptr)
+{
+    uint32_t underruns = hostA2dpSource().get_underrun_count();
+    uint8_t packet[A2DP_PACKET_SIZE];
+    for (uint32_t n = 0; n < count; n++)
+    {
+        int32_t len = ccall_bt_app_a2d_data_cb(packet, A2DP_PACKET_SIZE);
+        CHECK(len == A2DP_PACKET_SIZE);
+        const Frame *frames = (const Frame *)packet;
+        for (int32_t i = 0; pcm && i < len / (int32_t)sizeof(Frame); i++)
+        {
+            pcm->push_back(frames[i].channel1);
+        }
+    }
+    return hostA2dpSource().get_underrun_count() - underruns;
+}
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+// PlaySound repeats every 0.5s: the end of a cycle is not an underrun
+HOST_TEST(underrun_playsound_cycles)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    soundBuffer->updateSoundSignal(0x23, 0);
+    hostA2dpSource().write_data(soundBuffer);
+
+    uint32_t packets = 4 * SoundBuffer::SAMPLING_RATE / 2 * sizeof(Frame) / A2DP_PACKET_SIZE;
+    CHECK(pull(packets) == 0);
+    CHECK(soundBuffer->streamFrame() == packets * A2DP_PACKET_SIZE / sizeof(Frame));
+
+    soundBuffer->~SoundBuffer();
+}
+
+// looped data shorter than a packet restarts within the packet
+HOST_TEST(underrun_looped_data)
+{
+    static int16_t samples[1000];
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++)
+    {
+        samples[i] = (int16_t)i;
+    }
+    OneChannelSoundData soundData(samples, sizeof(samples) / sizeof(samples[0]), true);
+    hostA2dpSource().write_data(&soundData);
+    A2DPNoVolumeControl noVolumeControl; // the PCM as is, whatever volume a test set before
+    hostA2dpSource().set_volume_control(&noVolumeControl);
+
+    std::vector<int16_t> pcm;
+    CHECK(pull(40, &pcm) == 0); // about 10 loops
+    for (size_t i = 0; i < pcm.size(); i++)
+    {
+        CHECK(pcm[i] == (int16_t)(i % 1000));
+    }
+    hostA2dpSource().set_volume_control(nullptr);
+}
+
+// data which is not looped underruns once, with its last partial packet
+HOST_TEST(underrun_end_of_data)
+{
+    static int16_t samples[1000] = {1};
+    OneChannelSoundData soundData(samples, sizeof(samples) / sizeof(samples[0]), false);
+    hostA2dpSource().write_data(&soundData);
+
+    uint32_t underruns = hostA2dpSource().get_underrun_count();
+    uint8_t packet[A2DP_PACKET_SIZE];
+    int32_t total = 0;
+    for (int n = 0; n < 12; n++)
+    {
+        total += ccall_bt_app_a2d_data_cb(packet, A2DP_PACKET_SIZE);
+    }
+    CHECK(hostA2dpSource().get_underrun_count() - underruns == 1);
+    CHECK(total == 1000 * (int32_t)sizeof(Frame) + 4 * A2DP_PACKET_SIZE); // silence after the end
+    CHECK(!hostA2dpSource().has_sound_data());
+}
+
+// the master reads the counters in one ReadStatus transaction
+HOST_TEST(status_register_over_wire)
+{
+    I2cA2dp i2cA2dp(nullptr, 0);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+
+    I2cStatus::StatusRegister before;
+    I2cStatus::read(before);
+
+    // a PlaySound which cannot be posted without a thread, an unknown command and a valid one
+    const uint8_t playSound[] = {I2cCommand::PlaySound, 50, 0x23, 0};
+    const uint8_t unknown[] = {0xee};
+    const uint8_t isConnected[] = {I2cCommand::IsA2dpConnected, 0};
+    uint8_t reply = 0;
+    Wire.masterWrite(playSound, sizeof(playSound));
+    CHECK(Wire.masterRead(&reply, 1) == 1 && reply == I2cResponse::Fail);
+    Wire.masterWrite(unknown, sizeof(unknown));
+    CHECK(Wire.masterRead(&reply, 1) == 1 && reply == I2cResponse::ErrorInvalidCommand);
+    Wire.masterWrite(isConnected, sizeof(isConnected));
+    CHECK(Wire.masterRead(&reply, 1) == 1 && reply == I2cResponse::A2dpConnected);
+
+    I2cStatus::setConnectionState(2);
+    I2cStatus::setCounters(3, 0x12345678);
+
+    const uint8_t readStatus[] = {I2cCommand::ReadStatus};
+    I2cStatus::StatusRegister status;
+    Wire.masterWrite(readStatus, sizeof(readStatus));
+    CHECK(Wire.masterRead((uint8_t *)&status, sizeof(status)) == I2cStatus::size());
+    CHECK(status.version == I2cStatus::VERSION);
+    CHECK(status.connectionState == 2);
+    CHECK(status.queueDepth == 3);
+    CHECK(status.underrunCount == 0x12345678);
+    CHECK(status.frameCount - before.frameCount == 4); // ReadStatus included
+    CHECK(status.errorCount - before.errorCount == 2);
+    CHECK(status.dropCount - before.dropCount == 1);
+    CHECK((uint16_t)(status.updateCount - before.updateCount) == 7);
+
+    // the reply is consumed: a second read without command gets Fail
+    CHECK(Wire.masterRead(&reply, 1) == 1 && reply == I2cResponse::Fail);
+    Wire.end();
+}
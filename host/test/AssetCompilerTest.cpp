@@ -0,0 +1,282 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of tools/asset_compiler.py: the bundle compiled from known sources
+// against the layout of CueBundleDef.h and the source arrays, then against
+// CueStore, which must map it and must refuse it once its index is corrupted.
+#include "HostTest.h"
+#include "HostStubs.h"
+#include "data/CueStore.h"
+#include "data/CueBundle.h"
+#include "data/beep-mono-i8.h"
+#include "data/bell-mono-i8.h"
+#include "data/bright-mono-i8.h"
+#include "data/off-mono-i8.h"
+#include "data/saturday-mono-i8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+static const uint32_t FADE_LENGTH = 88; // asset_compiler.py FADE_LENGTH
+static const uint16_t SHORT_LENGTH = 1000;
+static const uint16_t LONG_LENGTH = 5000;
+
+typedef struct _Source
+{
+    uint8_t id;
+    const char *path; // from the repository
+    const void *samples;
+    uint32_t length;
+} Source;
+
+// the cues of src/data/CueBundle.h, in the order of its command line
+static const Source sources[] = {
+    {1, "src/data/off-mono-i8.h", off_mono_i8_raw, off_mono_i8_raw_len},
+    {2, "src/data/bright-mono-i8.h", bright_mono_i8_raw, bright_mono_i8_raw_len},
+    {3, "src/data/beep-mono-i8.h", beep_mono_i8_raw, beep_mono_i8_raw_len},
+    {4, "src/data/bell-mono-i8.h", bell_mono_i8_raw, bell_mono_i8_raw_len},
+    {5, "src/data/saturday-mono-i8.h", saturday_mono_i8_raw, saturday_mono_i8_raw_len},
+};
+static const size_t SOURCE_COUNT = sizeof(sources) / sizeof(sources[0]);
+
+static std::string tempPath(const char *name)
+{
+    return std::string("/tmp/asset_compiler_") + std::to_string(getpid()) + "_" + name;
+}
+
+static bool writeFile(const std::string &path, const void *data, size_t size)
+{
+    FILE *file = fopen(path.c_str(), "wb");
+    bool result = file && fwrite(data, 1, size, file) == size;
+    if (file)
+    {
+        fclose(file);
+    }
+    return result;
+}
+
+static std::vector<uint8_t> readFile(const std::string &path)
+{
+    std::vector<uint8_t> data;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file)
+    {
+        uint8_t buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            data.insert(data.end(), buffer, buffer + n);
+        }
+        fclose(file);
+    }
+    return data;
+}
+
+// runs the compiler with cues (ID=PATH ...), returns the bundle written, empty on failure
+static std::vector<uint8_t> compile(const std::string &cues)
+{
+    std::string bin = tempPath("cues.bin");
+    std::string command = std::string(HOST_PYTHON " " HOST_REPO_DIR "/tools/asset_compiler.py --bin ") + bin + " " + cues + " > /dev/null";
+    std::vector<uint8_t> bundle;
+    if (system(command.c_str()) == 0)
+    {
+        bundle = readFile(bin);
+    }
+    remove(bin.c_str());
+    return bundle;
+}
+
+// the source cues, then a short and a long raw cue which the compiler pads and fades to one slot
+static std::vector<uint8_t> compileSources(std::vector<int8_t> &shortCue, std::vector<int8_t> &longCue)
+{
+    shortCue.resize(SHORT_LENGTH);
+    longCue.resize(LONG_LENGTH);
+    for (uint16_t i = 0; i < LONG_LENGTH; i++)
+    {
+        if (i < SHORT_LENGTH)
+        {
+            shortCue[i] = (int8_t)(i * 3);
+        }
+        longCue[i] = (int8_t)(100 - i % 200);
+    }
+    std::string shortPath = tempPath("short.raw");
+    std::string longPath = tempPath("long.raw");
+    CHECK(writeFile(shortPath, shortCue.data(), shortCue.size()));
+    CHECK(writeFile(longPath, longCue.data(), longCue.size()));
+
+    std::string cues;
+    for (size_t i = 0; i < SOURCE_COUNT; i++)
+    {
+        cues += std::to_string(sources[i].id) + "=" HOST_REPO_DIR "/" + sources[i].path + " ";
+    }
+    cues += "6=" + shortPath + " 7=" + longPath;
+    std::vector<uint8_t> bundle = compile(cues);
+    remove(shortPath.c_str());
+    remove(longPath.c_str());
+    return bundle;
+}
+
+// maps bundle as the "cues" partition, returns true if CueStore took it instead of the linked bundle
+static bool mapCues(const std::vector<uint8_t> &bundle)
+{
+    std::string path = tempPath("partition.bin");
+    CueStore::end();
+    bool isMapped = writeFile(path, bundle.data(), bundle.size()) && hostMapPartition("cues", path.c_str()) && CueStore::begin() && CueStore::isMapped();
+    remove(path.c_str()); // the stub keeps the file open
+    return isMapped;
+}
+
+// header, alignment, offsets and samples of the compiled bundle against its sources
+HOST_TEST(asset_compiler_bundle_layout)
+{
+    std::vector<int8_t> shortCue, longCue;
+    std::vector<uint8_t> bundle = compileSources(shortCue, longCue);
+    CHECK(bundle.size() > sizeof(CueBundleHeader));
+    if (bundle.size() <= sizeof(CueBundleHeader))
+    {
+        return;
+    }
+
+    const CueBundleHeader *header = (const CueBundleHeader *)bundle.data();
+    CHECK(memcmp(header->magic, "CUEB", sizeof(header->magic)) == 0);
+    CHECK(header->version == CUE_BUNDLE_VERSION);
+    CHECK(header->count == SOURCE_COUNT + 2);
+    CHECK(bundle.size() % CUE_BUNDLE_ALIGN == 0);
+    if (header->count != SOURCE_COUNT + 2)
+    {
+        return;
+    }
+
+    // the samples follow the index at the next aligned offset, one cue after the other
+    const CueBundleEntry *entry = (const CueBundleEntry *)(bundle.data() + sizeof(CueBundleHeader));
+    uint32_t end = sizeof(CueBundleHeader) + header->count * sizeof(CueBundleEntry);
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        uint32_t aligned = (end + CUE_BUNDLE_ALIGN - 1) / CUE_BUNDLE_ALIGN * CUE_BUNDLE_ALIGN;
+        CHECK(entry[i].id == i + 1);
+        CHECK(entry[i].format == CueFormatS8);
+        CHECK(entry[i].reserved == 0);
+        CHECK(entry[i].rate == CUE_SAMPLE_RATE);
+        CHECK(entry[i].offset % CUE_BUNDLE_ALIGN == 0);
+        CHECK(entry[i].offset == aligned);
+        CHECK(entry[i].length == CUE_SLOT_SAMPLES);
+        CHECK(cueFitsSlot(entry[i]));
+        CHECK(entry[i].offset + entry[i].length <= bundle.size());
+        end = entry[i].offset + entry[i].length;
+    }
+    CHECK(bundle.size() == (end + CUE_BUNDLE_ALIGN - 1) / CUE_BUNDLE_ALIGN * CUE_BUNDLE_ALIGN);
+
+    // the source arrays fill one slot and are stored as they are
+    for (size_t i = 0; i < SOURCE_COUNT; i++)
+    {
+        CHECK(sources[i].length == CUE_SLOT_SAMPLES);
+        CHECK(memcmp(bundle.data() + entry[i].offset, sources[i].samples, CUE_SLOT_SAMPLES) == 0);
+    }
+
+    // a short cue is padded with silence, a long one cut to the slot with a fade out
+    const int8_t *padded = (const int8_t *)bundle.data() + entry[SOURCE_COUNT].offset;
+    const int8_t *faded = (const int8_t *)bundle.data() + entry[SOURCE_COUNT + 1].offset;
+    for (uint32_t i = 0; i < CUE_SLOT_SAMPLES; i++)
+    {
+        CHECK(padded[i] == (i < SHORT_LENGTH ? shortCue[i] : 0));
+        uint32_t fade = CUE_SLOT_SAMPLES - 1 - i; // gain fade / FADE_LENGTH over the last samples
+        CHECK(faded[i] == (fade < FADE_LENGTH ? (int8_t)(longCue[i] * (int32_t)fade / (int32_t)FADE_LENGTH) : longCue[i]));
+    }
+
+    // the linked bundle is the output of the command line of CueBundle.h
+    std::string cues;
+    for (size_t i = 0; i < SOURCE_COUNT; i++)
+    {
+        cues += std::to_string(sources[i].id) + "=" HOST_REPO_DIR "/" + sources[i].path + " ";
+    }
+    std::vector<uint8_t> linked = compile(cues);
+    CHECK(linked.size() == cueBundleSize && memcmp(linked.data(), cueBundleData, cueBundleSize) == 0);
+
+    // CueStore::isValid() accepts the bundle and finds every cue in the mapping
+    CHECK(mapCues(bundle));
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        const CueBundleEntry *found = CueStore::find(entry[i].id);
+        CHECK(found && found->offset == entry[i].offset && found->length == entry[i].length);
+        CHECK(found && memcmp(CueStore::samples(*found), bundle.data() + entry[i].offset, entry[i].length) == 0);
+    }
+    CueStore::end();
+}
+
+// a corrupted bundle in the partition is refused, the linked bundle plays instead
+HOST_TEST(asset_compiler_corrupted_index_rejected)
+{
+    std::vector<int8_t> shortCue, longCue;
+    std::vector<uint8_t> bundle = compileSources(shortCue, longCue);
+    CHECK(bundle.size() > sizeof(CueBundleHeader) + 2 * sizeof(CueBundleEntry));
+    if (bundle.size() <= sizeof(CueBundleHeader) + 2 * sizeof(CueBundleEntry))
+    {
+        return;
+    }
+    CHECK(mapCues(bundle));
+
+    enum Corruption
+    {
+        BadMagic,
+        BadVersion,
+        IndexPastEnd,
+        OffsetNotAligned,
+        OffsetInIndex,
+        OffsetPastEnd,
+        LengthPastEnd,
+        CorruptionCount,
+    };
+    for (int corruption = 0; corruption < CorruptionCount; corruption++)
+    {
+        std::vector<uint8_t> corrupted = bundle;
+        CueBundleHeader *header = (CueBundleHeader *)corrupted.data();
+        CueBundleEntry *entry = (CueBundleEntry *)(corrupted.data() + sizeof(CueBundleHeader));
+        switch (corruption)
+        {
+        case BadMagic:
+            header->magic[3] = 'X';
+            break;
+        case BadVersion:
+            header->version = CUE_BUNDLE_VERSION + 1;
+            break;
+        case IndexPastEnd:
+            header->count = (uint16_t)(corrupted.size() / sizeof(CueBundleEntry));
+            break;
+        case OffsetNotAligned:
+            entry[1].offset += 1;
+            break;
+        case OffsetInIndex:
+            entry[1].offset = sizeof(CueBundleHeader);
+            break;
+        case OffsetPastEnd:
+            entry[1].offset = (uint32_t)corrupted.size() + CUE_BUNDLE_ALIGN;
+            break;
+        case LengthPastEnd:
+            entry[1].length = (uint32_t)corrupted.size() - entry[1].offset + 1;
+            break;
+        }
+        CHECK(!mapCues(corrupted));
+        const CueBundleEntry *found = CueStore::find(1);
+        CHECK(found && found->offset == cueBundleIndex[0].offset); // the bundle of 5 cues, not ours of 7
+        CHECK(found && memcmp(CueStore::samples(*found), cueBundleData + cueBundleIndex[0].offset, cueBundleIndex[0].length) == 0);
+    }
+    CueStore::end();
+}
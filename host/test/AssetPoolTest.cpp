@@ -0,0 +1,144 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of the asset upload: slab reuse against the audio callback and the
+// upload throughput through the stub Wire
+#include "HostTest.h"
+#include "I2cMaster.h"
+#include "data/AssetPool.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <chrono>
+
+static const uint32_t I2C_CLOCK = 400000; // fast mode, the clock is set by the master
+
+// uploads count samples as asset id through Wire, returns the bytes written on the bus
+static size_t upload(uint8_t id, const int8_t *samples, uint16_t count, bool isCommitted = true)
+{
+    size_t bytes = 0;
+    I2cFrame frame = I2cMaster::assetBegin(id, AssetPool::SAMPLE_RATE, count);
+    bytes += frame.size();
+    CHECK(I2cMaster::transfer(frame) == I2cResponse::Success);
+    for (uint16_t offset = 0; offset < count; offset += I2cCommand::MAX_ASSET_CHUNK)
+    {
+        frame = I2cMaster::assetChunk(id, offset, samples + offset, std::min<size_t>(I2cCommand::MAX_ASSET_CHUNK, count - offset));
+        bytes += frame.size();
+        CHECK(I2cMaster::transfer(frame) == I2cResponse::Success);
+    }
+    if (isCommitted)
+    {
+        frame = I2cMaster::assetCommit(id, samples, count);
+        bytes += frame.size();
+        CHECK(I2cMaster::transfer(frame) == I2cResponse::Success);
+    }
+    return bytes;
+}
+
+static int8_t clip[2][AssetPool::SLAB_SIZE];
+
+static void fillClips(void)
+{
+    for (uint16_t i = 0; i < AssetPool::SLAB_SIZE; i++)
+    {
+        clip[0][i] = (int8_t)(i * 7);
+        clip[1][i] = (int8_t)(-i * 3);
+    }
+}
+
+static bool isPlaying(uint8_t id, const int8_t *samples)
+{
+    OneChannel8BitSoundData *soundData = AssetPool::soundData(id);
+    for (uint16_t i = 0; i < AssetPool::SLAB_SIZE; i++)
+    {
+        Frame frame;
+        soundData->getData(i, frame);
+        if (frame.channel1 != SampleS8::toLevel(samples[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// a slab replaced while the audio callback renders a block is not reused before the block is done
+HOST_TEST(asset_slab_released_after_block)
+{
+    I2cA2dp i2cA2dp(nullptr, 0);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    fillClips();
+
+    const uint8_t id = 0;
+    upload(id, clip[0], AssetPool::SLAB_SIZE);
+    CHECK(isPlaying(id, clip[0]));
+    uint8_t available = AssetPool::available();
+
+    // committed while no block is rendered: the old slab is free at once
+    upload(id, clip[1], AssetPool::SLAB_SIZE);
+    CHECK(AssetPool::available() == available);
+
+    upload(1, clip[1], AssetPool::SLAB_SIZE);
+    available = AssetPool::available();
+
+    // committed while a block is rendered: the old slab is kept until the block is done
+    AssetPool::enterRender();
+    upload(id, clip[0], AssetPool::SLAB_SIZE);
+    CHECK(AssetPool::available() == available - 1);
+    CHECK(isPlaying(id, clip[0]));
+
+    // the other uploads in progress cannot get the slab the block may still read
+    for (uint8_t other = 1; other < AssetPool::MAX_ASSETS; other++)
+    {
+        upload(other, clip[1], AssetPool::SLAB_SIZE, false);
+    }
+    CHECK(AssetPool::available() == 0);
+    I2cFrame begin = I2cMaster::assetBegin(id, AssetPool::SAMPLE_RATE, AssetPool::SLAB_SIZE);
+    CHECK(I2cMaster::transfer(begin) == I2cResponse::ErrorInvalidParam);
+
+    // the next command after the block reclaims it
+    AssetPool::exitRender();
+    CHECK(I2cMaster::transfer(begin) == I2cResponse::Success);
+    CHECK(isPlaying(id, clip[0]));
+    Wire.end();
+}
+
+// full size assets uploaded over and over, commit included
+HOST_TEST(asset_upload_throughput)
+{
+    I2cA2dp i2cA2dp(nullptr, 0);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    fillClips();
+
+    const uint32_t COUNT = 200;
+    const uint8_t id = 1;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < COUNT; n++)
+    {
+        bytes += upload(id, clip[n % 2], AssetPool::SLAB_SIZE);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    CHECK(isPlaying(id, clip[(COUNT - 1) % 2]));
+
+    // an I2C byte is 9 clocks; each command adds the address bytes of its write and read and the reply byte
+    size_t frames = COUNT * (2 + (AssetPool::SLAB_SIZE + I2cCommand::MAX_ASSET_CHUNK - 1) / I2cCommand::MAX_ASSET_CHUNK);
+    double busSeconds = (bytes + 3.0 * frames) * 9 / I2C_CLOCK / COUNT;
+    Serial.printf("asset upload: %.0f bytes/s parsed, %u bytes per asset, %.1f ms per asset on a %u Hz bus\n",
+                  bytes / seconds, (unsigned)(bytes / COUNT), busSeconds * 1000, (unsigned)I2C_CLOCK);
+    CHECK(bytes / seconds > 10.0 * I2C_CLOCK / 9); // the parser is not the bottleneck
+    Wire.end();
+}
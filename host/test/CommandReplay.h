@@ -0,0 +1,169 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Replay of a CommandRecorder dump on the host: the records are applied to a
+// SoundBuffer as ThreadAudio applied them (PlayUrgent and SetTone as I2cA2dp
+// did), and the PCM is pulled through the data callback of the A2DP source like
+// the Bluetooth stack does, so that a field sequence renders bit-exact.
+//
+// A record of ThreadAudio carries the stream frame of the block which followed
+// it, it is applied before the block which starts at that frame. PlayUrgent and
+// SetTone carry SoundBuffer::streamFrameAt() of their receive time, within the
+// block rendered last: they are applied before the next block.
+// Assets uploaded over I2C are not recorded, neither are commands which were
+// overwritten in the ring (total > count): the replay starts from a fresh
+// SoundBuffer at stream frame 0.
+#include <Arduino.h>
+#include <vector>
+#include "HostA2dpSource.h"
+#include "data/SoundBuffer.h"
+#include "data/ToneSoundData.h"
+#include "debug/CommandRecorder.h"
+#include "peripheral/i2c/I2cCommand.h"
+#include "../../AppEvent.h"
+
+class CommandReplay
+{
+public:
+    typedef CommandRecorder::CommandRecord CommandRecord;
+
+    // the records of the first dump of this VERSION in data, false if there is none
+    static bool parse(const uint8_t *data, size_t size, std::vector<CommandRecord> &records, uint32_t *total = nullptr)
+    {
+        CommandRecorder::CommandDumpHeader header;
+        for (size_t offset = 0; offset + sizeof(header) <= size; offset++)
+        {
+            memcpy(&header, data + offset, sizeof(header));
+            size_t end = offset + sizeof(header) + header.count * sizeof(CommandRecord);
+            if (header.magic[0] == 'C' && header.magic[1] == 'R' && header.version == CommandRecorder::VERSION &&
+                header.recordSize == sizeof(CommandRecord) && end <= size)
+            {
+                records.resize(header.count);
+                memcpy(records.data(), data + offset + sizeof(header), header.count * sizeof(CommandRecord));
+                if (total)
+                {
+                    *total = header.total;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the block which starts at blockFrame is the first one after the record
+    static bool isDue(const CommandRecord &record, uint32_t blockFrame)
+    {
+        bool isReceiveFrame = record.event == EventI2c && (record.command == I2cCommand::PlayUrgent || record.command == I2cCommand::SetTone);
+        return isReceiveFrame ? (int32_t)(blockFrame - record.streamFrame) > 0 : (int32_t)(blockFrame - record.streamFrame) >= 0;
+    }
+
+    static void apply(const CommandRecord &record, SoundBuffer &soundBuffer, BluetoothA2DPSource &source)
+    {
+        if (record.event != EventI2c)
+        {
+            return; // A2DP connection changes only gate the commands, which are recorded when applied
+        }
+        const uint8_t *param = record.param;
+        switch (record.command)
+        {
+        case I2cCommand::PlaySound:
+            source.set_volume(param[0]);
+            soundBuffer.updateSoundSignal(param[1], param[2]);
+            break;
+        case I2cCommand::PlayTimeline:
+        {
+            I2cParam::Timeline timeline = {};
+            memcpy(&timeline, param, std::min<size_t>(record.length, sizeof(timeline)));
+            soundBuffer.setTimeline(timeline);
+            break;
+        }
+        case I2cCommand::PlayAt:
+        {
+            uint32_t frame;
+            memcpy(&frame, param, sizeof(frame));
+            soundBuffer.scheduleCue(frame, param[4], param[5]);
+            break;
+        }
+        case I2cCommand::PlayUrgent:
+            SoundBuffer::requestUrgent(param[0], param[1], param[2]);
+            break;
+        case I2cCommand::SetTone:
+        {
+            I2cParam::ToneParam tone;
+            memcpy(&tone, param + 1, sizeof(tone));
+            ToneSoundData::set(param[0], tone);
+            break;
+        }
+        case I2cCommand::DefinePattern:
+        {
+            I2cParam::Pattern pattern = {};
+            memcpy(&pattern, param, std::min<size_t>(record.length, sizeof(pattern)));
+            soundBuffer.definePattern(pattern);
+            break;
+        }
+        case I2cCommand::PlayPattern:
+            soundBuffer.playPattern(param[0], param[1]);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // plays frames of soundBuffer through the A2DP source in packets of packetSize
+    // bytes with the records applied, returns the FNV-1a hash of the PCM which
+    // is also written to pcm
+    static uint32_t render(const std::vector<CommandRecord> &records, SoundBuffer &soundBuffer, uint32_t frames,
+                           int32_t packetSize = A2DP_PACKET_SIZE, Print *pcm = nullptr)
+    {
+        BluetoothA2DPSource &source = hostA2dpSource();
+        source.write_data(&soundBuffer);
+
+        std::vector<uint8_t> packet(packetSize);
+        uint32_t hash = FNV_OFFSET_BASIS;
+        size_t next = 0;
+        uint32_t frame = 0;
+        while (frame < frames)
+        {
+            while (next < records.size() && isDue(records[next], soundBuffer.streamFrame()))
+            {
+                apply(records[next++], soundBuffer, source);
+            }
+            int32_t len = ccall_bt_app_a2d_data_cb(packet.data(), packetSize);
+            hash = fnv1a(hash, packet.data(), len);
+            if (pcm)
+            {
+                pcm->write(packet.data(), len);
+            }
+            frame += len / sizeof(Frame);
+        }
+        return hash;
+    }
+
+    static const uint32_t FNV_OFFSET_BASIS = 0x811c9dc5;
+
+    static uint32_t fnv1a(uint32_t hash, const uint8_t *data, size_t len)
+    {
+        while (len--)
+        {
+            hash = (hash ^ *data++) * 0x01000193;
+        }
+        return hash;
+    }
+};
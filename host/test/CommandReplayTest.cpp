@@ -0,0 +1,146 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Records a command sequence played through I2cA2dp and ThreadAudio, then
+// replays the CommandRecorder dump and checks that the PCM is bit-exact
+#include "HostTest.h"
+#include "CommandReplay.h"
+#include "I2cMaster.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include "thread/ThreadAudio.h"
+#include "../../AppContext.h"
+#include <new>
+
+// the dump written by CommandRecorder::write()
+class DumpBuffer : public Print
+{
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        data.insert(data.end(), buffer, buffer + size);
+        return size;
+    }
+
+    std::vector<uint8_t> data;
+};
+
+static uint32_t recordTotal(void)
+{
+    DumpBuffer dump;
+    CommandRecorder::write(dump);
+    std::vector<CommandRecorder::CommandRecord> records;
+    uint32_t total = 0;
+    CHECK(CommandReplay::parse(dump.data.data(), dump.data.size(), records, &total));
+    return total;
+}
+
+static I2cParam::Pattern fullPattern(void)
+{
+    I2cParam::Pattern pattern = {.id = 1, .stepCount = I2cParam::MAX_PATTERN_STEPS, .step = {}};
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        pattern.step[i] = {.cue = (uint8_t)(i % 4 ? I2cParam::CueLaneLeft + i % 3 : I2cParam::CueNone), .gain = (uint8_t)(40 + 4 * i), .duration = (uint8_t)(3 + i), .repeat = (uint8_t)(1 + i % 2)};
+    }
+    return pattern;
+}
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+HOST_TEST(command_replay_bit_exact)
+{
+    static ThreadAudio threadAudio;
+    static AppContext context = {.threadApp = nullptr, .threadAudio = &threadAudio, .threadAppConfig = {}, .threadAudioConfig = {.core = 1, .priority = 3}};
+    threadAudio.start(&context);
+    BluetoothA2DPSource &source = hostA2dpSource();
+    threadAudio.setA2dpSource(&source);
+    source.write_data(threadAudio.soundBuffer());
+
+    I2cA2dp i2cA2dp(threadAudio.commandQueue(), EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+    uint8_t available = I2cA2dp::paramPool().available();
+    uint32_t totalBefore = recordTotal();
+    threadAudio.postEvent(EventA2dpConnectionState, ESP_A2D_CONNECTION_STATE_CONNECTED);
+
+    const I2cParam::Timeline timeline = {
+        .sequence = 3,
+        .repeat = 2,
+        .slotCount = 4,
+        .slot = {{I2cParam::CueError, 100}, {I2cParam::CueNone, 0}, {I2cParam::CueLaneMiddle, 70}, {I2cParam::CueEdgePool, 35}},
+    };
+    const I2cParam::ToneParam tone = {
+        .frequency = 880, .waveform = I2cParam::WaveSine, .gain = 80, .attack = 5, .decay = 20, .sustain = 50, .release = 30, .fmFrequency = 0, .fmIndex = 0};
+    I2cFrame setTone{I2cCommand::SetTone, 0};
+    setTone.insert(setTone.end(), (const uint8_t *)&tone, (const uint8_t *)&tone + sizeof(tone));
+
+    // the command sent before the packet of that index
+    struct
+    {
+        uint32_t packet;
+        I2cFrame frame;
+    } const script[] = {
+        {0, I2cMaster::playSound(60, 0x23)},
+        {40, I2cMaster::definePattern(fullPattern())},
+        {41, I2cMaster::playPattern(1, 2)},
+        {230, I2cMaster::playTimeline(timeline)},
+        {300, I2cMaster::playAt(300 * 128 + 5000, I2cParam::CueError, 90)},
+        {330, I2cFrame{I2cCommand::PlayUrgent, I2cParam::CueLaneLeft, 100, 1}},
+        {360, setTone},
+        {361, I2cMaster::playAt(361 * 128 + 1000, I2cParam::CueTone, 100)},
+        {420, I2cMaster::playSound(30, 0x11)},
+    };
+    const uint32_t PACKETS = 600;
+
+    std::vector<uint8_t> packet(A2DP_PACKET_SIZE);
+    uint32_t hash = CommandReplay::FNV_OFFSET_BASIS;
+    size_t next = 0;
+    for (uint32_t n = 0; n < PACKETS; n++)
+    {
+        for (; next < sizeof(script) / sizeof(script[0]) && script[next].packet == n; next++)
+        {
+            CHECK(I2cMaster::transfer(script[next].frame) == I2cResponse::Success);
+        }
+        while (threadAudio.messagesWaiting() > 0)
+        {
+            threadAudio.messageLoop(0);
+        }
+        CHECK(ccall_bt_app_a2d_data_cb(packet.data(), A2DP_PACKET_SIZE) == A2DP_PACKET_SIZE);
+        hash = CommandReplay::fnv1a(hash, packet.data(), A2DP_PACKET_SIZE);
+    }
+    Wire.end();
+    CHECK(I2cA2dp::paramPool().available() == available); // ThreadAudio released the param blocks
+
+    // the dump keeps the commands whole, DefinePattern included
+    DumpBuffer dump;
+    CommandRecorder::write(dump);
+    std::vector<CommandRecorder::CommandRecord> records;
+    uint32_t total = 0;
+    CHECK(CommandReplay::parse(dump.data.data(), dump.data.size(), records, &total));
+    uint32_t count = total - totalBefore;
+    CHECK(count == 1 + sizeof(script) / sizeof(script[0]) && count <= records.size());
+    records.erase(records.begin(), records.end() - count);
+    CHECK(records[0].event == EventA2dpConnectionState); // the queue set keeps the order of the two queues
+    CHECK(records[2].command == I2cCommand::DefinePattern && records[2].length == sizeof(I2cParam::Pattern));
+
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    CHECK(CommandReplay::render(records, *soundBuffer, PACKETS * A2DP_PACKET_SIZE / sizeof(Frame)) == hash);
+    soundBuffer->~SoundBuffer();
+}
@@ -0,0 +1,40 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "lib/ESP32-A2DP/src/BluetoothA2DPSource.h"
+
+// bytes the A2DP stack asks for per data callback
+static const int32_t A2DP_PACKET_SIZE = 512;
+
+// The A2DP source of the host build, started once without a callback so that it
+// plays the data given to write_data(). The stack calls back through
+// ccall_bt_app_a2d_data_cb(), which reaches the last source constructed: there
+// is one for the whole process.
+inline BluetoothA2DPSource &hostA2dpSource(void)
+{
+    static BluetoothA2DPSource source;
+    static bool isStarted = false;
+    if (!isStarted)
+    {
+        source.start("host");
+        isStarted = true;
+    }
+    return source;
+}
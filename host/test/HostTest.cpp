@@ -0,0 +1,66 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "HostTest.h"
+
+HostTest *HostTest::_first = nullptr;
+uint32_t HostTest::_failures = 0;
+
+HostTest::HostTest(const char *name, Function function) : _name(name), _function(function), _next(_first)
+{
+    _first = this;
+}
+
+void HostTest::fail(const char *file, int line, const char *expression)
+{
+    // the first failures are enough to start with, a broken loop would flood the log
+    if (_failures++ < 10)
+    {
+        printf("%s:%d: check failed: %s\n", file, line, expression);
+    }
+}
+
+int HostTest::run(const char *name)
+{
+    int failed = 0;
+    int count = 0;
+    for (HostTest *test = _first; test; test = test->_next)
+    {
+        if (name && strcmp(name, test->_name) != 0)
+        {
+            continue;
+        }
+        _failures = 0;
+        test->_function();
+        printf("%s: %s\n", test->_name, _failures ? "FAIL" : "OK");
+        failed += _failures ? 1 : 0;
+        count++;
+    }
+    if (count == 0)
+    {
+        printf("no test %s\n", name ? name : "");
+        return 1;
+    }
+    return failed;
+}
+
+int main(int argc, char *argv[])
+{
+    return HostTest::run(argc > 1 ? argv[1] : nullptr) ? 1 : 0;
+}
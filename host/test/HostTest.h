@@ -0,0 +1,52 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Minimal test registry of the host tests: HOST_TEST(name) defines a test,
+// CHECK() records a failure and goes on. "host_test <name>" runs one test,
+// "host_test" all of them; ctest runs each test on its own, see ../CMakeLists.txt.
+#include <Arduino.h>
+
+class HostTest
+{
+public:
+    typedef void (*Function)(void);
+
+    HostTest(const char *name, Function function);
+
+    // returns the number of failed tests
+    static int run(const char *name);
+
+    static void fail(const char *file, int line, const char *expression);
+
+private:
+    const char *_name;
+    Function _function;
+    HostTest *_next;
+
+    static HostTest *_first;
+    static uint32_t _failures;
+};
+
+#define HOST_TEST(name)                                           \
+    static void hostTest_##name(void);                            \
+    static HostTest hostTestEntry_##name(#name, hostTest_##name); \
+    static void hostTest_##name(void)
+
+#define CHECK(expression) ((expression) ? (void)0 : HostTest::fail(__FILE__, __LINE__, #expression))
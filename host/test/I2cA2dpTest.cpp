@@ -0,0 +1,237 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of the I2C protocol parser through the stub Wire, see I2cMaster.h
+#include "HostTest.h"
+#include "I2cMaster.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include "peripheral/i2c/I2cStatus.h"
+#include <chrono>
+#include <random>
+
+static const int16_t EventI2c = 1;
+
+static const I2cParam::Timeline timeline = {
+    .sequence = 7,
+    .repeat = 0,
+    .slotCount = 3,
+    .slot = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100},
+        {.cue = I2cParam::CueNone, .gain = 0},
+        {.cue = I2cParam::CueLaneRight, .gain = 50},
+    },
+};
+
+// the largest DefinePattern frame
+static I2cParam::Pattern fullPattern(void)
+{
+    I2cParam::Pattern pattern = {.id = 2, .stepCount = I2cParam::MAX_PATTERN_STEPS, .step = {}};
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        pattern.step[i] = {.cue = (uint8_t)(I2cParam::CueLaneLeft + i % 3), .gain = (uint8_t)(10 + i), .duration = (uint8_t)(1 + i), .repeat = 1};
+    }
+    return pattern;
+}
+
+HOST_TEST(i2c_parse_commands)
+{
+    HostAudioThread thread(8);
+    I2cA2dp i2cA2dp(&thread.commands, EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    uint8_t available = I2cA2dp::paramPool().available();
+
+    // disconnected: play commands are answered but not posted
+    CHECK(I2cMaster::transfer(I2cMaster::playSound(50, 0x23)) == I2cResponse::ErrorDisconnected);
+    CHECK(I2cMaster::transfer(I2cFrame{I2cCommand::IsA2dpConnected}) == I2cResponse::A2dpDisconnected);
+    CHECK(thread.drain() == 0);
+
+    i2cA2dp.setA2dpConnectionStatus(true);
+    CHECK(I2cMaster::transfer(I2cFrame{I2cCommand::IsA2dpConnected}) == I2cResponse::A2dpConnected);
+
+    CHECK(I2cMaster::transfer(I2cMaster::playSound(50, 0x23)) == I2cResponse::Success);
+    CHECK(I2cMaster::transfer(I2cMaster::playSound(101, 0x23)) == I2cResponse::ErrorInvalidParam);
+    CHECK(I2cMaster::transfer(I2cFrame{I2cCommand::PlaySound, 50}) == I2cResponse::ErrorInvalidParam);
+
+    CHECK(I2cMaster::transfer(I2cMaster::playTimeline(timeline)) == I2cResponse::Success);
+    I2cFrame badCrc = I2cMaster::playTimeline(timeline);
+    badCrc.back() ^= 1;
+    CHECK(I2cMaster::transfer(badCrc) == I2cResponse::ErrorInvalidParam);
+    I2cFrame truncated = I2cMaster::playTimeline(timeline);
+    truncated.pop_back();
+    CHECK(I2cMaster::transfer(truncated) == I2cResponse::ErrorInvalidParam);
+
+    const I2cParam::Pattern pattern = fullPattern();
+    CHECK(I2cMaster::transfer(I2cMaster::definePattern(pattern)) == I2cResponse::Success);
+    CHECK(I2cMaster::transfer(I2cMaster::playPattern(pattern.id, 3)) == I2cResponse::Success);
+    CHECK(I2cMaster::transfer(I2cMaster::playPattern(I2cParam::MAX_PATTERNS, 0)) == I2cResponse::ErrorInvalidParam);
+    CHECK(I2cMaster::transfer(I2cMaster::playAt(0x12345678, I2cParam::CueError, 80)) == I2cResponse::Success);
+    CHECK(I2cMaster::transfer(I2cMaster::playAt(0, I2cParam::CueNone, 80)) == I2cResponse::ErrorInvalidParam);
+    CHECK(I2cMaster::transfer(I2cFrame{0xee, 1, 2}) == I2cResponse::ErrorInvalidCommand);
+
+    // an empty frame changes nothing, the reply is still the one of the last command
+    I2cFrame empty;
+    Wire.masterWrite(empty.data(), 0);
+
+    CHECK(I2cA2dp::paramPool().available() == available - 2);
+    CHECK(thread.drain() == 5);
+    CHECK(I2cA2dp::paramPool().available() == available);
+
+    const std::vector<HostAudioThread::Received> &messages = thread.messages;
+    // the parameters of PlayTimeline and DefinePattern travel in a param block, the others inline
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        CHECK(messages[i].isBlock == (messages[i].command == I2cCommand::PlayTimeline || messages[i].command == I2cCommand::DefinePattern));
+    }
+    CHECK(messages[0].command == I2cCommand::PlaySound && messages[0].param.size() == 3 && messages[0].param[0] == 50 && messages[0].param[1] == 0x23);
+    CHECK(messages[1].command == I2cCommand::PlayTimeline);
+    CHECK(messages[1].param.size() == I2cParam::TIMELINE_HEADER_SIZE + 3 * sizeof(I2cParam::TimelineSlot));
+    CHECK(memcmp(messages[1].param.data(), &timeline, messages[1].param.size()) == 0);
+    CHECK(messages[2].command == I2cCommand::DefinePattern);
+    CHECK(messages[2].param.size() == sizeof(I2cParam::Pattern));
+    CHECK(memcmp(messages[2].param.data(), &pattern, sizeof(pattern)) == 0);
+    CHECK(messages[3].command == I2cCommand::PlayPattern && messages[3].param == (I2cFrame{pattern.id, 3}));
+    CHECK(messages[4].command == I2cCommand::PlayAt && messages[4].param == (I2cFrame{0x78, 0x56, 0x34, 0x12, I2cParam::CueError, 80}));
+    Wire.end();
+}
+
+// random and corrupted frames: every reply fits MAX_REPLY_SIZE, only valid
+// parameters are posted and no param block is lost
+HOST_TEST(i2c_fuzz)
+{
+    HostAudioThread thread(32);
+    I2cA2dp i2cA2dp(&thread.commands, EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+    uint8_t available = I2cA2dp::paramPool().available();
+
+    I2cStatus::StatusRegister before;
+    I2cStatus::read(before);
+
+    const I2cFrame valid[] = {
+        I2cMaster::playSound(50, 0x23),
+        I2cMaster::playTimeline(timeline),
+        I2cMaster::definePattern(fullPattern()),
+        I2cMaster::playPattern(1, 2),
+        I2cMaster::playAt(1000, I2cParam::CueLaneMiddle, 100),
+    };
+    std::mt19937 random(0x5eed);
+    const uint32_t FRAMES = 20000;
+    uint32_t frames = 0;
+    for (uint32_t n = 0; n < FRAMES; n++)
+    {
+        I2cFrame frame;
+        if (random() % 2)
+        {
+            // a valid frame with one byte changed, cut or extended
+            frame = valid[random() % (sizeof(valid) / sizeof(valid[0]))];
+            switch (random() % 3)
+            {
+            case 0:
+                frame[random() % frame.size()] ^= (uint8_t)(1 << (random() % 8));
+                break;
+            case 1:
+                frame.resize(random() % frame.size());
+                break;
+            default:
+                frame.push_back((uint8_t)random());
+                break;
+            }
+        }
+        else
+        {
+            frame.resize(random() % (TwoWire::BUFFER_SIZE + 16));
+            for (size_t i = 0; i < frame.size(); i++)
+            {
+                frame[i] = (uint8_t)random();
+            }
+            if (!frame.empty())
+            {
+                frame[0] %= I2cCommand::PlayPattern + 2;
+            }
+        }
+
+        if (Wire.masterWrite(frame.data(), frame.size()) > 0)
+        {
+            frames++;
+        }
+        uint8_t reply[TwoWire::BUFFER_SIZE];
+        CHECK(Wire.masterRead(reply, sizeof(reply)) <= I2cA2dp::MAX_REPLY_SIZE);
+        thread.drain();
+    }
+
+    for (size_t i = 0; i < thread.messages.size(); i++)
+    {
+        const HostAudioThread::Received &received = thread.messages[i];
+        if (received.command == I2cCommand::PlayTimeline)
+        {
+            const I2cParam::Timeline *posted = reinterpret_cast<const I2cParam::Timeline *>(received.param.data());
+            CHECK(posted->slotCount >= 1 && posted->slotCount <= I2cParam::MAX_TIMELINE_SLOTS);
+            CHECK(received.param.size() == I2cParam::TIMELINE_HEADER_SIZE + posted->slotCount * sizeof(I2cParam::TimelineSlot));
+        }
+        else if (received.command == I2cCommand::DefinePattern)
+        {
+            const I2cParam::Pattern *posted = reinterpret_cast<const I2cParam::Pattern *>(received.param.data());
+            CHECK(posted->id < I2cParam::MAX_PATTERNS && posted->stepCount >= 1 && posted->stepCount <= I2cParam::MAX_PATTERN_STEPS);
+        }
+        else if (received.command == I2cCommand::PlaySound)
+        {
+            CHECK(received.param.size() == 3 && received.param[0] <= 100);
+        }
+        else
+        {
+            CHECK(received.command == I2cCommand::PlayPattern || received.command == I2cCommand::PlayAt);
+        }
+    }
+    CHECK(thread.messages.size() > 0);
+    CHECK(I2cA2dp::paramPool().available() == available);
+
+    I2cStatus::StatusRegister status;
+    I2cStatus::read(status);
+    CHECK(status.frameCount - before.frameCount == frames);
+    CHECK(status.dropCount == before.dropCount);
+    Wire.end();
+}
+
+// the command is queued for ThreadAudio before the receive callback returns
+HOST_TEST(i2c_receive_to_post_latency)
+{
+    HostAudioThread thread(32);
+    I2cA2dp i2cA2dp(&thread.commands, EventI2c);
+    CHECK(i2cA2dp.begin(I2C_DEV_ADDR));
+    i2cA2dp.setA2dpConnectionStatus(true);
+
+    const uint32_t COUNT = 1000;
+    const I2cFrame frame = I2cMaster::playSound(50, 0x23);
+    std::chrono::nanoseconds total(0), max(0);
+    for (uint32_t n = 0; n < COUNT; n++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Wire.masterWrite(frame.data(), frame.size());
+        std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+        total += elapsed;
+        max = std::max(max, elapsed);
+
+        CHECK(uxQueueMessagesWaiting(thread.queue()) == 1);
+        CHECK(thread.drain() == 1);
+    }
+    CHECK(thread.messages.size() == COUNT);
+    Serial.printf("receive to postEvent: avg %lu ns, max %lu ns\n", (unsigned long)(total.count() / COUNT), (unsigned long)max.count());
+    CHECK(total.count() / COUNT < 100000); // far below the 2.9ms of an A2DP packet
+    Wire.end();
+}
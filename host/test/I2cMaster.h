@@ -0,0 +1,150 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+// Host side of the I2C protocol: I2cMaster builds the frames of the master and
+// runs them through the stub Wire, HostAudioThread stands in for ThreadAudio
+// and takes what I2cA2dp posts. Used by the tests and by tools/i2c_replay.cpp.
+#include <Arduino.h>
+#include <Wire.h>
+#include <vector>
+#include "peripheral/i2c/I2cA2dp.h"
+#include "peripheral/i2c/I2cCommand.h"
+#include "peripheral/i2c/I2cParam.h"
+
+typedef std::vector<uint8_t> I2cFrame;
+
+class I2cMaster
+{
+public:
+    static I2cFrame playSound(uint8_t volume, uint8_t sound)
+    {
+        return I2cFrame{I2cCommand::PlaySound, volume, sound, 0};
+    }
+
+    static I2cFrame playTimeline(const I2cParam::Timeline &timeline)
+    {
+        return withCrc(I2cCommand::PlayTimeline, &timeline, I2cParam::TIMELINE_HEADER_SIZE + timeline.slotCount * sizeof(I2cParam::TimelineSlot));
+    }
+
+    static I2cFrame definePattern(const I2cParam::Pattern &pattern)
+    {
+        return withCrc(I2cCommand::DefinePattern, &pattern, I2cParam::PATTERN_HEADER_SIZE + pattern.stepCount * sizeof(I2cParam::PatternStep));
+    }
+
+    static I2cFrame playPattern(uint8_t id, uint8_t repeat)
+    {
+        return I2cFrame{I2cCommand::PlayPattern, id, repeat};
+    }
+
+    static I2cFrame playAt(uint32_t frame, uint8_t cue, uint8_t gain)
+    {
+        return I2cFrame{I2cCommand::PlayAt, (uint8_t)frame, (uint8_t)(frame >> 8), (uint8_t)(frame >> 16), (uint8_t)(frame >> 24), cue, gain};
+    }
+
+    static I2cFrame assetBegin(uint8_t id, uint16_t sampleRate, uint16_t length)
+    {
+        return I2cFrame{I2cCommand::AssetBegin, id, (uint8_t)sampleRate, (uint8_t)(sampleRate >> 8), (uint8_t)length, (uint8_t)(length >> 8)};
+    }
+
+    static I2cFrame assetChunk(uint8_t id, uint16_t offset, const int8_t *samples, size_t count)
+    {
+        I2cFrame frame{I2cCommand::AssetChunk, id, (uint8_t)offset, (uint8_t)(offset >> 8)};
+        frame.reserve(frame.size() + count + 1);
+        frame.insert(frame.end(), samples, samples + count);
+        frame.push_back(I2cParam::crc8(&frame[1], frame.size() - 1));
+        return frame;
+    }
+
+    static I2cFrame assetCommit(uint8_t id, const int8_t *samples, size_t count)
+    {
+        return I2cFrame{I2cCommand::AssetCommit, id, I2cParam::crc8((const uint8_t *)samples, count)};
+    }
+
+    // writes the frame and reads the one byte reply
+    static uint8_t transfer(const I2cFrame &frame)
+    {
+        Wire.masterWrite(frame.data(), frame.size());
+        uint8_t reply = 0;
+        Wire.masterRead(&reply, sizeof(reply));
+        return reply;
+    }
+
+private:
+    static I2cFrame withCrc(uint8_t command, const void *param, size_t size)
+    {
+        I2cFrame frame(1 + size + 1);
+        frame[0] = command;
+        memcpy(&frame[1], param, size);
+        frame[1 + size] = I2cParam::crc8(&frame[1], size);
+        return frame;
+    }
+};
+
+// ThreadAudio without a task: drain() takes the commands posted by I2cA2dp to
+// the command queue, their parameters (inline or in a param block) are copied
+// to the message log and the blocks released like ThreadAudio does
+class HostAudioThread
+{
+public:
+    typedef struct _Received
+    {
+        uint8_t command;
+        I2cFrame param; // the inline parameters, or the param block of PlayTimeline/DefinePattern
+        bool isBlock;
+    } Received;
+
+    HostAudioThread(uint16_t queueLength) : commands(queueLength) {}
+
+    QueueHandle_t queue(void)
+    {
+        return commands.queue();
+    }
+
+    // returns the number of commands taken
+    size_t drain(void)
+    {
+        size_t count = 0;
+        I2cA2dp::CommandMessage msg;
+        while (commands.receive(msg, 0))
+        {
+            Received received = {.command = (uint8_t)msg.event, .param = I2cFrame(), .isBlock = msg.is<PoolBlock>()};
+            if (const I2cA2dp::Frame *frame = msg.get<I2cA2dp::Frame>())
+            {
+                received.param.assign(frame->param, frame->param + frame->length);
+            }
+            else if (const PoolBlock *block = msg.get<PoolBlock>())
+            {
+                I2cA2dp::ParamPool &pool = I2cA2dp::paramPool();
+                const uint8_t *data = pool.data(block->handle);
+                if (data)
+                {
+                    received.param.assign(data, data + block->length);
+                }
+                pool.release(block->handle);
+            }
+            messages.push_back(received);
+            count++;
+        }
+        return count;
+    }
+
+    I2cA2dp::CommandQueue commands;
+    std::vector<Received> messages;
+};
@@ -0,0 +1,141 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of the timer table of ThreadBase (MessageTimer): the messageLoop() of a
+// thread without a task is driven with the tick count of the FreeRTOS stubs.
+#include "HostTest.h"
+#include "HostStubs.h"
+#include "base/os/freertos/thread/ThreadBase.h"
+#include <vector>
+
+class TimerThread : public ThreadBase
+{
+public:
+    TimerThread() : ThreadBase(4) {}
+
+    virtual void start(void *) {}
+    virtual void onMessage(const Message &msg)
+    {
+        events.push_back(msg.event);
+    }
+
+    // the setup() of a started thread, which arms EventDelayInit
+    void begin(void)
+    {
+        setup();
+    }
+
+    // runs the message loop without waiting until nothing is left to dispatch
+    void runFor(TickType_t ticks)
+    {
+        for (TickType_t n = 0; n < ticks; n++)
+        {
+            hostAdvanceTicks(1);
+            messageLoop(0);
+        }
+    }
+
+    size_t count(int16_t event) const
+    {
+        size_t result = 0;
+        for (int16_t e : events)
+        {
+            result += (e == event) ? 1 : 0;
+        }
+        return result;
+    }
+
+    std::vector<int16_t> events;
+
+protected:
+    virtual void delayInit(void)
+    {
+        events.push_back((int16_t)EventDelayInit);
+    }
+};
+
+static const int16_t EventTick = 1;
+static const int16_t EventOnce = 2;
+
+HOST_TEST(timer_delay_init_dispatched)
+{
+    TimerThread thread;
+    thread.begin();
+    thread.runFor(pdMS_TO_TICKS(199));
+    CHECK(thread.events.empty());
+    thread.runFor(1);
+    CHECK(thread.events.size() == 1 && thread.events[0] == (int16_t)ThreadBase::EventDelayInit);
+    thread.runFor(pdMS_TO_TICKS(1000));
+    CHECK(thread.events.size() == 1);
+}
+
+HOST_TEST(timer_periodic_rearm_and_stop)
+{
+    TimerThread thread;
+    CHECK(thread.startTimer(EventTick, 10, true));
+    CHECK(thread.startTimer(EventOnce, 25));
+    thread.runFor(pdMS_TO_TICKS(100));
+    CHECK(thread.count(EventTick) == 10);
+    CHECK(thread.count(EventOnce) == 1);
+
+    // a restart moves the expiry, a stop ends it
+    thread.runFor(pdMS_TO_TICKS(5));
+    CHECK(thread.startTimer(EventTick, 10, true));
+    thread.runFor(pdMS_TO_TICKS(9));
+    CHECK(thread.count(EventTick) == 10);
+    thread.runFor(1);
+    CHECK(thread.count(EventTick) == 11);
+    thread.stopTimer(EventTick);
+    thread.runFor(pdMS_TO_TICKS(100));
+    CHECK(thread.count(EventTick) == 11);
+}
+
+HOST_TEST(timer_stall_does_not_burst)
+{
+    TimerThread thread;
+    CHECK(thread.startTimer(EventTick, 10, true));
+    thread.runFor(pdMS_TO_TICKS(10));
+    CHECK(thread.count(EventTick) == 1);
+
+    // the thread is held up for 10 periods: one late message, then the period again from now
+    hostAdvanceTicks(pdMS_TO_TICKS(100));
+    thread.messageLoop(0);
+    CHECK(thread.count(EventTick) == 2);
+    thread.runFor(pdMS_TO_TICKS(9));
+    CHECK(thread.count(EventTick) == 2);
+    thread.runFor(1);
+    CHECK(thread.count(EventTick) == 3);
+}
+
+HOST_TEST(timer_table_full)
+{
+    TimerThread thread;
+    for (uint8_t i = 0; i < ThreadBase::TIMER_SIZE; i++)
+    {
+        CHECK(thread.startTimer(10 + i, 50));
+    }
+    CHECK(!thread.startTimer(20, 50));
+    // restarting an active timer needs no new slot, a stopped one frees it
+    CHECK(thread.startTimer(10, 50));
+    thread.stopTimer(11);
+    CHECK(thread.startTimer(20, 50));
+    thread.runFor(pdMS_TO_TICKS(50));
+    CHECK(thread.count(11) == 0 && thread.count(20) == 1 && thread.count(10) == 1);
+    CHECK(thread.events.size() == ThreadBase::TIMER_SIZE);
+}
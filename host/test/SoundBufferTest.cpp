@@ -0,0 +1,227 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks of SoundBuffer as the A2DP source reads it
+#include "HostTest.h"
+#include "data/SoundBuffer.h"
+#include "data/CueStore.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include <new>
+#include <vector>
+
+static const uint32_t TICK_FRAMES = PatternSequencer::TICK_FRAMES;
+
+// the shortest pattern: one 10ms tick, shorter than an A2DP block
+static const I2cParam::Pattern tickPattern = {
+    .id = 0,
+    .stepCount = 1,
+    .step = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100, .duration = 1, .repeat = 1},
+    },
+};
+
+static const I2cParam::Pattern mixedPattern = {
+    .id = 1,
+    .stepCount = 5,
+    .step = {
+        {.cue = I2cParam::CueEdgePool, .gain = 100, .duration = 3, .repeat = 4},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 2, .repeat = 1},
+        {.cue = I2cParam::CueLaneMiddle, .gain = 60, .duration = 12, .repeat = 1},
+        {.cue = I2cParam::CueError, .gain = 100, .duration = 1, .repeat = 3},
+        {.cue = I2cParam::CueLaneRight, .gain = 30, .duration = 7, .repeat = 1},
+    },
+};
+
+// naive per-frame rendering of the pattern at frame of its cycle
+static int32_t referenceLevel(const I2cParam::Pattern &pattern, uint32_t frame)
+{
+    uint32_t start = 0;
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        const I2cParam::PatternStep &step = pattern.step[i];
+        for (uint8_t r = 0; r < step.repeat; r++)
+        {
+            uint32_t duration = step.duration * TICK_FRAMES;
+            if (frame < start + duration)
+            {
+                uint32_t offset = frame - start;
+                if (step.cue == I2cParam::CueNone || offset >= (uint32_t)SoundBuffer::SAMPLING_PER_SLOT)
+                {
+                    return 0;
+                }
+                const int8_t *pcm = (const int8_t *)CueStore::samples(*CueStore::find(step.cue));
+                return SampleS8::toLevel(pcm[offset]) * step.gain / I2cParam::MAX_GAIN;
+            }
+            start += duration;
+        }
+    }
+    return 0;
+}
+
+static uint32_t cycleLength(const I2cParam::Pattern &pattern)
+{
+    uint32_t length = 0;
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        length += pattern.step[i].duration * pattern.step[i].repeat * TICK_FRAMES;
+    }
+    return length;
+}
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+// plays the pattern in blocks of blockSize bytes as BluetoothA2DPSource::get_data_default()
+// reads it and compares it with the reference
+static void checkPattern(const I2cParam::Pattern &pattern, int32_t blockSize, uint32_t cycles)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    CHECK(soundBuffer->definePattern(pattern));
+    CHECK(soundBuffer->playPattern(pattern.id, 0));
+
+    uint32_t length = cycleLength(pattern);
+    std::vector<uint8_t> block(blockSize);
+    uint32_t frame = 0;
+    uint32_t pos = 0;
+    while (frame < cycles * length)
+    {
+        int32_t len = soundBuffer->get2ChannelData(pos, blockSize, block.data());
+        CHECK(len == blockSize); // never short, also at the end of a cycle
+        pos += len;
+
+        const Frame *frames = (const Frame *)block.data();
+        for (int32_t i = 0; i < len / (int32_t)sizeof(Frame); i++, frame++)
+        {
+            int32_t expected = referenceLevel(pattern, frame % length);
+            CHECK(frames[i].channel1 == expected && frames[i].channel2 == expected);
+        }
+    }
+    CHECK(soundBuffer->streamFrame() == frame);
+    soundBuffer->~SoundBuffer();
+}
+
+HOST_TEST(pattern_cycle_wraps_within_block)
+{
+    checkPattern(tickPattern, 512, 20);
+    checkPattern(tickPattern, 1000, 20);
+    checkPattern(mixedPattern, 512, 3);
+    checkPattern(mixedPattern, 1000, 3);
+    checkPattern(mixedPattern, sizeof(Frame), 1);
+}
+
+// PlaySound repeats every 0.5s whatever the block size
+HOST_TEST(playsound_cycle_is_half_a_second)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    soundBuffer->updateSoundSignal(0x23, 0);
+
+    const uint32_t cycle = SoundBuffer::SAMPLING_RATE / 2;
+    std::vector<Frame> pcm(3 * cycle + 512);
+    uint32_t frame = 0;
+    uint32_t pos = 0;
+    while (frame < pcm.size() - 128)
+    {
+        int32_t len = soundBuffer->get2ChannelData(pos, 128 * sizeof(Frame), (uint8_t *)&pcm[frame]);
+        CHECK(len == 128 * sizeof(Frame));
+        pos += len;
+        frame += 128;
+    }
+    for (uint32_t i = 0; i < 2 * cycle; i++)
+    {
+        CHECK(pcm[i].channel1 == pcm[i + cycle].channel1);
+    }
+    soundBuffer->~SoundBuffer();
+}
+
+// the PCM of the cycle after the last of the PlaySound commands, each one sent at the start of a cycle
+static std::vector<int16_t> playSoundCycle(std::initializer_list<uint8_t> sounds)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+
+    const uint32_t cycle = SoundBuffer::SAMPLING_RATE / 2;
+    const uint32_t BLOCK_FRAMES = 126; // divides the cycle
+    Frame block[BLOCK_FRAMES];
+    std::vector<int16_t> pcm;
+    uint32_t pos = 0;
+    for (uint8_t sound : sounds)
+    {
+        soundBuffer->updateSoundSignal(sound, 0);
+        pcm.clear();
+        for (uint32_t frame = 0; frame < cycle; frame += BLOCK_FRAMES)
+        {
+            pos += soundBuffer->get2ChannelData(pos, sizeof(block), (uint8_t *)block);
+            for (const Frame &f : block)
+            {
+                pcm.push_back(f.channel1);
+            }
+        }
+    }
+    soundBuffer->~SoundBuffer();
+    return pcm;
+}
+
+// a PlaySound sets the slots of its bits and keeps the others, 0 clears them all
+HOST_TEST(playsound_adds_to_previous_slots)
+{
+    CHECK(playSoundCycle({0x01, 0x20}) == playSoundCycle({0x21}));
+    // the lanes share a slot: the second lane replaces the first one
+    CHECK(playSoundCycle({0x0a, 0x01}) == playSoundCycle({0x09}));
+    CHECK(playSoundCycle({0x23, 0x08}) == playSoundCycle({0x2a}));
+    CHECK(playSoundCycle({0x23, 0x00}) == playSoundCycle({0x00}));
+    CHECK(playSoundCycle({0x21}) != playSoundCycle({0x20}));
+}
+
+// renders count frames in A2DP packets of 128 frames
+static void renderFrames(SoundBuffer *soundBuffer, uint32_t &pos, uint32_t count)
+{
+    Frame pcm[128];
+    for (uint32_t frame = 0; frame < count; frame += 128)
+    {
+        pos += soundBuffer->get2ChannelData(pos, sizeof(pcm), (uint8_t *)pcm);
+    }
+}
+
+// a lower priority urgent cue is refused when requested (the I2C reply), not
+// dropped later by the render callback
+HOST_TEST(urgent_priority_checked_on_request)
+{
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    CHECK(soundBuffer->init());
+    uint32_t pos = 0;
+
+    // against the pending request
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueLaneLeft, 100, 5) == I2cResponse::Success);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueLaneRight, 100, 4) == I2cResponse::ErrorBusy);
+
+    // against the playing cue, an equal priority replaces it
+    renderFrames(soundBuffer, pos, 128);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueLaneRight, 100, 4) == I2cResponse::ErrorBusy);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueLaneRight, 100, 5) == I2cResponse::Success);
+    renderFrames(soundBuffer, pos, 128);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueError, 100, 0) == I2cResponse::ErrorBusy);
+
+    // anything once the cue is over
+    renderFrames(soundBuffer, pos, SoundBuffer::SAMPLING_PER_SLOT);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueError, 100, 0) == I2cResponse::Success);
+    CHECK(SoundBuffer::requestUrgent(I2cParam::CueNone, 100, 9) == I2cResponse::Fail);
+    renderFrames(soundBuffer, pos, SoundBuffer::SAMPLING_PER_SLOT + 128);
+    soundBuffer->~SoundBuffer();
+}
@@ -0,0 +1,93 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Checks that the mono path of the volume control matches the two channel path
+// on blocks with identical channels
+#include "HostTest.h"
+#include "lib/ESP32-A2DP/src/A2DPVolumeControl.h"
+#include <vector>
+
+// every 16 bit sample value, both channels identical
+static std::vector<Frame> monoFrames(void)
+{
+    std::vector<Frame> frames;
+    for (int32_t pcm = INT16_MIN; pcm <= INT16_MAX; pcm++)
+    {
+        frames.push_back(Frame((int16_t)pcm));
+    }
+    return frames;
+}
+
+static void checkVolumes(A2DPVolumeControl &volumeControl)
+{
+    const std::vector<Frame> input = monoFrames();
+    const uint16_t BLOCK_FRAMES = 128; // the A2DP callback processes 512 bytes at a time
+    for (uint8_t volume = 0; volume <= 127; volume++)
+    {
+        volumeControl.set_volume(volume);
+        std::vector<Frame> stereo = input;
+        std::vector<Frame> mono = input;
+        for (size_t i = 0; i < input.size(); i += BLOCK_FRAMES)
+        {
+            uint16_t count = std::min<size_t>(BLOCK_FRAMES, input.size() - i);
+            volumeControl.update_audio_data(&stereo[i], count);
+            volumeControl.update_audio_data(&mono[i], count, true);
+        }
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            CHECK(mono[i].channel1 == stereo[i].channel1 && mono[i].channel2 == stereo[i].channel2);
+        }
+    }
+}
+
+HOST_TEST(volume_mono_matches_stereo)
+{
+    A2DPDefaultVolumeControl defaultVolumeControl;
+    A2DPVolumeControl &volumeControl = defaultVolumeControl;
+
+    volumeControl.set_enabled(true);
+    checkVolumes(volumeControl);
+
+    // the downmix of identical channels changes nothing
+    volumeControl.set_mono_downmix(true);
+    checkVolumes(volumeControl);
+
+    // volume not used: both paths keep the data as is
+    volumeControl.set_enabled(false);
+    checkVolumes(volumeControl);
+}
+
+// a stereo block through the mono flag false is processed per channel
+HOST_TEST(volume_stereo_flag_keeps_channels)
+{
+    A2DPDefaultVolumeControl defaultVolumeControl;
+    A2DPVolumeControl &volumeControl = defaultVolumeControl;
+    volumeControl.set_enabled(true);
+    volumeControl.set_volume(100);
+
+    Frame frames[2] = {Frame(1000, -1000), Frame(INT16_MAX, INT16_MIN)};
+    Frame expected[2] = {frames[0], frames[1]};
+    volumeControl.update_audio_data(expected, 2);
+    volumeControl.update_audio_data(frames, 2, false);
+    for (int i = 0; i < 2; i++)
+    {
+        CHECK(frames[i].channel1 == expected[i].channel1 && frames[i].channel2 == expected[i].channel2);
+    }
+    CHECK(frames[0].channel1 == -frames[0].channel2);
+}
@@ -0,0 +1,85 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "data/SoundBuffer.h"
+
+// writes 16-bit stereo PCM to a WAV file, the header is completed by close()
+class WavFile : public Print
+{
+public:
+    bool open(const char *path)
+    {
+        _file = fopen(path, "wb");
+        _dataSize = 0;
+        return _file && writeHeader();
+    }
+
+    bool close(void)
+    {
+        bool result = (fseek(_file, 0, SEEK_SET) == 0) && writeHeader();
+        return (fclose(_file) == 0) && result;
+    }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        size_t n = fwrite(buffer, 1, size, _file);
+        _dataSize += n;
+        return n;
+    }
+
+private:
+    bool writeHeader(void)
+    {
+        const uint32_t sampleRate = SoundBuffer::SAMPLING_RATE;
+        const uint16_t channels = 2;
+        const uint16_t bitsPerSample = 16;
+        uint8_t header[44];
+        memcpy(&header[0], "RIFF", 4);
+        put32(&header[4], 36 + _dataSize);
+        memcpy(&header[8], "WAVEfmt ", 8);
+        put32(&header[16], 16);
+        put16(&header[20], 1); // PCM
+        put16(&header[22], channels);
+        put32(&header[24], sampleRate);
+        put32(&header[28], sampleRate * channels * bitsPerSample / 8);
+        put16(&header[32], channels * bitsPerSample / 8);
+        put16(&header[34], bitsPerSample);
+        memcpy(&header[36], "data", 4);
+        put32(&header[40], _dataSize);
+        return fwrite(header, 1, sizeof(header), _file) == sizeof(header);
+    }
+
+    static void put16(uint8_t *p, uint16_t v)
+    {
+        p[0] = (uint8_t)v;
+        p[1] = (uint8_t)(v >> 8);
+    }
+
+    static void put32(uint8_t *p, uint32_t v)
+    {
+        put16(p, (uint16_t)v);
+        put16(p + 2, (uint16_t)(v >> 16));
+    }
+
+    FILE *_file = nullptr;
+    uint32_t _dataSize = 0;
+};
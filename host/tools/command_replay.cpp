@@ -0,0 +1,139 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Renders a CommandRecorder dump ('r' on the serial port) on the host, see
+// "../test/CommandReplay.h".
+//
+//   command_replay <capture> [--frames <n>] [--packet <bytes>] [--wav <file>] [--cues <bundle>]
+//
+// frames defaults to two seconds past the last record, packet to the 512 bytes
+// the A2DP stack asks for. Prints the FNV-1a hash of the PCM, which is the same
+// for every run of the same dump.
+#include <Arduino.h>
+#include <HostStubs.h>
+#include <new>
+#include "CommandReplay.h"
+#include "WavFile.h"
+
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + n);
+    }
+    fclose(file);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *capture = nullptr;
+    const char *wav = nullptr;
+    uint32_t frames = 0;
+    int32_t packetSize = A2DP_PACKET_SIZE;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            frames = strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--packet") == 0 && i + 1 < argc)
+        {
+            packetSize = strtol(argv[++i], nullptr, 0) & ~(sizeof(Frame) - 1);
+        }
+        else if (strcmp(argv[i], "--wav") == 0 && i + 1 < argc)
+        {
+            wav = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cues") == 0 && i + 1 < argc)
+        {
+            if (!hostMapPartition("cues", argv[++i]))
+            {
+                fprintf(stderr, "cannot open %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (capture == nullptr && argv[i][0] != '-')
+        {
+            capture = argv[i];
+        }
+        else
+        {
+            capture = nullptr;
+            break;
+        }
+    }
+    if (capture == nullptr || packetSize <= 0)
+    {
+        fprintf(stderr, "usage: %s <capture> [--frames <n>] [--packet <bytes>] [--wav <file>] [--cues <bundle>]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<uint8_t> data;
+    std::vector<CommandReplay::CommandRecord> records;
+    uint32_t total = 0;
+    if (!readFile(capture, data))
+    {
+        fprintf(stderr, "cannot read %s\n", capture);
+        return 2;
+    }
+    if (!CommandReplay::parse(data.data(), data.size(), records, &total))
+    {
+        fprintf(stderr, "no CommandRecorder dump of version %u in %s\n", CommandRecorder::VERSION, capture);
+        return 1;
+    }
+    if (total > records.size())
+    {
+        fprintf(stderr, "warning: %u records were overwritten, the replay starts from the oldest one kept\n", (unsigned)(total - records.size()));
+    }
+    if (frames == 0)
+    {
+        frames = (records.empty() ? 0 : records.back().streamFrame) + 2 * SoundBuffer::SAMPLING_RATE;
+    }
+
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    if (!soundBuffer->init())
+    {
+        fprintf(stderr, "SoundBuffer::init() failed\n");
+        return 1;
+    }
+    WavFile wavFile;
+    if (wav && !wavFile.open(wav))
+    {
+        fprintf(stderr, "cannot write %s\n", wav);
+        return 1;
+    }
+    uint32_t hash = CommandReplay::render(records, *soundBuffer, frames, packetSize, wav ? &wavFile : nullptr);
+    if (wav && !wavFile.close())
+    {
+        fprintf(stderr, "cannot write %s\n", wav);
+        return 1;
+    }
+    printf("%u records, %u frames, hash=0x%08x\n", (unsigned)records.size(), soundBuffer->streamFrame(), hash);
+    return 0;
+}
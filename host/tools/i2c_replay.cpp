@@ -0,0 +1,186 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Replays a scripted I2C master against I2cA2dp through the stub Wire.
+//
+//   i2c_replay [--script <file>] [--rate <commands/s>] [--count <n>] [--drain-ms <ms>]
+//
+// The script has one frame per line in hex bytes ("03 32 23 00"), '#' starts a
+// comment; without a script a mix of all play commands is used. The script is
+// repeated until count commands are sent.
+//
+// Commands are sent at rate on a simulated clock, the ThreadAudio stand-in
+// empties its queue every drain-ms (an A2DP packet lasts 2.9ms): a rate which
+// overruns the queue or the param pool shows up as dropped commands. The
+// commands/s reported is the parser throughput in wall time, the latency is
+// the receive callback of a frame until its message is queued. Exits with 1
+// if a command was dropped.
+#include <Arduino.h>
+#include <chrono>
+#include <string>
+#include "I2cMaster.h"
+#include "peripheral/i2c/I2cResponse.h"
+#include "peripheral/i2c/I2cStatus.h"
+
+static const int16_t EventI2c = 1;
+static const uint16_t TASK_QUEUE_SIZE = 32; // COMMAND_QUEUE_SIZE of ThreadAudio
+
+static std::vector<I2cFrame> defaultScript(void)
+{
+    I2cParam::Timeline timeline = {.sequence = 1, .repeat = 0, .slotCount = 4, .slot = {}};
+    for (uint8_t i = 0; i < timeline.slotCount; i++)
+    {
+        timeline.slot[i] = {.cue = (uint8_t)(I2cParam::CueLaneLeft + i % 3), .gain = 80};
+    }
+    I2cParam::Pattern pattern = {.id = 0, .stepCount = I2cParam::MAX_PATTERN_STEPS, .step = {}};
+    for (uint8_t i = 0; i < pattern.stepCount; i++)
+    {
+        pattern.step[i] = {.cue = (uint8_t)(I2cParam::CueLaneLeft + i % 3), .gain = 100, .duration = 2, .repeat = 1};
+    }
+    return std::vector<I2cFrame>{
+        I2cMaster::playSound(50, 0x23),
+        I2cMaster::playTimeline(timeline),
+        I2cMaster::definePattern(pattern),
+        I2cMaster::playPattern(pattern.id, 0),
+        I2cMaster::playAt(44100, I2cParam::CueError, 100),
+        I2cFrame{I2cCommand::ReadStatus},
+        I2cFrame{I2cCommand::IsA2dpConnected},
+    };
+}
+
+static bool readScript(const char *path, std::vector<I2cFrame> &script)
+{
+    FILE *file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), file))
+    {
+        I2cFrame frame;
+        char *p = line;
+        unsigned int byte;
+        int n;
+        while (*p != '#' && sscanf(p, " %2x%n", &byte, &n) == 1)
+        {
+            frame.push_back((uint8_t)byte);
+            p += n;
+        }
+        if (!frame.empty())
+        {
+            script.push_back(frame);
+        }
+    }
+    fclose(file);
+    return !script.empty();
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<I2cFrame> script;
+    uint32_t rate = 200;
+    uint32_t count = 10000;
+    uint32_t drainMs = 3;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--script") == 0 && i + 1 < argc)
+        {
+            if (!readScript(argv[++i], script))
+            {
+                fprintf(stderr, "cannot read %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+        {
+            rate = strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--count") == 0 && i + 1 < argc)
+        {
+            count = strtoul(argv[++i], nullptr, 0);
+        }
+        else if (strcmp(argv[i], "--drain-ms") == 0 && i + 1 < argc)
+        {
+            drainMs = strtoul(argv[++i], nullptr, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--script <file>] [--rate <commands/s>] [--count <n>] [--drain-ms <ms>]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (script.empty())
+    {
+        script = defaultScript();
+    }
+    if (rate == 0 || drainMs == 0)
+    {
+        fprintf(stderr, "rate and drain-ms must not be 0\n");
+        return 2;
+    }
+
+    HostAudioThread thread(TASK_QUEUE_SIZE);
+    I2cA2dp i2cA2dp(&thread.commands, EventI2c);
+    i2cA2dp.begin(I2C_DEV_ADDR);
+    i2cA2dp.setA2dpConnectionStatus(true);
+
+    I2cStatus::StatusRegister before;
+    I2cStatus::read(before);
+
+    std::chrono::nanoseconds busy(0), receive(0), receiveMax(0);
+    uint32_t posted = 0;
+    uint64_t nextDrainUs = drainMs * 1000;
+    for (uint32_t n = 0; n < count; n++)
+    {
+        // the simulated time of this command, the audio thread caught up until then
+        uint64_t nowUs = (uint64_t)n * 1000000 / rate;
+        while (nextDrainUs <= nowUs)
+        {
+            posted += thread.drain();
+            nextDrainUs += drainMs * 1000;
+        }
+
+        const I2cFrame &frame = script[n % script.size()];
+        uint8_t reply[I2cA2dp::MAX_REPLY_SIZE];
+        auto start = std::chrono::steady_clock::now();
+        Wire.masterWrite(frame.data(), frame.size());
+        auto received = std::chrono::steady_clock::now();
+        Wire.masterRead(reply, sizeof(reply));
+        auto end = std::chrono::steady_clock::now();
+
+        busy += end - start;
+        receive += received - start;
+        receiveMax = std::max(receiveMax, std::chrono::nanoseconds(received - start));
+    }
+    posted += thread.drain();
+
+    I2cStatus::StatusRegister status;
+    I2cStatus::read(status);
+    uint32_t errors = (uint16_t)(status.errorCount - before.errorCount);
+    uint32_t drops = (uint16_t)(status.dropCount - before.dropCount);
+
+    printf("script:       %u frames, %u commands at %u/s, drained every %ums\n", (unsigned)script.size(), count, rate, drainMs);
+    printf("posted:       %u messages to ThreadAudio\n", posted);
+    printf("errors:       %u replies Fail/ErrorInvalidCommand/ErrorInvalidParam\n", errors);
+    printf("dropped:      %u (queue or param pool full)\n", drops);
+    printf("throughput:   %.0f commands/s (write + read in wall time)\n", count / (busy.count() / 1e9));
+    printf("receive->post: avg %.0f ns, max %lld ns\n", (double)receive.count() / count, (long long)receiveMax.count());
+    return drops == 0 ? 0 : 1;
+}
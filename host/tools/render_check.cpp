@@ -0,0 +1,129 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+// Host build of the render check, see "../../src/debug/RenderCheck.h".
+//
+//   render_check                   renders all scenarios, fails if a hash differs from its golden one
+//   render_check --golden <file>   writes the golden header from the hashes of this build
+//   render_check --wav <dir>       writes the PCM of each scenario to <dir>/<scenario>.wav
+//   render_check --cues <file>     maps the cue bundle file as the "cues" partition first
+//
+// The golden header is regenerated after a change of the render path which is
+// not meant to be bit-exact, and committed with it:
+//
+//   cmake --build host/build --target render_check_golden
+#include <Arduino.h>
+#include <HostStubs.h>
+#include <ctype.h>
+#include "debug/RenderCheck.h"
+#include "data/SoundBuffer.h"
+#include "WavFile.h"
+
+static bool writeGolden(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "// generated by host/tools/render_check.cpp (render_check --golden), do not edit\n");
+    fprintf(file, "#pragma once\n");
+    fprintf(file, "#include <Arduino.h>\n\n");
+    fprintf(file, "// FNV-1a hash of the PCM of each RenderCheck scenario, in the order of the scenario table\n");
+    fprintf(file, "static const uint32_t renderCheckGolden[] = {\n");
+    for (size_t i = 0; i < RenderCheck::scenarioCount(); i++)
+    {
+        fprintf(file, "    0x%08x, // %s\n", RenderCheck::render(i).hash, RenderCheck::scenarioName(i));
+    }
+    fprintf(file, "};\n");
+    return fclose(file) == 0;
+}
+
+static bool writeWav(const char *dir)
+{
+    for (size_t i = 0; i < RenderCheck::scenarioCount(); i++)
+    {
+        // scenario names are file names once the separators are replaced
+        char name[64];
+        snprintf(name, sizeof(name), "%s", RenderCheck::scenarioName(i));
+        for (char *c = name; *c; c++)
+        {
+            *c = (isalnum((unsigned char)*c) || *c == '-') ? *c : '_';
+        }
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s.wav", dir, name);
+
+        WavFile wav;
+        if (!wav.open(path))
+        {
+            fprintf(stderr, "cannot write %s\n", path);
+            return false;
+        }
+        RenderCheck::Result result = RenderCheck::render(i, &wav);
+        if (!wav.close())
+        {
+            fprintf(stderr, "cannot write %s\n", path);
+            return false;
+        }
+        printf("%s: %u frames, hash=0x%08x\n", path, result.frames, result.hash);
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *golden = nullptr;
+    const char *wav = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc)
+        {
+            golden = argv[++i];
+        }
+        else if (strcmp(argv[i], "--wav") == 0 && i + 1 < argc)
+        {
+            wav = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cues") == 0 && i + 1 < argc)
+        {
+            if (!hostMapPartition("cues", argv[++i]))
+            {
+                fprintf(stderr, "cannot open %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--golden <file>] [--wav <dir>] [--cues <bundle>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (golden)
+    {
+        return writeGolden(golden) ? 0 : 1;
+    }
+    if (wav)
+    {
+        return writeWav(wav) ? 0 : 1;
+    }
+    return RenderCheck::run(Serial) ? 0 : 1;
+}
@@ -23,11 +23,23 @@
 #define LIB_MAJOR_VER 1
 #define LIB_MINOR_VER 0
 
+// Count heap allocations and report any made after init, see "./debug/HeapMonitor.h"
+// #define HEAP_MONITOR
+// Assert (instead of log) on operator new after init, the backtrace shows the offender
+// #define HEAP_MONITOR_ASSERT
+// Render golden scenarios at boot and compare the PCM hashes, see "./debug/RenderCheck.h"
+// #define RENDER_CHECK
+// Do not link the fallback cue bundle, the cues must be flashed to the "cues" partition, see "./data/CueStore.h"
+// #define CUE_PARTITION_ONLY
+
 #define dim(x) (sizeof(x) / sizeof(x[0]))
 #define sizeofarray(a) (sizeof(a) / sizeof(a[0]))
 
+// the host build ("./host") runs on 64-bit machines
+#ifndef HOST_BUILD
 static_assert(sizeof(void *) == sizeof(uint32_t), "sizeof(void *) == sizeof(uint32_t)");
 static_assert(sizeof(unsigned long) == sizeof(uint32_t), "sizeof(unsigned long) == sizeof(uint32_t)");
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef STR_INDIR
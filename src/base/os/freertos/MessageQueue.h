@@ -45,7 +45,8 @@ public:
         _queue = nullptr;
     }
 
-    void postEvent(MessageQueue *msgQueue, int16_t event, int16_t iParam = 0, uint16_t uParam = 0, uint32_t lParam = 0L, TickType_t xTicksToWait = 0)
+    // returns false if the message could not be queued
+    bool postEvent(MessageQueue *msgQueue, int16_t event, int16_t iParam = 0, uint16_t uParam = 0, uint32_t lParam = 0L, TickType_t xTicksToWait = 0)
     {
         Message msg = {
             .event = event,
@@ -53,17 +54,19 @@ public:
             .uParam = uParam,
             .lParam = lParam,
         };
-        postEvent(msgQueue, msg);
+        return postEvent(msgQueue, msg, xTicksToWait);
     }
-    void postEvent(MessageQueue *msgQueue, const Message &msg, TickType_t xTicksToWait = 0)
+    bool postEvent(MessageQueue *msgQueue, const Message &msg, TickType_t xTicksToWait = 0)
     {
+        bool result = false;
         if (msgQueue && msgQueue->_queue)
         {
             if (xPortInIsrContext())
             // if (xPortIsInsideInterrupt())
             {
                 BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-                if (xQueueSendFromISR(msgQueue->_queue, &msg, &xHigherPriorityTaskWoken) != pdTRUE)
+                result = (xQueueSendFromISR(msgQueue->_queue, &msg, &xHigherPriorityTaskWoken) == pdTRUE);
+                if (!result)
                 {
                     // LOG_ERROR("xQueueSend failed!");
                 }
@@ -71,22 +74,24 @@ public:
             }
             else
             {
-                if (xQueueSend(msgQueue->_queue, &msg, xTicksToWait) != pdTRUE)
+                result = (xQueueSend(msgQueue->_queue, &msg, xTicksToWait) == pdTRUE);
                 // if (xQueueSend(msgQueue->queue, &msg, portMAX_DELAY) != pdTRUE)
+                if (!result)
                 {
                     // LOG_ERROR("xQueueSend failed!");
                 }
             }
         }
+        return result;
     }
 
-    inline void postEvent(int16_t event, int16_t iParam = 0, uint16_t uParam = 0, uint32_t lParam = 0L, TickType_t xTicksToWait = 0)
+    inline bool postEvent(int16_t event, int16_t iParam = 0, uint16_t uParam = 0, uint32_t lParam = 0L, TickType_t xTicksToWait = 0)
     {
-        postEvent(this, event, iParam, uParam, lParam, xTicksToWait);
+        return postEvent(this, event, iParam, uParam, lParam, xTicksToWait);
     }
-    inline void postEvent(const Message &msg, TickType_t xTicksToWait = 0)
+    inline bool postEvent(const Message &msg, TickType_t xTicksToWait = 0)
     {
-        postEvent(this, msg, xTicksToWait);
+        return postEvent(this, msg, xTicksToWait);
     }
 
     inline QueueHandle_t queue(void)
@@ -0,0 +1,155 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../../type/Message.h"
+
+// Fixed table of one-shot/periodic timers owned by a thread.
+// Expired timers are returned as ordinary Messages by poll(), so the owning
+// thread handles them in its own message loop instead of the FreeRTOS timer
+// daemon. No heap is used. Not thread safe: call from the owning thread only.
+template <uint8_t SIZE>
+class MessageTimer
+{
+public:
+    MessageTimer()
+    {
+        memset(_timer, 0, sizeof(_timer));
+    }
+
+    // starts (or restarts) the timer identified by msg.event
+    bool start(const Message &msg, TickType_t period, bool periodic, TickType_t now)
+    {
+        Timer *timer = find(msg.event);
+        if (timer == nullptr)
+        {
+            timer = findFree();
+        }
+        if (timer == nullptr)
+        {
+            return false;
+        }
+
+        timer->msg = msg;
+        timer->period = period;
+        timer->expiry = now + period;
+        timer->periodic = periodic;
+        timer->active = true;
+        return true;
+    }
+
+    void stop(int16_t event)
+    {
+        Timer *timer = find(event);
+        if (timer)
+        {
+            timer->active = false;
+        }
+    }
+
+    bool isActive(int16_t event)
+    {
+        return find(event) != nullptr;
+    }
+
+    // ticks until the nearest expiry, portMAX_DELAY if no timer is active
+    TickType_t ticksToWait(TickType_t now) const
+    {
+        TickType_t result = portMAX_DELAY;
+        for (int i = 0; i < SIZE; i++)
+        {
+            const Timer &timer = _timer[i];
+            if (timer.active)
+            {
+                int32_t remaining = (int32_t)(timer.expiry - now);
+                if (remaining <= 0)
+                {
+                    return 0;
+                }
+                result = std::min(result, (TickType_t)remaining);
+            }
+        }
+        return result;
+    }
+
+    // pops one expired timer into msg, returns false if none has expired
+    bool poll(TickType_t now, Message &msg)
+    {
+        for (int i = 0; i < SIZE; i++)
+        {
+            Timer &timer = _timer[i];
+            if (timer.active && (int32_t)(now - timer.expiry) >= 0)
+            {
+                msg = timer.msg;
+                if (timer.periodic)
+                {
+                    // keep the phase, but do not burst if we fell behind by more than a period
+                    timer.expiry += timer.period;
+                    if ((int32_t)(now - timer.expiry) >= 0)
+                    {
+                        timer.expiry = now + timer.period;
+                    }
+                }
+                else
+                {
+                    timer.active = false;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    typedef struct _Timer
+    {
+        Message msg;
+        TickType_t period;
+        TickType_t expiry;
+        bool periodic;
+        bool active;
+    } Timer;
+
+    Timer _timer[SIZE];
+
+    Timer *find(int16_t event)
+    {
+        for (int i = 0; i < SIZE; i++)
+        {
+            if (_timer[i].active && _timer[i].msg.event == event)
+            {
+                return &_timer[i];
+            }
+        }
+        return nullptr;
+    }
+
+    Timer *findFree(void)
+    {
+        for (int i = 0; i < SIZE; i++)
+        {
+            if (!_timer[i].active)
+            {
+                return &_timer[i];
+            }
+        }
+        return nullptr;
+    }
+};
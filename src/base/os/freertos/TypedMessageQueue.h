@@ -0,0 +1,94 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../../type/MessageVariant.h"
+#include "../../type/BlockPool.h"
+
+// MessageQueue for any trivially copyable message type, typically a
+// MessageVariant<...> carrying typed payloads inline, e.g. the I2C commands
+// posted to ThreadAudio (I2cA2dp::CommandQueue):
+//
+//   typedef MessageVariant<I2cA2dp::Frame, PoolBlock> CommandMessage;
+//   static uint8_t storage[32 * sizeof(CommandMessage)];
+//   static StaticQueue_t queueBuffer;
+//   TypedMessageQueue<CommandMessage> queue(32, storage, &queueBuffer);
+//
+// Inline payloads are copied once into the queue storage and once out of it.
+// Data larger than the inline payload lives in a BlockPool: only the PoolBlock
+// handle is queued, so the block contents are never copied, and ownership of
+// the block moves to the receiver, which must release() it.
+template <typename MessageType>
+class TypedMessageQueue
+{
+public:
+    static_assert(std::is_trivially_copyable<MessageType>::value, "MessageType must be trivially copyable");
+
+    TypedMessageQueue(uint16_t queueLength,
+                      uint8_t *pucQueueStorageBuffer = nullptr,
+                      StaticQueue_t *pxQueueBuffer = nullptr)
+    {
+        if (pucQueueStorageBuffer != nullptr && pxQueueBuffer != nullptr)
+        {
+            _queue = xQueueCreateStatic(queueLength, sizeof(MessageType), pucQueueStorageBuffer, pxQueueBuffer);
+        }
+        else
+        {
+            _queue = xQueueCreate(queueLength, sizeof(MessageType));
+        }
+        configASSERT(_queue != NULL);
+    }
+
+    ~TypedMessageQueue()
+    {
+        vQueueDelete(_queue);
+        _queue = nullptr;
+    }
+
+    // returns false if the queue is full; the caller then still owns any pool block in msg
+    bool post(const MessageType &msg, TickType_t xTicksToWait = 0)
+    {
+        bool result;
+        if (xPortInIsrContext())
+        {
+            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            result = xQueueSendFromISR(_queue, &msg, &xHigherPriorityTaskWoken) == pdTRUE;
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        }
+        else
+        {
+            result = xQueueSend(_queue, &msg, xTicksToWait) == pdTRUE;
+        }
+        return result;
+    }
+
+    bool receive(MessageType &msg, TickType_t xTicksToWait = portMAX_DELAY)
+    {
+        return xQueueReceive(_queue, (void *)&msg, xTicksToWait) == pdTRUE;
+    }
+
+    inline QueueHandle_t queue(void)
+    {
+        return _queue;
+    }
+
+protected:
+    QueueHandle_t _queue;
+};
@@ -20,10 +20,16 @@
 #pragma once
 #include <Arduino.h>
 #include "../MessageQueue.h"
+#include "../MessageTimer.h"
 
 class ThreadBase : public MessageQueue
 {
 public:
+    static const uint8_t TIMER_SIZE = 4; // max number of active timers per thread
+
+    // events below 0 are reserved for ThreadBase
+    static const int16_t EventDelayInit = -1;
+
     ThreadBase(uint16_t queueLength,
                uint8_t *pucQueueStorageBuffer = nullptr,
                StaticQueue_t *pxQueueBuffer = nullptr) : MessageQueue(queueLength, pucQueueStorageBuffer, pxQueueBuffer),
@@ -49,14 +55,21 @@ public:
     virtual void messageLoop(TickType_t xTicksToWait = portMAX_DELAY)
     {
         Message msg;
+        // wake up no later than the nearest timer expiry
+        xTicksToWait = std::min(xTicksToWait, _timer.ticksToWait(xTaskGetTickCount()));
         if (xQueueReceive(_queue, (void *)&msg, xTicksToWait) == pdTRUE)
         {
-            onMessage(msg);
+            dispatchMessage(msg);
         }
         else
         {
             // LOG_TRACE("xQueueReceive() timeout");
         }
+
+        while (_timer.poll(xTaskGetTickCount(), msg))
+        {
+            dispatchMessage(msg);
+        }
     }
 
     virtual void messageLoopForever(void)
@@ -82,23 +95,52 @@ public:
         return _context;
     }
 
+    TaskHandle_t taskHandle(void)
+    {
+        return _taskHandle;
+    }
+
+    // The timer posts "event" to this thread after "ms", once or periodically.
+    // Starting an active timer again restarts it. Call from this thread only.
+    bool startTimer(int16_t event, uint32_t ms, bool periodic = false, int16_t iParam = 0, uint16_t uParam = 0, uint32_t lParam = 0L)
+    {
+        Message msg = {
+            .event = event,
+            .iParam = iParam,
+            .uParam = uParam,
+            .lParam = lParam,
+        };
+        return _timer.start(msg, pdMS_TO_TICKS(ms), periodic, xTaskGetTickCount());
+    }
+
+    void stopTimer(int16_t event)
+    {
+        _timer.stop(event);
+    }
+
 protected:
     virtual void setup(void)
     {
-        BaseType_t result = xTimerPendFunctionCall(
-            [](void *param1, uint32_t param2)
-            {
-                // LOG_TRACE("xTimerPendFunctionCall()");
-                static_cast<ThreadBase *>(param1)->delayInit();
-            },
-            this,        // param1
-            (uint32_t)0, // param2
-            pdMS_TO_TICKS(200));
-        // LOG_TRACE("xTimerPendFunctionCall() returns ", result);
+        bool result = startTimer(EventDelayInit, 200);
+        configASSERT(result);
     }
     virtual void delayInit(void) {}
 
+    void dispatchMessage(const Message &msg)
+    {
+        if (msg.event == EventDelayInit)
+        {
+            delayInit();
+        }
+        else
+        {
+            onMessage(msg);
+        }
+    }
+
     void *_context;
     TaskHandle_t _taskHandle;
     bool _taskDone;
+
+    MessageTimer<TIMER_SIZE> _timer;
 };
\ No newline at end of file
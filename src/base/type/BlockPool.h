@@ -0,0 +1,106 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// Fixed-block pool with explicit ownership.
+// alloc() hands a block to the caller, who owns it until it either calls
+// release() or passes the handle to another task (e.g. in a message), which
+// then owns it. alloc()/release() are lock-free and safe from ISR and tasks
+// on both cores. No heap is used.
+template <uint16_t BLOCK_SIZE, uint8_t BLOCK_COUNT>
+class BlockPool
+{
+public:
+    static_assert(BLOCK_COUNT > 0 && BLOCK_COUNT <= 32, "BLOCK_COUNT must be within 1..32");
+
+    typedef uint8_t Handle;               // 1..BLOCK_COUNT
+    static const Handle InvalidHandle = 0;
+
+    BlockPool() : _freeMask(BLOCK_COUNT == 32 ? 0xffffffffUL : ((1UL << BLOCK_COUNT) - 1)) {}
+
+    // returns InvalidHandle if the pool is exhausted
+    Handle alloc(void)
+    {
+        uint32_t mask = _freeMask.load(std::memory_order_relaxed);
+        while (mask)
+        {
+            uint32_t bit = mask & (~mask + 1); // lowest free block
+            if (_freeMask.compare_exchange_weak(mask, mask & ~bit, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return (Handle)(__builtin_ctz(bit) + 1);
+            }
+        }
+        return InvalidHandle;
+    }
+
+    void release(Handle handle)
+    {
+        if (isValid(handle))
+        {
+            uint32_t bit = 1UL << (handle - 1);
+            uint32_t previous = _freeMask.fetch_or(bit, std::memory_order_release);
+            configASSERT((previous & bit) == 0); // double release
+        }
+    }
+
+    uint8_t *data(Handle handle)
+    {
+        return isValid(handle) ? _block[handle - 1] : nullptr;
+    }
+
+    // handle of the block starting at ptr, InvalidHandle if ptr is not a block of this pool
+    Handle handleOf(const void *ptr) const
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(ptr);
+        if (p < _block[0] || p > _block[BLOCK_COUNT - 1] || (p - _block[0]) % BLOCK_SIZE)
+        {
+            return InvalidHandle;
+        }
+        return (Handle)((p - _block[0]) / BLOCK_SIZE + 1);
+    }
+
+    bool isValid(Handle handle) const
+    {
+        return handle != InvalidHandle && handle <= BLOCK_COUNT;
+    }
+
+    uint8_t available(void) const
+    {
+        return __builtin_popcount(_freeMask.load(std::memory_order_relaxed));
+    }
+
+    static constexpr uint16_t blockSize(void)
+    {
+        return BLOCK_SIZE;
+    }
+
+private:
+    alignas(4) uint8_t _block[BLOCK_COUNT][BLOCK_SIZE];
+    std::atomic<uint32_t> _freeMask;
+};
+
+// payload describing a pool block in flight; the receiver owns the block
+typedef struct _PoolBlock
+{
+    uint8_t handle;
+    uint16_t length; // number of valid bytes in the block
+} PoolBlock;
@@ -0,0 +1,117 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <type_traits>
+
+namespace message_variant
+{
+    // largest sizeof / alignof among Types
+    template <typename... Types>
+    struct Max;
+
+    template <typename T>
+    struct Max<T>
+    {
+        static const size_t size = sizeof(T);
+        static const size_t align = alignof(T);
+    };
+
+    template <typename T, typename... Types>
+    struct Max<T, Types...>
+    {
+        static const size_t size = sizeof(T) > Max<Types...>::size ? sizeof(T) : Max<Types...>::size;
+        static const size_t align = alignof(T) > Max<Types...>::align ? alignof(T) : Max<Types...>::align;
+    };
+
+    // 1-based position of T in Types, 0 if T is not one of Types
+    template <typename T, typename... Types>
+    struct Index;
+
+    template <typename T>
+    struct Index<T>
+    {
+        static const uint8_t value = 0;
+    };
+
+    template <typename T, typename... Types>
+    struct Index<T, T, Types...>
+    {
+        static const uint8_t value = 1;
+    };
+
+    template <typename T, typename U, typename... Types>
+    struct Index<T, U, Types...>
+    {
+        static const uint8_t value = Index<T, Types...>::value ? Index<T, Types...>::value + 1 : 0;
+    };
+}
+
+// A message whose payload is one of Types, stored inline.
+// The payload types must be trivially copyable since the FreeRTOS queue copies
+// the whole message by value; larger data goes into a BlockPool block and only
+// the block handle travels in the message.
+template <typename... Types>
+class MessageVariant
+{
+public:
+    static const uint8_t TypeNone = 0;
+
+    int16_t event;
+
+    MessageVariant() : event(0), _type(TypeNone) {}
+
+    template <typename T>
+    MessageVariant(int16_t event, const T &payload) : event(event)
+    {
+        set(payload);
+    }
+
+    template <typename T>
+    void set(const T &payload)
+    {
+        static_assert(message_variant::Index<T, Types...>::value != TypeNone, "T is not a payload type of this MessageVariant");
+        static_assert(std::is_trivially_copyable<T>::value, "payload must be trivially copyable");
+        memcpy(_payload, &payload, sizeof(T));
+        _type = message_variant::Index<T, Types...>::value;
+    }
+
+    template <typename T>
+    bool is(void) const
+    {
+        return _type != TypeNone && _type == message_variant::Index<T, Types...>::value;
+    }
+
+    // returns nullptr if the payload is not a T
+    template <typename T>
+    const T *get(void) const
+    {
+        return is<T>() ? reinterpret_cast<const T *>(_payload) : nullptr;
+    }
+
+    uint8_t type(void) const
+    {
+        return _type;
+    }
+
+private:
+    uint8_t _type;
+    alignas(message_variant::Max<Types...>::align) uint8_t _payload[message_variant::Max<Types...>::size];
+};
@@ -0,0 +1,92 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "AdpcmSoundData.h"
+
+static const int16_t stepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t indexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static_assert(sizeof(AdpcmSoundData::AdpcmBlockHeader) == 4 && AdpcmSoundData::BLOCK_SIZE % 4 == 0, "blocks must stay word aligned");
+
+void AdpcmSoundData::setBlocks(const uint8_t *blocks, uint32_t size)
+{
+    _blocks = blocks;
+    _blockCount = size / BLOCK_SIZE;
+    _cachedBlock = -1;
+}
+
+int32_t AdpcmSoundData::getData(int32_t pos, Frame &frame)
+{
+    int32_t block = pos / BLOCK_SAMPLES;
+    if (pos < 0 || block >= _blockCount)
+    {
+        frame.channel1 = 0;
+    }
+    else
+    {
+        if (block != _cachedBlock)
+        {
+            decodeBlock(block);
+        }
+        frame.channel1 = _cache[pos % BLOCK_SAMPLES];
+    }
+    frame.channel2 = frame.channel1;
+    return 1;
+}
+
+void AdpcmSoundData::decodeBlock(int32_t block)
+{
+    const uint8_t *ptr = _blocks + block * BLOCK_SIZE;
+    const AdpcmBlockHeader *header = (const AdpcmBlockHeader *)ptr;
+    int32_t predictor = header->predictor;
+    int32_t index = std::min<int32_t>(header->index, 88);
+    ptr += sizeof(AdpcmBlockHeader);
+
+    for (int32_t i = 0; i < BLOCK_SAMPLES; i++)
+    {
+        uint8_t nibble = (i & 1) ? (ptr[i >> 1] >> 4) : (ptr[i >> 1] & 0x0f);
+        int32_t step = stepTable[index];
+        int32_t diff = step >> 3;
+        if (nibble & 4)
+        {
+            diff += step;
+        }
+        if (nibble & 2)
+        {
+            diff += step >> 1;
+        }
+        if (nibble & 1)
+        {
+            diff += step >> 2;
+        }
+        predictor += (nibble & 8) ? -diff : diff;
+        predictor = std::min<int32_t>(INT16_MAX, std::max<int32_t>(INT16_MIN, predictor));
+        index = std::min<int32_t>(88, std::max<int32_t>(0, index + indexTable[nibble & 7]));
+
+        // 16-bit sample to the scale of OneChannel8BitSoundData (8-bit sample * 127)
+        _cache[i] = (int16_t)((predictor * 127) >> 8);
+    }
+    _cachedBlock = block;
+}
@@ -0,0 +1,63 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+
+// Cue stored as 4-bit IMA-ADPCM, half the size of 8-bit PCM. The samples are
+// coded in fixed size blocks, each starting with the decoder state, so the
+// block of any position is found (and decoded) without decoding from the
+// start: the block headers are the seek table. A whole block is decoded at a
+// time into a cache; as SoundBuffer reads sequentially, each block is decoded
+// once per pass. Only for the audio callback (one reader at a time).
+class AdpcmSoundData : public OneChannel8BitSoundData
+{
+public:
+    static const int32_t BLOCK_SAMPLES = 256;
+    static const int32_t BLOCK_SIZE = 4 + BLOCK_SAMPLES / 2; // header + 2 samples per byte
+
+    typedef struct __attribute__((packed)) _AdpcmBlockHeader
+    {
+        int16_t predictor; // decoder state before the first sample of the block
+        uint8_t index;     // step index, 0..88
+        uint8_t reserved;
+    } AdpcmBlockHeader;
+
+    AdpcmSoundData() : OneChannel8BitSoundData(true), _blocks(nullptr), _blockCount(0), _cachedBlock(-1) {}
+
+    // blocks as written by tools/asset_compiler.py --format adpcm, size in bytes
+    void setBlocks(const uint8_t *blocks, uint32_t size);
+
+    // same output scale as OneChannel8BitSoundData; silence past the last block
+    virtual int32_t getData(int32_t pos, Frame &frame);
+
+    int32_t sampleCount(void) const
+    {
+        return _blockCount * BLOCK_SAMPLES;
+    }
+
+private:
+    const uint8_t *_blocks;
+    int32_t _blockCount;
+    int32_t _cachedBlock;
+    int16_t _cache[BLOCK_SAMPLES]; // frame values of _cachedBlock
+
+    void decodeBlock(int32_t block);
+};
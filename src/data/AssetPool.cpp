@@ -0,0 +1,136 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "AssetPool.h"
+
+AssetPool::SlabPool AssetPool::_slabPool;
+AssetPool::Upload AssetPool::_upload[MAX_ASSETS];
+AssetSoundData AssetPool::_asset[MAX_ASSETS];
+AssetPool::Retired AssetPool::_retired[SLAB_COUNT];
+std::atomic<uint32_t> AssetPool::_renderEpoch(0);
+
+int32_t AssetSoundData::getData(int32_t pos, Frame &frame)
+{
+    uint32_t word = _active.load(std::memory_order_acquire);
+    const int8_t *data = AssetPool::slab(handleOf(word));
+    if (data && pos < (int32_t)(word & 0xffff))
+    {
+        frame.channel1 = SampleS8::toLevel(data[pos]);
+    }
+    else
+    {
+        frame.channel1 = 0;
+    }
+    frame.channel2 = frame.channel1;
+    return 1;
+}
+
+bool AssetPool::begin(uint8_t id, uint16_t sampleRate, uint16_t length)
+{
+    if (id >= MAX_ASSETS || sampleRate != SAMPLE_RATE || length == 0 || length > SLAB_SIZE)
+    {
+        return false;
+    }
+
+    reclaim();
+    Upload &upload = _upload[id];
+    if (upload.handle == SlabPool::InvalidHandle)
+    {
+        upload.handle = _slabPool.alloc();
+        if (upload.handle == SlabPool::InvalidHandle)
+        {
+            return false;
+        }
+    }
+    upload.length = length;
+    return true;
+}
+
+bool AssetPool::write(uint8_t id, uint16_t offset, const uint8_t *data, size_t len)
+{
+    if (id >= MAX_ASSETS)
+    {
+        return false;
+    }
+
+    Upload &upload = _upload[id];
+    if (upload.handle == SlabPool::InvalidHandle || offset + len > upload.length)
+    {
+        return false;
+    }
+    memcpy(_slabPool.data(upload.handle) + offset, data, len);
+    return true;
+}
+
+bool AssetPool::commit(uint8_t id, uint8_t crc)
+{
+    if (id >= MAX_ASSETS)
+    {
+        return false;
+    }
+
+    Upload &upload = _upload[id];
+    if (upload.handle == SlabPool::InvalidHandle || I2cParam::crc8(_slabPool.data(upload.handle), upload.length) != crc)
+    {
+        return false;
+    }
+
+    uint32_t previous = _asset[id].publish(upload.handle, upload.length);
+    upload.handle = SlabPool::InvalidHandle;
+    if (AssetSoundData::handleOf(previous) != SlabPool::InvalidHandle)
+    {
+        retire(AssetSoundData::handleOf(previous));
+    }
+    reclaim();
+    return true;
+}
+
+// the audio callback may still read the slab in the block it is rendering
+void AssetPool::retire(SlabPool::Handle handle)
+{
+    // pairs with the fence of enterRender(): either the epoch read here shows the
+    // block, or the block reads the word published before
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t epoch = _renderEpoch.load(std::memory_order_relaxed);
+    for (uint8_t i = 0; i < SLAB_COUNT; i++)
+    {
+        if (_retired[i].handle == SlabPool::InvalidHandle)
+        {
+            _retired[i].handle = handle;
+            _retired[i].epoch = epoch;
+            return;
+        }
+    }
+    configASSERT(false); // a slab is retired once, there is an entry for each
+}
+
+// returns the retired slabs the audio callback is done with to the pool
+void AssetPool::reclaim(void)
+{
+    uint32_t epoch = _renderEpoch.load(std::memory_order_acquire);
+    for (uint8_t i = 0; i < SLAB_COUNT; i++)
+    {
+        Retired &retired = _retired[i];
+        if (retired.handle != SlabPool::InvalidHandle && ((retired.epoch & 1) == 0 || retired.epoch != epoch))
+        {
+            _slabPool.release(retired.handle);
+            retired.handle = SlabPool::InvalidHandle;
+        }
+    }
+}
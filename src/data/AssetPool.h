@@ -0,0 +1,130 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+#include "../base/type/BlockPool.h"
+#include "./SampleFormat.h"
+#include "../peripheral/i2c/I2cParam.h"
+
+// Sound clip uploaded at run time. The slab and the length are published in one
+// word, so a commit takes effect at the next sample read by the audio callback.
+// Reads past the end of the clip (or before the first commit) return silence.
+class AssetSoundData : public OneChannel8BitSoundData
+{
+public:
+    AssetSoundData() : OneChannel8BitSoundData(true), _active(0) {}
+
+    virtual int32_t getData(int32_t pos, Frame &frame);
+
+    // returns the previously published word
+    uint32_t publish(uint8_t handle, uint16_t length)
+    {
+        return _active.exchange(((uint32_t)handle << 16) | length, std::memory_order_release);
+    }
+
+    static uint8_t handleOf(uint32_t word)
+    {
+        return (uint8_t)(word >> 16);
+    }
+
+private:
+    std::atomic<uint32_t> _active; // slab handle << 16 | length
+};
+
+// Fixed pool of cue assets uploaded over I2C (AssetBegin/AssetChunk/AssetCommit).
+// Every asset fits one slab of one SoundBuffer slot (0.1s of 8-bit mono PCM), so
+// the slabs are interchangeable and the pool cannot fragment. An upload fills a
+// spare slab (B) while the committed one (A) keeps playing, commit swaps them and
+// retires A. There are two spare slabs, i.e. two uploads may be in progress at
+// the same time.
+// A retired slab goes back to the pool once the audio callback no longer reads
+// it: the callback brackets each block with enterRender()/exitRender(), a slab
+// retired while no block was rendered is free at once, else after that block.
+// begin()/write()/commit() must be called from one context (the Wire callback).
+class AssetPool
+{
+public:
+    static const uint8_t MAX_ASSETS = I2cParam::MAX_ASSETS;
+    static const uint8_t SLAB_COUNT = MAX_ASSETS + 2;
+    static const uint16_t SLAB_SIZE = 4410; // SoundBuffer::SAMPLING_PER_SLOT
+    static const uint16_t SAMPLE_RATE = 44100;
+
+    typedef BlockPool<SLAB_SIZE, SLAB_COUNT> SlabPool;
+
+    // starts (or restarts) the upload of asset id, allocates its B slab
+    static bool begin(uint8_t id, uint16_t sampleRate, uint16_t length);
+    static bool write(uint8_t id, uint16_t offset, const uint8_t *data, size_t len);
+    // publishes the uploaded data if crc (I2cParam::crc8) matches
+    static bool commit(uint8_t id, uint8_t crc);
+
+    // stable pointer, valid before the first commit (plays silence)
+    static OneChannel8BitSoundData *soundData(uint8_t id)
+    {
+        return (id < MAX_ASSETS) ? &_asset[id] : nullptr;
+    }
+
+    static const int8_t *slab(uint8_t handle)
+    {
+        return reinterpret_cast<const int8_t *>(_slabPool.data(handle));
+    }
+
+    // called by the audio callback before and after it renders a block, the
+    // epoch is odd while a block is rendered
+    static void enterRender(void)
+    {
+        _renderEpoch.fetch_add(1, std::memory_order_relaxed);
+        // orders the epoch before the reads of the published words, see commit()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+    static void exitRender(void)
+    {
+        _renderEpoch.fetch_add(1, std::memory_order_release);
+    }
+
+    // number of slabs in the pool, for tests
+    static uint8_t available(void)
+    {
+        return _slabPool.available();
+    }
+
+private:
+    typedef struct _Upload
+    {
+        SlabPool::Handle handle;
+        uint16_t length;
+    } Upload;
+
+    typedef struct _Retired
+    {
+        SlabPool::Handle handle; // SlabPool::InvalidHandle if the entry is free
+        uint32_t epoch;          // _renderEpoch when the slab was retired
+    } Retired;
+
+    static void retire(SlabPool::Handle handle);
+    static void reclaim(void);
+
+    static SlabPool _slabPool;
+    static Upload _upload[MAX_ASSETS];
+    static AssetSoundData _asset[MAX_ASSETS];
+    static Retired _retired[SLAB_COUNT];
+    static std::atomic<uint32_t> _renderEpoch;
+};
@@ -0,0 +1,1886 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "./CueBundleDef.h"
+
+// generated by tools/asset_compiler.py, do not edit:
+// python3 tools/asset_compiler.py --header src/data/CueBundle.h 1=src/data/off-mono-i8.h 2=src/data/bright-mono-i8.h 3=src/data/beep-mono-i8.h 4=src/data/bell-mono-i8.h 5=src/data/saturday-mono-i8.h
+
+static constexpr CueBundleEntry cueBundleIndex[] = {
+    {1, CueFormatS8, 0, 44100, 88, 4410},
+    {2, CueFormatS8, 0, 44100, 4500, 4410},
+    {3, CueFormatS8, 0, 44100, 8912, 4410},
+    {4, CueFormatS8, 0, 44100, 13324, 4410},
+    {5, CueFormatS8, 0, 44100, 17736, 4410}};
+
+static_assert(cueFitsSlot(cueBundleIndex[0]), "cue 1 does not fill one slot");
+static_assert(cueFitsSlot(cueBundleIndex[1]), "cue 2 does not fill one slot");
+static_assert(cueFitsSlot(cueBundleIndex[2]), "cue 3 does not fill one slot");
+static_assert(cueFitsSlot(cueBundleIndex[3]), "cue 4 does not fill one slot");
+static_assert(cueFitsSlot(cueBundleIndex[4]), "cue 5 does not fill one slot");
+
+alignas(CUE_BUNDLE_ALIGN) static const uint8_t cueBundleData[] = {
+    0x43, 0x55, 0x45, 0x42, 0x01, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x44, 0xac, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3a, 0x11, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x44, 0xac, 0x00, 0x00, 0x94, 0x11, 0x00, 0x00,
+    0x3a, 0x11, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x44, 0xac, 0x00, 0x00,
+    0xd0, 0x22, 0x00, 0x00, 0x3a, 0x11, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x44, 0xac, 0x00, 0x00, 0x0c, 0x34, 0x00, 0x00, 0x3a, 0x11, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x44, 0xac, 0x00, 0x00, 0x48, 0x45, 0x00, 0x00,
+    0x3a, 0x11, 0x00, 0x00, 0x00, 0xff, 0x01, 0x0e, 0x1c, 0x25, 0x2c, 0x2e,
+    0x2c, 0x25, 0x1b, 0x0f, 0x03, 0xf6, 0xed, 0xe6, 0xe3, 0xe3, 0xe6, 0xed,
+    0xf5, 0xfd, 0x04, 0x0a, 0x0e, 0x0e, 0x0c, 0x08, 0x02, 0xfb, 0xf4, 0xef,
+    0xec, 0xeb, 0xed, 0xf1, 0xf7, 0xff, 0x06, 0x0d, 0x13, 0x16, 0x18, 0x17,
+    0x13, 0x0e, 0x08, 0x02, 0xfd, 0xf8, 0xf5, 0xf4, 0xf4, 0xf6, 0xf8, 0xfb,
+    0xfd, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf5, 0xf2, 0xf0, 0xf0, 0xf1, 0xf5,
+    0xfa, 0x01, 0x09, 0x11, 0x18, 0x1e, 0x21, 0x21, 0x1e, 0x18, 0x0f, 0x05,
+    0xfb, 0xf1, 0xe8, 0xe2, 0xdf, 0xdf, 0xe1, 0xe7, 0xee, 0xf6, 0xff, 0x07,
+    0x0d, 0x11, 0x13, 0x12, 0x0f, 0x0a, 0x05, 0xff, 0xfa, 0xf6, 0xf4, 0xf4,
+    0xf6, 0xfa, 0xff, 0x04, 0x09, 0x0e, 0x11, 0x13, 0x12, 0x10, 0x0c, 0x07,
+    0x01, 0xfa, 0xf4, 0xef, 0xeb, 0xe9, 0xe8, 0xe8, 0xeb, 0xee, 0xf2, 0xf7,
+    0xfd, 0x02, 0x07, 0x0b, 0x0f, 0x12, 0x14, 0x15, 0x15, 0x14, 0x12, 0x0e,
+    0x0a, 0x06, 0x01, 0xfc, 0xf7, 0xf2, 0xef, 0xed, 0xec, 0xec, 0xee, 0xf1,
+    0xf4, 0xf9, 0xfd, 0x01, 0x05, 0x07, 0x09, 0x09, 0x08, 0x07, 0x04, 0x02,
+    0x00, 0xff, 0xfe, 0xfe, 0x00, 0x01, 0x04, 0x06, 0x08, 0x0a, 0x0a, 0x0a,
+    0x08, 0x05, 0x02, 0xfe, 0xf9, 0xf6, 0xf2, 0xf0, 0xef, 0xef, 0xf0, 0xf3,
+    0xf5, 0xf8, 0xfb, 0xfe, 0x01, 0x03, 0x04, 0x06, 0x07, 0x08, 0x0a, 0x0b,
+    0x0d, 0x0e, 0x10, 0x10, 0x10, 0x0f, 0x0c, 0x07, 0x02, 0xfb, 0xf4, 0xed,
+    0xe7, 0xe3, 0xe1, 0xe1, 0xe4, 0xe9, 0xf0, 0xf9, 0x03, 0x0c, 0x14, 0x1a,
+    0x1d, 0x1d, 0x1a, 0x14, 0x0d, 0x04, 0xfc, 0xf4, 0xee, 0xeb, 0xeb, 0xef,
+    0xf4, 0xfb, 0x04, 0x0b, 0x12, 0x16, 0x17, 0x15, 0x10, 0x08, 0xfe, 0xf4,
+    0xea, 0xe2, 0xdc, 0xda, 0xdc, 0xe1, 0xea, 0xf5, 0x01, 0x0d, 0x18, 0x20,
+    0x25, 0x26, 0x24, 0x1f, 0x17, 0x0d, 0x03, 0xfa, 0xf2, 0xed, 0xea, 0xea,
+    0xec, 0xf0, 0xf5, 0xfa, 0xfe, 0x01, 0x02, 0x02, 0xff, 0xfc, 0xf9, 0xf6,
+    0xf4, 0xf3, 0xf5, 0xf8, 0xfe, 0x04, 0x0b, 0x11, 0x16, 0x19, 0x1a, 0x18,
+    0x13, 0x0c, 0x04, 0xfb, 0xf3, 0xed, 0xe9, 0xe8, 0xe9, 0xee, 0xf4, 0xfb,
+    0x02, 0x09, 0x0d, 0x0f, 0x0f, 0x0b, 0x05, 0xfe, 0xf6, 0xee, 0xe9, 0xe6,
+    0xe6, 0xea, 0xf1, 0xfa, 0x06, 0x11, 0x1c, 0x24, 0x29, 0x2a, 0x27, 0x20,
+    0x15, 0x08, 0xfb, 0xed, 0xe1, 0xd9, 0xd4, 0xd3, 0xd6, 0xdd, 0xe7, 0xf3,
+    0xff, 0x0a, 0x13, 0x19, 0x1c, 0x1c, 0x18, 0x13, 0x0c, 0x05, 0xfe, 0xf9,
+    0xf6, 0xf4, 0xf5, 0xf8, 0xfc, 0x01, 0x06, 0x09, 0x0c, 0x0c, 0x0b, 0x07,
+    0x03, 0xfe, 0xf8, 0xf4, 0xf0, 0xee, 0xed, 0xee, 0xf1, 0xf5, 0xf9, 0xfd,
+    0x01, 0x05, 0x07, 0x08, 0x08, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07,
+    0x09, 0x0a, 0x0b, 0x0b, 0x0a, 0x08, 0x04, 0x00, 0xfa, 0xf4, 0xef, 0xea,
+    0xe6, 0xe5, 0xe5, 0xe8, 0xec, 0xf2, 0xfa, 0x02, 0x09, 0x10, 0x15, 0x19,
+    0x1a, 0x19, 0x16, 0x12, 0x0c, 0x06, 0x00, 0xfb, 0xf7, 0xf4, 0xf3, 0xf3,
+    0xf4, 0xf6, 0xf9, 0xfb, 0xfe, 0x00, 0x01, 0x01, 0x01, 0x00, 0xff, 0xfd,
+    0xfb, 0xfa, 0xf9, 0xf8, 0xf8, 0xf9, 0xfb, 0xfc, 0xff, 0x02, 0x05, 0x08,
+    0x0b, 0x0d, 0x0f, 0x11, 0x11, 0x11, 0x0f, 0x0c, 0x08, 0x03, 0xfd, 0xf7,
+    0xf1, 0xeb, 0xe6, 0xe3, 0xe2, 0xe3, 0xe6, 0xeb, 0xf2, 0xfb, 0x03, 0x0c,
+    0x13, 0x19, 0x1c, 0x1d, 0x1c, 0x18, 0x12, 0x0b, 0x04, 0xfd, 0xf7, 0xf2,
+    0xef, 0xef, 0xf0, 0xf3, 0xf8, 0xfc, 0x01, 0x04, 0x07, 0x07, 0x06, 0x03,
+    0xff, 0xfb, 0xf6, 0xf2, 0xf0, 0xef, 0xf0, 0xf4, 0xf8, 0xfe, 0x04, 0x0a,
+    0x0f, 0x13, 0x15, 0x15, 0x13, 0x0f, 0x0a, 0x05, 0x00, 0xfc, 0xf9, 0xf7,
+    0xf6, 0xf7, 0xf8, 0xfa, 0xfc, 0xfc, 0xfc, 0xfb, 0xf9, 0xf6, 0xf3, 0xf0,
+    0xef, 0xee, 0xf0, 0xf4, 0xfb, 0x02, 0x0b, 0x13, 0x1b, 0x20, 0x23, 0x23,
+    0x1f, 0x19, 0x0f, 0x04, 0xf8, 0xed, 0xe4, 0xdd, 0xda, 0xdb, 0xe0, 0xe7,
+    0xf1, 0xfc, 0x07, 0x10, 0x16, 0x1a, 0x19, 0x15, 0x0f, 0x06, 0xfc, 0xf3,
+    0xec, 0xe7, 0xe6, 0xe8, 0xee, 0xf7, 0x01, 0x0d, 0x17, 0x1f, 0x24, 0x25,
+    0x22, 0x1c, 0x12, 0x06, 0xf9, 0xed, 0xe2, 0xdb, 0xd7, 0xd7, 0xdb, 0xe2,
+    0xeb, 0xf6, 0x00, 0x0a, 0x11, 0x16, 0x18, 0x18, 0x14, 0x10, 0x0a, 0x05,
+    0x00, 0xfd, 0xfc, 0xfd, 0xfe, 0x01, 0x04, 0x07, 0x08, 0x08, 0x06, 0x03,
+    0xfe, 0xf8, 0xf2, 0xec, 0xe9, 0xe7, 0xe8, 0xeb, 0xf0, 0xf7, 0xff, 0x07,
+    0x0e, 0x14, 0x17, 0x17, 0x15, 0x10, 0x0a, 0x03, 0xfc, 0xf7, 0xf3, 0xf1,
+    0xf3, 0xf6, 0xfb, 0x02, 0x08, 0x0e, 0x12, 0x14, 0x12, 0x0e, 0x08, 0xff,
+    0xf6, 0xed, 0xe4, 0xdf, 0xdc, 0xdc, 0xe0, 0xe8, 0xf1, 0xfd, 0x08, 0x14,
+    0x1d, 0x23, 0x27, 0x27, 0x23, 0x1d, 0x14, 0x0a, 0x00, 0xf7, 0xef, 0xe9,
+    0xe6, 0xe6, 0xe8, 0xeb, 0xf0, 0xf5, 0xfb, 0xff, 0x03, 0x05, 0x06, 0x06,
+    0x04, 0x02, 0x00, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x00, 0x02, 0x04, 0x06,
+    0x07, 0x08, 0x09, 0x08, 0x08, 0x06, 0x05, 0x03, 0x02, 0x00, 0xfe, 0xfd,
+    0xfb, 0xf9, 0xf7, 0xf5, 0xf4, 0xf2, 0xf1, 0xf0, 0xf1, 0xf2, 0xf4, 0xf7,
+    0xfc, 0x01, 0x06, 0x0b, 0x10, 0x14, 0x17, 0x18, 0x17, 0x15, 0x11, 0x0c,
+    0x06, 0x00, 0xfa, 0xf5, 0xf1, 0xee, 0xec, 0xec, 0xed, 0xef, 0xf2, 0xf5,
+    0xf8, 0xfb, 0xfe, 0x00, 0x02, 0x04, 0x05, 0x07, 0x07, 0x08, 0x09, 0x09,
+    0x09, 0x09, 0x08, 0x07, 0x05, 0x03, 0x01, 0xfe, 0xfd, 0xfb, 0xfb, 0xfb,
+    0xfb, 0xfd, 0xfe, 0x00, 0x01, 0x02, 0x02, 0x00, 0xfe, 0xfb, 0xf7, 0xf3,
+    0xf0, 0xed, 0xed, 0xee, 0xf1, 0xf6, 0xfd, 0x06, 0x0e, 0x16, 0x1d, 0x22,
+    0x24, 0x23, 0x1e, 0x17, 0x0d, 0x02, 0xf6, 0xeb, 0xe2, 0xdc, 0xd8, 0xd9,
+    0xdd, 0xe4, 0xed, 0xf8, 0x02, 0x0c, 0x13, 0x18, 0x19, 0x18, 0x13, 0x0d,
+    0x06, 0xff, 0xf9, 0xf4, 0xf2, 0xf2, 0xf5, 0xfa, 0x00, 0x07, 0x0c, 0x11,
+    0x13, 0x13, 0x10, 0x0b, 0x04, 0xfd, 0xf5, 0xee, 0xe9, 0xe6, 0xe5, 0xe8,
+    0xec, 0xf2, 0xf9, 0x00, 0x07, 0x0b, 0x0e, 0x0f, 0x0e, 0x0b, 0x08, 0x04,
+    0x01, 0xff, 0xfe, 0xff, 0x02, 0x06, 0x0a, 0x0d, 0x10, 0x10, 0x0f, 0x0b,
+    0x04, 0xfc, 0xf3, 0xea, 0xe2, 0xdd, 0xda, 0xdb, 0xe0, 0xe8, 0xf2, 0xff,
+    0x0b, 0x17, 0x20, 0x26, 0x28, 0x26, 0x21, 0x18, 0x0d, 0x01, 0xf5, 0xec,
+    0xe5, 0xe2, 0xe3, 0xe8, 0xef, 0xf8, 0x02, 0x0b, 0x12, 0x17, 0x18, 0x15,
+    0x0f, 0x07, 0xfd, 0xf2, 0xe9, 0xe2, 0xde, 0xde, 0xe1, 0xe8, 0xf2, 0xfd,
+    0x09, 0x14, 0x1d, 0x23, 0x26, 0x25, 0x21, 0x1a, 0x10, 0x06, 0xfc, 0xf4,
+    0xed, 0xe8, 0xe7, 0xe7, 0xea, 0xee, 0xf3, 0xf8, 0xfc, 0xff, 0x01, 0x01,
+    0x01, 0xff, 0xfe, 0xfd, 0xfd, 0xfe, 0x00, 0x03, 0x07, 0x0b, 0x0f, 0x11,
+    0x13, 0x12, 0x10, 0x0c, 0x07, 0x01, 0xfb, 0xf5, 0xf0, 0xed, 0xec, 0xed,
+    0xef, 0xf4, 0xf9, 0xfe, 0x03, 0x06, 0x08, 0x09, 0x07, 0x04, 0x01, 0xfc,
+    0xf8, 0xf5, 0xf3, 0xf4, 0xf6, 0xfa, 0xff, 0x06, 0x0c, 0x12, 0x17, 0x1a,
+    0x1a, 0x18, 0x13, 0x0d, 0x05, 0xfc, 0xf4, 0xec, 0xe6, 0xe2, 0xe0, 0xe1,
+    0xe4, 0xe9, 0xef, 0xf6, 0xfe, 0x05, 0x0b, 0x10, 0x14, 0x15, 0x16, 0x15,
+    0x12, 0x0f, 0x0c, 0x08, 0x04, 0x00, 0xfd, 0xfa, 0xf8, 0xf6, 0xf5, 0xf5,
+    0xf6, 0xf7, 0xf8, 0xfa, 0xfc, 0xfe, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00,
+    0xfe, 0xfc, 0xfa, 0xf8, 0xf8, 0xf8, 0xf9, 0xfc, 0xff, 0x03, 0x08, 0x0d,
+    0x11, 0x14, 0x16, 0x16, 0x14, 0x10, 0x0a, 0x03, 0xfc, 0xf4, 0xed, 0xe8,
+    0xe4, 0xe3, 0xe4, 0xe7, 0xec, 0xf2, 0xf9, 0x00, 0x06, 0x0b, 0x0f, 0x11,
+    0x11, 0x11, 0x0f, 0x0c, 0x09, 0x06, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x01, 0xff, 0xfd, 0xfa, 0xf7, 0xf3, 0xf1, 0xef, 0xee, 0xef, 0xf2,
+    0xf6, 0xfb, 0x00, 0x05, 0x0a, 0x0d, 0x0f, 0x0f, 0x0d, 0x09, 0x05, 0x00,
+    0xfc, 0xf8, 0xf6, 0xf7, 0xf9, 0xfd, 0x02, 0x08, 0x0e, 0x12, 0x15, 0x15,
+    0x12, 0x0c, 0x04, 0xfb, 0xf0, 0xe6, 0xde, 0xd9, 0xd7, 0xd8, 0xde, 0xe8,
+    0xf4, 0x01, 0x0f, 0x1b, 0x25, 0x2b, 0x2d, 0x2b, 0x25, 0x1b, 0x0f, 0x02,
+    0xf6, 0xec, 0xe4, 0xe0, 0xe0, 0xe3, 0xe9, 0xf1, 0xfa, 0x03, 0x0a, 0x0f,
+    0x11, 0x10, 0x0c, 0x06, 0xff, 0xf8, 0xf1, 0xed, 0xeb, 0xec, 0xf0, 0xf6,
+    0xfd, 0x06, 0x0e, 0x15, 0x19, 0x1b, 0x1a, 0x17, 0x11, 0x09, 0x02, 0xfa,
+    0xf4, 0xef, 0xed, 0xed, 0xef, 0xf3, 0xf7, 0xfc, 0xff, 0x02, 0x02, 0x01,
+    0xff, 0xfb, 0xf7, 0xf4, 0xf2, 0xf2, 0xf4, 0xf8, 0xfe, 0x06, 0x0f, 0x17,
+    0x1d, 0x21, 0x22, 0x20, 0x1b, 0x12, 0x07, 0xfb, 0xef, 0xe5, 0xdd, 0xd8,
+    0xd8, 0xdb, 0xe1, 0xeb, 0xf5, 0x01, 0x0b, 0x14, 0x1a, 0x1c, 0x1b, 0x16,
+    0x10, 0x07, 0xff, 0xf7, 0xf1, 0xed, 0xec, 0xee, 0xf4, 0xfb, 0x03, 0x0b,
+    0x12, 0x17, 0x1a, 0x19, 0x16, 0x10, 0x08, 0xfe, 0xf5, 0xec, 0xe5, 0xe1,
+    0xdf, 0xe0, 0xe4, 0xea, 0xf1, 0xfa, 0x02, 0x09, 0x0f, 0x14, 0x16, 0x16,
+    0x15, 0x13, 0x10, 0x0c, 0x09, 0x05, 0x03, 0x00, 0xff, 0xfd, 0xfc, 0xfa,
+    0xf9, 0xf7, 0xf5, 0xf3, 0xf2, 0xf1, 0xf1, 0xf1, 0xf3, 0xf6, 0xf9, 0xfd,
+    0x02, 0x06, 0x09, 0x0c, 0x0d, 0x0e, 0x0d, 0x0b, 0x08, 0x05, 0x02, 0xff,
+    0xfd, 0xfc, 0xfc, 0xfd, 0xff, 0x00, 0x02, 0x04, 0x05, 0x05, 0x03, 0x01,
+    0xfe, 0xfb, 0xf7, 0xf4, 0xf1, 0xef, 0xee, 0xef, 0xf1, 0xf4, 0xf8, 0xfd,
+    0x02, 0x07, 0x0c, 0x10, 0x13, 0x14, 0x15, 0x14, 0x13, 0x10, 0x0c, 0x08,
+    0x04, 0xff, 0xfa, 0xf5, 0xf1, 0xed, 0xeb, 0xe9, 0xe8, 0xe9, 0xec, 0xef,
+    0xf4, 0xfa, 0x00, 0x06, 0x0c, 0x10, 0x14, 0x15, 0x15, 0x13, 0x0f, 0x0a,
+    0x04, 0xfe, 0xf9, 0xf5, 0xf3, 0xf2, 0xf4, 0xf7, 0xfc, 0x01, 0x06, 0x0a,
+    0x0d, 0x0e, 0x0d, 0x0a, 0x04, 0xfd, 0xf6, 0xee, 0xe8, 0xe4, 0xe2, 0xe3,
+    0xe7, 0xee, 0xf7, 0x01, 0x0b, 0x15, 0x1c, 0x21, 0x23, 0x22, 0x1e, 0x17,
+    0x0e, 0x05, 0xfc, 0xf4, 0xee, 0xea, 0xe8, 0xe9, 0xec, 0xf0, 0xf5, 0xfa,
+    0xfe, 0x00, 0x02, 0x02, 0x00, 0xfe, 0xfc, 0xfb, 0xfa, 0xfa, 0xfc, 0x00,
+    0x04, 0x09, 0x0e, 0x12, 0x15, 0x16, 0x14, 0x10, 0x0b, 0x04, 0xfc, 0xf5,
+    0xef, 0xea, 0xe9, 0xe9, 0xed, 0xf2, 0xf8, 0x00, 0x06, 0x0b, 0x0e, 0x0e,
+    0x0c, 0x07, 0x01, 0xfa, 0xf3, 0xed, 0xea, 0xe9, 0xec, 0xf2, 0xfa, 0x05,
+    0x10, 0x1a, 0x22, 0x28, 0x29, 0x26, 0x1f, 0x14, 0x07, 0xf9, 0xeb, 0xdf,
+    0xd5, 0xd0, 0xcf, 0xd3, 0xdb, 0xe6, 0xf4, 0x01, 0x0e, 0x18, 0x20, 0x23,
+    0x22, 0x1e, 0x17, 0x0e, 0x05, 0xfc, 0xf4, 0xf0, 0xee, 0xef, 0xf3, 0xf8,
+    0xff, 0x06, 0x0b, 0x0f, 0x10, 0x0f, 0x0c, 0x06, 0xff, 0xf8, 0xf1, 0xeb,
+    0xe8, 0xe7, 0xe8, 0xec, 0xf2, 0xf9, 0x00, 0x07, 0x0c, 0x10, 0x11, 0x11,
+    0x0f, 0x0c, 0x08, 0x04, 0x01, 0xff, 0xff, 0xff, 0x01, 0x04, 0x06, 0x08,
+    0x08, 0x07, 0x04, 0x00, 0xfa, 0xf4, 0xed, 0xe8, 0xe4, 0xe2, 0xe3, 0xe7,
+    0xed, 0xf6, 0x00, 0x0a, 0x13, 0x1b, 0x20, 0x23, 0x22, 0x1e, 0x18, 0x0f,
+    0x06, 0xfc, 0xf4, 0xed, 0xe9, 0xe7, 0xe8, 0xec, 0xf1, 0xf7, 0xfe, 0x04,
+    0x08, 0x0b, 0x0c, 0x0a, 0x07, 0x02, 0xfd, 0xf8, 0xf4, 0xf1, 0xef, 0xf0,
+    0xf3, 0xf7, 0xfc, 0x02, 0x08, 0x0e, 0x13, 0x16, 0x17, 0x16, 0x14, 0x11,
+    0x0c, 0x06, 0x00, 0xfb, 0xf5, 0xf1, 0xed, 0xeb, 0xea, 0xe9, 0xea, 0xec,
+    0xef, 0xf3, 0xf7, 0xfc, 0x01, 0x05, 0x0a, 0x0e, 0x11, 0x14, 0x15, 0x14,
+    0x13, 0x10, 0x0c, 0x08, 0x03, 0xfe, 0xf9, 0xf6, 0xf3, 0xf2, 0xf2, 0xf3,
+    0xf5, 0xf8, 0xfb, 0xfe, 0x00, 0x01, 0x02, 0x01, 0x00, 0xfe, 0xfc, 0xfa,
+    0xf9, 0xf9, 0xf9, 0xfb, 0xfd, 0x01, 0x04, 0x08, 0x0b, 0x0e, 0x0f, 0x10,
+    0x0f, 0x0d, 0x0a, 0x06, 0x02, 0xfe, 0xfb, 0xf8, 0xf6, 0xf5, 0xf4, 0xf4,
+    0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf5, 0xf6, 0xf7, 0xf9, 0xfb, 0xff, 0x04,
+    0x09, 0x0e, 0x14, 0x18, 0x1b, 0x1b, 0x1a, 0x16, 0x10, 0x09, 0x00, 0xf7,
+    0xee, 0xe7, 0xe2, 0xe0, 0xe0, 0xe4, 0xea, 0xf2, 0xfc, 0x05, 0x0d, 0x13,
+    0x16, 0x16, 0x14, 0x0f, 0x08, 0x00, 0xf8, 0xf1, 0xed, 0xeb, 0xec, 0xf1,
+    0xf8, 0x01, 0x0a, 0x13, 0x1b, 0x1f, 0x21, 0x1e, 0x19, 0x10, 0x05, 0xf9,
+    0xed, 0xe3, 0xdc, 0xd8, 0xd7, 0xdb, 0xe2, 0xeb, 0xf6, 0x01, 0x0b, 0x14,
+    0x1a, 0x1c, 0x1c, 0x19, 0x14, 0x0d, 0x07, 0x01, 0xfc, 0xf9, 0xf8, 0xf9,
+    0xfc, 0xff, 0x02, 0x05, 0x06, 0x06, 0x03, 0xff, 0xfa, 0xf4, 0xef, 0xeb,
+    0xe8, 0xe8, 0xeb, 0xef, 0xf6, 0xfe, 0x07, 0x0e, 0x15, 0x19, 0x1a, 0x18,
+    0x14, 0x0e, 0x06, 0xfe, 0xf7, 0xf2, 0xef, 0xee, 0xf1, 0xf6, 0xfd, 0x04,
+    0x0b, 0x10, 0x14, 0x14, 0x11, 0x0b, 0x02, 0xf9, 0xee, 0xe5, 0xde, 0xda,
+    0xda, 0xde, 0xe5, 0xf0, 0xfd, 0x0b, 0x17, 0x22, 0x2a, 0x2e, 0x2d, 0x28,
+    0x20, 0x14, 0x08, 0xfb, 0xef, 0xe5, 0xdf, 0xdc, 0xdd, 0xe1, 0xe8, 0xf0,
+    0xf9, 0x01, 0x08, 0x0d, 0x0f, 0x0e, 0x0c, 0x08, 0x03, 0xfe, 0xf9, 0xf7,
+    0xf5, 0xf6, 0xf9, 0xfd, 0x02, 0x07, 0x0b, 0x0f, 0x11, 0x11, 0x10, 0x0c,
+    0x08, 0x03, 0xfe, 0xf9, 0xf6, 0xf3, 0xf2, 0xf2, 0xf3, 0xf4, 0xf6, 0xf8,
+    0xfa, 0xfb, 0xfc, 0xfc, 0xfb, 0xfb, 0xfb, 0xfc, 0xfe, 0x00, 0x04, 0x08,
+    0x0d, 0x11, 0x14, 0x16, 0x17, 0x15, 0x12, 0x0d, 0x06, 0xff, 0xf7, 0xf0,
+    0xea, 0xe5, 0xe3, 0xe3, 0xe6, 0xea, 0xf0, 0xf6, 0xfd, 0x04, 0x0a, 0x0e,
+    0x11, 0x12, 0x11, 0x0f, 0x0c, 0x08, 0x05, 0x01, 0xfe, 0xfd, 0xfc, 0xfc,
+    0xfc, 0xfe, 0xff, 0x01, 0x02, 0x03, 0x04, 0x03, 0x03, 0x01, 0xff, 0xfd,
+    0xfa, 0xf8, 0xf6, 0xf4, 0xf3, 0xf2, 0xf2, 0xf2, 0xf4, 0xf6, 0xfa, 0xfe,
+    0x03, 0x08, 0x0d, 0x12, 0x16, 0x19, 0x1a, 0x19, 0x17, 0x13, 0x0d, 0x05,
+    0xfd, 0xf5, 0xed, 0xe7, 0xe2, 0xe0, 0xe0, 0xe3, 0xe8, 0xef, 0xf7, 0xff,
+    0x07, 0x0e, 0x12, 0x15, 0x15, 0x13, 0x10, 0x0b, 0x05, 0x00, 0xfb, 0xf8,
+    0xf7, 0xf7, 0xf9, 0xfd, 0x01, 0x05, 0x09, 0x0b, 0x0c, 0x0b, 0x08, 0x04,
+    0xfe, 0xf9, 0xf3, 0xee, 0xeb, 0xea, 0xeb, 0xed, 0xf2, 0xf7, 0xfd, 0x03,
+    0x08, 0x0c, 0x0e, 0x0f, 0x0e, 0x0c, 0x09, 0x06, 0x04, 0x03, 0x02, 0x02,
+    0x04, 0x06, 0x07, 0x08, 0x08, 0x07, 0x04, 0xff, 0xf9, 0xf2, 0xec, 0xe6,
+    0xe2, 0xe0, 0xe1, 0xe5, 0xed, 0xf6, 0x01, 0x0c, 0x16, 0x1f, 0x24, 0x26,
+    0x25, 0x1f, 0x17, 0x0d, 0x01, 0xf6, 0xec, 0xe5, 0xe2, 0xe2, 0xe6, 0xec,
+    0xf5, 0xff, 0x08, 0x10, 0x16, 0x17, 0x16, 0x11, 0x09, 0xff, 0xf4, 0xeb,
+    0xe3, 0xdf, 0xde, 0xe1, 0xe8, 0xf2, 0xfe, 0x0a, 0x16, 0x20, 0x26, 0x29,
+    0x28, 0x23, 0x1b, 0x10, 0x04, 0xf9, 0xee, 0xe6, 0xe1, 0xe0, 0xe1, 0xe5,
+    0xeb, 0xf2, 0xfa, 0x00, 0x05, 0x08, 0x09, 0x08, 0x05, 0x02, 0xff, 0xfd,
+    0xfc, 0xfc, 0xff, 0x02, 0x07, 0x0c, 0x10, 0x13, 0x14, 0x13, 0x10, 0x0b,
+    0x04, 0xfc, 0xf5, 0xee, 0xe9, 0xe6, 0xe6, 0xe9, 0xed, 0xf4, 0xfb, 0x03,
+    0x09, 0x0e, 0x10, 0x0f, 0x0d, 0x08, 0x02, 0xfc, 0xf6, 0xf2, 0xf0, 0xf0,
+    0xf4, 0xf9, 0x00, 0x09, 0x11, 0x18, 0x1d, 0x1f, 0x1d, 0x19, 0x11, 0x07,
+    0xfc, 0xf1, 0xe7, 0xde, 0xd9, 0xd7, 0xd9, 0xde, 0xe6, 0xf0, 0xfb, 0x06,
+    0x10, 0x18, 0x1d, 0x1f, 0x1f, 0x1c, 0x16, 0x10, 0x09, 0x02, 0xfc, 0xf7,
+    0xf5, 0xf3, 0xf4, 0xf5, 0xf8, 0xfa, 0xfd, 0xff, 0x00, 0x01, 0x00, 0xff,
+    0xfd, 0xfc, 0xfa, 0xf9, 0xf8, 0xf8, 0xf9, 0xfa, 0xfc, 0xfe, 0x00, 0x02,
+    0x03, 0x05, 0x06, 0x08, 0x09, 0x09, 0x0a, 0x0a, 0x0b, 0x0a, 0x0a, 0x09,
+    0x07, 0x04, 0x01, 0xfd, 0xf9, 0xf4, 0xf0, 0xed, 0xea, 0xe9, 0xe9, 0xeb,
+    0xef, 0xf4, 0xf9, 0xff, 0x06, 0x0b, 0x10, 0x14, 0x16, 0x16, 0x15, 0x12,
+    0x0f, 0x0b, 0x06, 0x02, 0xfe, 0xfb, 0xf8, 0xf6, 0xf5, 0xf5, 0xf4, 0xf5,
+    0xf5, 0xf6, 0xf7, 0xf7, 0xf9, 0xfa, 0xfb, 0xfd, 0xff, 0x01, 0x03, 0x05,
+    0x06, 0x07, 0x07, 0x06, 0x05, 0x04, 0x02, 0x00, 0xff, 0xfe, 0xff, 0x00,
+    0x02, 0x05, 0x07, 0x0a, 0x0b, 0x0c, 0x0a, 0x08, 0x03, 0xfd, 0xf6, 0xef,
+    0xe9, 0xe3, 0xe0, 0xe0, 0xe2, 0xe8, 0xef, 0xf9, 0x04, 0x0f, 0x19, 0x21,
+    0x26, 0x28, 0x26, 0x21, 0x18, 0x0e, 0x03, 0xf8, 0xee, 0xe6, 0xe2, 0xe0,
+    0xe2, 0xe7, 0xee, 0xf6, 0xff, 0x06, 0x0b, 0x0f, 0x0f, 0x0d, 0x09, 0x03,
+    0xfd, 0xf7, 0xf2, 0xef, 0xef, 0xf1, 0xf6, 0xfc, 0x04, 0x0b, 0x12, 0x16,
+    0x19, 0x19, 0x16, 0x11, 0x0a, 0x03, 0xfb, 0xf4, 0xef, 0xec, 0xeb, 0xec,
+    0xef, 0xf3, 0xf8, 0xfd, 0x00, 0x03, 0x03, 0x02, 0x00, 0xfd, 0xfa, 0xf7,
+    0xf6, 0xf7, 0xfa, 0xff, 0x05, 0x0d, 0x14, 0x1a, 0x1e, 0x1f, 0x1e, 0x19,
+    0x11, 0x06, 0xfb, 0xef, 0xe4, 0xdc, 0xd7, 0xd6, 0xd9, 0xdf, 0xe9, 0xf5,
+    0x01, 0x0d, 0x17, 0x1e, 0x21, 0x20, 0x1c, 0x14, 0x0b, 0x00, 0xf6, 0xee,
+    0xe9, 0xe8, 0xea, 0xef, 0xf7, 0x00, 0x0a, 0x13, 0x19, 0x1d, 0x1d, 0x1a,
+    0x13, 0x09, 0xfe, 0xf2, 0xe8, 0xe0, 0xda, 0xd9, 0xdb, 0xe0, 0xe9, 0xf3,
+    0xfe, 0x09, 0x12, 0x1a, 0x1e, 0x1f, 0x1d, 0x19, 0x13, 0x0d, 0x06, 0x00,
+    0xfb, 0xf8, 0xf7, 0xf7, 0xf8, 0xf9, 0xfb, 0xfd, 0xfd, 0xfc, 0xfb, 0xf9,
+    0xf6, 0xf3, 0xf1, 0xf0, 0xf1, 0xf3, 0xf7, 0xfc, 0x02, 0x08, 0x0d, 0x12,
+    0x14, 0x15, 0x14, 0x11, 0x0c, 0x06, 0x01, 0xfb, 0xf7, 0xf4, 0xf3, 0xf4,
+    0xf6, 0xfa, 0xfe, 0x02, 0x06, 0x08, 0x08, 0x07, 0x04, 0xff, 0xfa, 0xf4,
+    0xef, 0xec, 0xea, 0xea, 0xed, 0xf1, 0xf8, 0x00, 0x08, 0x10, 0x17, 0x1c,
+    0x1f, 0x1f, 0x1d, 0x18, 0x12, 0x0a, 0x02, 0xfa, 0xf2, 0xec, 0xe8, 0xe6,
+    0xe5, 0xe6, 0xe9, 0xed, 0xf2, 0xf7, 0xfc, 0x01, 0x05, 0x09, 0x0b, 0x0d,
+    0x0d, 0x0d, 0x0c, 0x0b, 0x09, 0x07, 0x04, 0x02, 0x00, 0xfe, 0xfc, 0xfc,
+    0xfb, 0xfc, 0xfd, 0xfe, 0x00, 0x01, 0x03, 0x03, 0x03, 0x02, 0x01, 0xfe,
+    0xfa, 0xf7, 0xf3, 0xf0, 0xee, 0xed, 0xee, 0xf1, 0xf5, 0xfb, 0x02, 0x09,
+    0x0f, 0x15, 0x19, 0x1c, 0x1c, 0x1a, 0x15, 0x0f, 0x08, 0x00, 0xf9, 0xf2,
+    0xed, 0xea, 0xe8, 0xe9, 0xeb, 0xee, 0xf2, 0xf7, 0xfb, 0xff, 0x01, 0x03,
+    0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0b, 0x0c, 0x0d,
+    0x0d, 0x0c, 0x09, 0x06, 0x01, 0xfc, 0xf7, 0xf3, 0xef, 0xee, 0xee, 0xf0,
+    0xf4, 0xf8, 0xfd, 0x02, 0x06, 0x09, 0x0a, 0x08, 0x05, 0x01, 0xfc, 0xf7,
+    0xf3, 0xf0, 0xf0, 0xf2, 0xf7, 0xfe, 0x06, 0x0f, 0x17, 0x1e, 0x22, 0x23,
+    0x20, 0x1a, 0x10, 0x04, 0xf7, 0xeb, 0xdf, 0xd7, 0xd2, 0xd1, 0xd5, 0xdd,
+    0xe8, 0xf4, 0x02, 0x0f, 0x1a, 0x21, 0x25, 0x25, 0x21, 0x1a, 0x11, 0x06,
+    0xfd, 0xf4, 0xee, 0xeb, 0xeb, 0xef, 0xf4, 0xfb, 0x02, 0x09, 0x0e, 0x11,
+    0x10, 0x0d, 0x08, 0x01, 0xf9, 0xf1, 0xeb, 0xe7, 0xe5, 0xe6, 0xea, 0xf1,
+    0xf8, 0x01, 0x09, 0x10, 0x14, 0x17, 0x17, 0x14, 0x10, 0x0b, 0x05, 0x00,
+    0xfc, 0xfa, 0xf9, 0xfa, 0xfd, 0x00, 0x03, 0x06, 0x07, 0x06, 0x03, 0xfe,
+    0xf8, 0xf2, 0xeb, 0xe6, 0xe3, 0xe3, 0xe5, 0xeb, 0xf4, 0xfe, 0x09, 0x14,
+    0x1d, 0x24, 0x28, 0x27, 0x23, 0x1c, 0x12, 0x06, 0xfa, 0xef, 0xe6, 0xe1,
+    0xde, 0xe0, 0xe4, 0xec, 0xf5, 0xfe, 0x07, 0x0e, 0x13, 0x14, 0x12, 0x0e,
+    0x07, 0xff, 0xf7, 0xf0, 0xeb, 0xe9, 0xe9, 0xec, 0xf2, 0xfa, 0x04, 0x0d,
+    0x15, 0x1b, 0x1f, 0x1f, 0x1d, 0x18, 0x11, 0x08, 0xff, 0xf6, 0xef, 0xe9,
+    0xe5, 0xe4, 0xe4, 0xe7, 0xeb, 0xf1, 0xf6, 0xfb, 0x00, 0x04, 0x06, 0x08,
+    0x0a, 0x0a, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x09, 0x07,
+    0x04, 0x01, 0xfd, 0xf9, 0xf5, 0xf2, 0xf0, 0xef, 0xf0, 0xf1, 0xf4, 0xf7,
+    0xfb, 0xff, 0x02, 0x04, 0x06, 0x06, 0x06, 0x05, 0x03, 0x01, 0xff, 0xfe,
+    0xfd, 0xfe, 0xff, 0x02, 0x04, 0x07, 0x0a, 0x0c, 0x0d, 0x0d, 0x0c, 0x09,
+    0x06, 0x01, 0xfc, 0xf8, 0xf3, 0xef, 0xec, 0xeb, 0xea, 0xeb, 0xee, 0xf1,
+    0xf5, 0xfa, 0xfe, 0x03, 0x08, 0x0c, 0x10, 0x13, 0x15, 0x15, 0x15, 0x14,
+    0x12, 0x0e, 0x0a, 0x04, 0xff, 0xf9, 0xf3, 0xee, 0xeb, 0xe9, 0xe8, 0xe9,
+    0xec, 0xf1, 0xf7, 0xfd, 0x03, 0x08, 0x0c, 0x0f, 0x10, 0x0e, 0x0b, 0x07,
+    0x02, 0xfd, 0xf8, 0xf5, 0xf3, 0xf4, 0xf7, 0xfb, 0x01, 0x08, 0x0e, 0x13,
+    0x17, 0x18, 0x16, 0x12, 0x0b, 0x03, 0xf9, 0xf0, 0xe7, 0xe1, 0xdd, 0xdc,
+    0xdf, 0xe4, 0xec, 0xf5, 0x00, 0x09, 0x12, 0x18, 0x1c, 0x1d, 0x1b, 0x17,
+    0x12, 0x0b, 0x05, 0xff, 0xfb, 0xf8, 0xf7, 0xf7, 0xf9, 0xfb, 0xfe, 0x00,
+    0x00, 0x00, 0xfe, 0xfb, 0xf7, 0xf3, 0xf0, 0xee, 0xee, 0xef, 0xf3, 0xf8,
+    0xff, 0x06, 0x0d, 0x13, 0x17, 0x18, 0x17, 0x14, 0x0e, 0x07, 0x00, 0xf9,
+    0xf3, 0xf0, 0xef, 0xf0, 0xf4, 0xf9, 0x00, 0x07, 0x0c, 0x10, 0x11, 0x0f,
+    0x0b, 0x03, 0xfa, 0xf1, 0xe8, 0xe1, 0xdd, 0xdc, 0xe0, 0xe7, 0xf1, 0xfe,
+    0x0b, 0x19, 0x24, 0x2c, 0x30, 0x2f, 0x2a, 0x20, 0x14, 0x06, 0xf8, 0xeb,
+    0xe0, 0xd9, 0xd6, 0xd7, 0xdd, 0xe5, 0xef, 0xfa, 0x05, 0x0d, 0x13, 0x16,
+    0x15, 0x12, 0x0c, 0x05, 0xfe, 0xf8, 0xf3, 0xf1, 0xf1, 0xf4, 0xf9, 0xff,
+    0x07, 0x0d, 0x12, 0x16, 0x16, 0x15, 0x10, 0x0a, 0x03, 0xfb, 0xf4, 0xef,
+    0xeb, 0xe9, 0xea, 0xed, 0xf1, 0xf6, 0xfb, 0xff, 0x03, 0x05, 0x05, 0x05,
+    0x03, 0x01, 0xff, 0xfd, 0xfd, 0xff, 0x01, 0x06, 0x0a, 0x0f, 0x13, 0x16,
+    0x17, 0x15, 0x11, 0x0b, 0x03, 0xfa, 0xf1, 0xe8, 0xe1, 0xdd, 0xdc, 0xde,
+    0xe3, 0xea, 0xf4, 0xfe, 0x08, 0x11, 0x18, 0x1c, 0x1d, 0x1b, 0x17, 0x11,
+    0x09, 0x02, 0xfb, 0xf5, 0xf2, 0xf1, 0xf2, 0xf5, 0xf9, 0xfe, 0x04, 0x08,
+    0x0b, 0x0d, 0x0c, 0x0a, 0x06, 0x01, 0xfb, 0xf5, 0xf0, 0xec, 0xea, 0xea,
+    0xeb, 0xef, 0xf3, 0xf9, 0xff, 0x05, 0x0b, 0x10, 0x14, 0x16, 0x17, 0x16,
+    0x14, 0x12, 0x0e, 0x0a, 0x05, 0x00, 0xfb, 0xf7, 0xf3, 0xef, 0xec, 0xeb,
+    0xea, 0xeb, 0xec, 0xef, 0xf3, 0xf8, 0xfd, 0x02, 0x07, 0x0b, 0x0e, 0x10,
+    0x11, 0x10, 0x0e, 0x0b, 0x08, 0x04, 0x01, 0xfe, 0xfc, 0xfa, 0xfa, 0xfb,
+    0xfd, 0xff, 0x00, 0x02, 0x03, 0x03, 0x02, 0x00, 0xfd, 0xfa, 0xf7, 0xf4,
+    0xf2, 0xf1, 0xf2, 0xf3, 0xf6, 0xf9, 0xfd, 0x02, 0x06, 0x09, 0x0c, 0x0e,
+    0x0e, 0x0e, 0x0d, 0x0c, 0x0a, 0x08, 0x06, 0x05, 0x03, 0x02, 0x00, 0xff,
+    0xfc, 0xfa, 0xf6, 0xf3, 0xef, 0xec, 0xea, 0xe9, 0xe9, 0xec, 0xf0, 0xf6,
+    0xfd, 0x05, 0x0e, 0x15, 0x1b, 0x1f, 0x20, 0x1e, 0x1a, 0x13, 0x0a, 0x01,
+    0xf7, 0xef, 0xe9, 0xe6, 0xe5, 0xe8, 0xed, 0xf4, 0xfc, 0x04, 0x0c, 0x11,
+    0x13, 0x12, 0x0e, 0x08, 0x00, 0xf8, 0xef, 0xe9, 0xe4, 0xe3, 0xe5, 0xeb,
+    0xf4, 0xfe, 0x0a, 0x15, 0x1e, 0x24, 0x27, 0x26, 0x22, 0x1a, 0x10, 0x04,
+    0xf8, 0xed, 0xe4, 0xdf, 0xdd, 0xde, 0xe2, 0xe8, 0xf0, 0xf9, 0x01, 0x07,
+    0x0b, 0x0d, 0x0d, 0x0b, 0x08, 0x04, 0x00, 0xfe, 0xfd, 0xfd, 0x00, 0x03,
+    0x08, 0x0c, 0x10, 0x12, 0x12, 0x10, 0x0b, 0x05, 0xfd, 0xf6, 0xee, 0xe8,
+    0xe5, 0xe4, 0xe6, 0xea, 0xf1, 0xf9, 0x02, 0x09, 0x0f, 0x13, 0x14, 0x12,
+    0x0e, 0x07, 0x00, 0xf9, 0xf3, 0xef, 0xee, 0xf0, 0xf5, 0xfc, 0x05, 0x0e,
+    0x16, 0x1c, 0x1f, 0x1f, 0x1b, 0x13, 0x09, 0xfd, 0xf0, 0xe4, 0xda, 0xd4,
+    0xd2, 0xd4, 0xda, 0xe4, 0xf0, 0xfe, 0x0b, 0x17, 0x21, 0x26, 0x28, 0x26,
+    0x21, 0x19, 0x0f, 0x04, 0xfb, 0xf3, 0xed, 0xea, 0xea, 0xed, 0xf1, 0xf7,
+    0xfd, 0x02, 0x06, 0x08, 0x09, 0x07, 0x03, 0xff, 0xfa, 0xf6, 0xf2, 0xf0,
+    0xf0, 0xf2, 0xf5, 0xfa, 0xff, 0x04, 0x09, 0x0d, 0x10, 0x11, 0x10, 0x0e,
+    0x0c, 0x08, 0x05, 0x02, 0x00, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc,
+    0xfb, 0xf8, 0xf6, 0xf3, 0xf0, 0xef, 0xee, 0xee, 0xf0, 0xf4, 0xf9, 0xff,
+    0x06, 0x0d, 0x13, 0x18, 0x1b, 0x1c, 0x1b, 0x17, 0x12, 0x0b, 0x04, 0xfc,
+    0xf5, 0xef, 0xeb, 0xe9, 0xe9, 0xeb, 0xee, 0xf2, 0xf7, 0xfc, 0x00, 0x03,
+    0x06, 0x07, 0x07, 0x07, 0x05, 0x03, 0x01, 0xff, 0xfe, 0xfd, 0xfe, 0xfe,
+    0xff, 0x01, 0x03, 0x05, 0x07, 0x08, 0x09, 0x0a, 0x0a, 0x09, 0x07, 0x05,
+    0x02, 0xff, 0xfb, 0xf7, 0xf3, 0xf0, 0xec, 0xea, 0xe9, 0xea, 0xeb, 0xef,
+    0xf4, 0xfa, 0x01, 0x09, 0x10, 0x16, 0x1b, 0x1e, 0x1f, 0x1d, 0x19, 0x13,
+    0x0b, 0x03, 0xfa, 0xf2, 0xec, 0xe7, 0xe5, 0xe5, 0xe8, 0xed, 0xf3, 0xf9,
+    0x00, 0x05, 0x09, 0x0b, 0x0b, 0x0a, 0x07, 0x03, 0xff, 0xfb, 0xf8, 0xf6,
+    0xf7, 0xf9, 0xfd, 0x01, 0x06, 0x0b, 0x10, 0x12, 0x13, 0x12, 0x0f, 0x0a,
+    0x04, 0xfe, 0xf8, 0xf3, 0xef, 0xed, 0xec, 0xee, 0xf0, 0xf4, 0xf8, 0xfc,
+    0xff, 0x01, 0x02, 0x02, 0x01, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x03, 0x07,
+    0x0c, 0x11, 0x15, 0x18, 0x18, 0x17, 0x12, 0x0b, 0x03, 0xf9, 0xef, 0xe5,
+    0xde, 0xda, 0xd9, 0xdc, 0xe2, 0xeb, 0xf6, 0x02, 0x0d, 0x17, 0x1e, 0x21,
+    0x21, 0x1d, 0x16, 0x0d, 0x02, 0xf8, 0xf0, 0xea, 0xe7, 0xe8, 0xed, 0xf4,
+    0xfd, 0x07, 0x10, 0x17, 0x1c, 0x1d, 0x1a, 0x13, 0x0a, 0xfe, 0xf2, 0xe7,
+    0xde, 0xd9, 0xd7, 0xd9, 0xdf, 0xe8, 0xf4, 0x00, 0x0d, 0x17, 0x1f, 0x24,
+    0x25, 0x22, 0x1d, 0x15, 0x0c, 0x03, 0xfb, 0xf4, 0xf0, 0xef, 0xef, 0xf2,
+    0xf5, 0xf9, 0xfd, 0x00, 0x01, 0x00, 0xfe, 0xfb, 0xf7, 0xf4, 0xf1, 0xf0,
+    0xf1, 0xf4, 0xf8, 0xff, 0x06, 0x0d, 0x13, 0x17, 0x1a, 0x19, 0x16, 0x11,
+    0x0a, 0x02, 0xfb, 0xf4, 0xef, 0xec, 0xec, 0xee, 0xf2, 0xf8, 0xff, 0x05,
+    0x0a, 0x0d, 0x0d, 0x0b, 0x06, 0x00, 0xf9, 0xf2, 0xec, 0xe7, 0xe6, 0xe7,
+    0xec, 0xf3, 0xfd, 0x07, 0x12, 0x1b, 0x22, 0x26, 0x27, 0x24, 0x1d, 0x14,
+    0x09, 0xfd, 0xf2, 0xe8, 0xe1, 0xdc, 0xdb, 0xdd, 0xe2, 0xe8, 0xf1, 0xf9,
+    0x02, 0x09, 0x0e, 0x11, 0x12, 0x12, 0x0f, 0x0c, 0x08, 0x04, 0x01, 0xff,
+    0xfd, 0xfd, 0xfe, 0xff, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x01,
+    0xfe, 0xfc, 0xfa, 0xf8, 0xf7, 0xf6, 0xf6, 0xf6, 0xf6, 0xf7, 0xf8, 0xf8,
+    0xfa, 0xfb, 0xfd, 0xff, 0x01, 0x04, 0x07, 0x0a, 0x0d, 0x10, 0x12, 0x13,
+    0x13, 0x11, 0x0e, 0x0a, 0x05, 0xff, 0xf9, 0xf3, 0xee, 0xea, 0xe8, 0xe7,
+    0xe8, 0xeb, 0xef, 0xf4, 0xf9, 0xfe, 0x03, 0x08, 0x0b, 0x0d, 0x0e, 0x0f,
+    0x0e, 0x0d, 0x0b, 0x0a, 0x08, 0x06, 0x04, 0x02, 0x01, 0xff, 0xfd, 0xfc,
+    0xfa, 0xf8, 0xf7, 0xf7, 0xf6, 0xf7, 0xf8, 0xf9, 0xfb, 0xfd, 0xff, 0x00,
+    0x02, 0x02, 0x01, 0x00, 0xfe, 0xfd, 0xfb, 0xf9, 0xf9, 0xfa, 0xfc, 0x00,
+    0x04, 0x0a, 0x0f, 0x14, 0x17, 0x19, 0x19, 0x16, 0x10, 0x08, 0xff, 0xf5,
+    0xeb, 0xe2, 0xdc, 0xd8, 0xd8, 0xdc, 0xe2, 0xeb, 0xf7, 0x02, 0x0e, 0x17,
+    0x1f, 0x23, 0x23, 0x20, 0x1b, 0x12, 0x09, 0x00, 0xf7, 0xf1, 0xed, 0xeb,
+    0xed, 0xf1, 0xf7, 0xfd, 0x04, 0x09, 0x0c, 0x0e, 0x0c, 0x08, 0x03, 0xfc,
+    0xf5, 0xef, 0xea, 0xe8, 0xe9, 0xec, 0xf1, 0xf8, 0x00, 0x08, 0x0f, 0x14,
+    0x17, 0x18, 0x16, 0x13, 0x0d, 0x07, 0x01, 0xfc, 0xf9, 0xf7, 0xf6, 0xf8,
+    0xfb, 0xfe, 0x01, 0x02, 0x03, 0x02, 0xff, 0xfa, 0xf5, 0xef, 0xeb, 0xe7,
+    0xe7, 0xe9, 0xee, 0xf5, 0xff, 0x09, 0x14, 0x1d, 0x24, 0x28, 0x28, 0x24,
+    0x1c, 0x12, 0x06, 0xf9, 0xed, 0xe4, 0xdd, 0xda, 0xdb, 0xe0, 0xe8, 0xf2,
+    0xfe, 0x08, 0x11, 0x17, 0x19, 0x18, 0x13, 0x0c, 0x03, 0xf9, 0xf0, 0xe9,
+    0xe6, 0xe5, 0xe9, 0xef, 0xf8, 0x03, 0x0e, 0x18, 0x1f, 0x24, 0x25, 0x22,
+    0x1b, 0x12, 0x07, 0xfb, 0xf0, 0xe6, 0xdf, 0xdc, 0xdc, 0xdf, 0xe5, 0xec,
+    0xf5, 0xfd, 0x05, 0x0b, 0x0f, 0x10, 0x10, 0x0f, 0x0c, 0x09, 0x06, 0x04,
+    0x03, 0x03, 0x03, 0x05, 0x06, 0x08, 0x08, 0x08, 0x06, 0x03, 0xff, 0xfa,
+    0xf5, 0xf0, 0xed, 0xeb, 0xea, 0xec, 0xf0, 0xf5, 0xfb, 0x01, 0x07, 0x0b,
+    0x0f, 0x10, 0x0f, 0x0c, 0x09, 0x04, 0x00, 0xfc, 0xf9, 0xf8, 0xf9, 0xfb,
+    0xff, 0x03, 0x08, 0x0c, 0x0f, 0x10, 0x0f, 0x0d, 0x08, 0x02, 0xfb, 0xf3,
+    0xec, 0xe7, 0xe3, 0xe2, 0xe3, 0xe7, 0xec, 0xf4, 0xfc, 0x05, 0x0d, 0x14,
+    0x19, 0x1c, 0x1d, 0x1c, 0x19, 0x14, 0x0e, 0x08, 0x02, 0xfc, 0xf7, 0xf3,
+    0xf0, 0xee, 0xee, 0xee, 0xf0, 0xf2, 0xf4, 0xf7, 0xfa, 0xfd, 0x00, 0x03,
+    0x04, 0x06, 0x06, 0x07, 0x06, 0x05, 0x04, 0x02, 0x00, 0xff, 0xfe, 0xfe,
+    0xfe, 0xff, 0x01, 0x03, 0x06, 0x09, 0x0b, 0x0c, 0x0c, 0x0b, 0x08, 0x04,
+    0xff, 0xf9, 0xf3, 0xee, 0xe9, 0xe6, 0xe5, 0xe7, 0xea, 0xef, 0xf5, 0xfd,
+    0x05, 0x0c, 0x12, 0x17, 0x19, 0x1a, 0x18, 0x15, 0x10, 0x0b, 0x05, 0x00,
+    0xfb, 0xf8, 0xf5, 0xf4, 0xf4, 0xf5, 0xf6, 0xf8, 0xf9, 0xf9, 0xf9, 0xf9,
+    0xf8, 0xf7, 0xf7, 0xf7, 0xf8, 0xfa, 0xfd, 0x01, 0x06, 0x0a, 0x0e, 0x11,
+    0x12, 0x11, 0x0f, 0x0c, 0x07, 0x01, 0xfc, 0xf7, 0xf4, 0xf3, 0xf3, 0xf6,
+    0xfa, 0xfe, 0x03, 0x08, 0x0a, 0x0b, 0x0a, 0x06, 0x01, 0xfa, 0xf2, 0xeb,
+    0xe6, 0xe3, 0xe3, 0xe6, 0xec, 0xf5, 0x00, 0x0c, 0x18, 0x22, 0x29, 0x2c,
+    0x2c, 0x27, 0x1e, 0x12, 0x05, 0xf7, 0xea, 0xdf, 0xd8, 0xd5, 0xd6, 0xdb,
+    0xe3, 0xee, 0xfa, 0x05, 0x0e, 0x15, 0x19, 0x19, 0x16, 0x10, 0x09, 0x01,
+    0xfa, 0xf4, 0xf0, 0xf0, 0xf2, 0xf6, 0xfd, 0x04, 0x0b, 0x12, 0x16, 0x17,
+    0x16, 0x12, 0x0b, 0x03, 0xfb, 0xf3, 0xec, 0xe7, 0xe5, 0xe5, 0xe8, 0xed,
+    0xf4, 0xfb, 0x01, 0x07, 0x0a, 0x0c, 0x0c, 0x0a, 0x07, 0x03, 0x00, 0xfe,
+    0xfd, 0xfe, 0x01, 0x04, 0x09, 0x0e, 0x11, 0x14, 0x14, 0x12, 0x0d, 0x05,
+    0xfd, 0xf3, 0xea, 0xe1, 0xdc, 0xd9, 0xda, 0xdf, 0xe7, 0xf1, 0xfd, 0x09,
+    0x14, 0x1d, 0x23, 0x24, 0x23, 0x1d, 0x15, 0x0b, 0x01, 0xf7, 0xf0, 0xeb,
+    0xe9, 0xea, 0xee, 0xf4, 0xfc, 0x03, 0x0b, 0x10, 0x13, 0x13, 0x10, 0x0b,
+    0x04, 0xfb, 0xf2, 0xeb, 0xe5, 0xe2, 0xe2, 0xe5, 0xea, 0xf2, 0xfc, 0x06,
+    0x0f, 0x16, 0x1c, 0x1f, 0x1f, 0x1c, 0x18, 0x12, 0x0b, 0x03, 0xfd, 0xf7,
+    0xf3, 0xf0, 0xef, 0xef, 0xf0, 0xf1, 0xf3, 0xf5, 0xf6, 0xf7, 0xf8, 0xfa,
+    0xfb, 0xfc, 0xfe, 0x00, 0x03, 0x06, 0x09, 0x0c, 0x0e, 0x0f, 0x0f, 0x0e,
+    0x0c, 0x09, 0x06, 0x02, 0xfe, 0xfa, 0xf8, 0xf6, 0xf5, 0xf5, 0xf6, 0xf8,
+    0xfb, 0xfd, 0xff, 0x00, 0x01, 0x00, 0xff, 0xfd, 0xfb, 0xf9, 0xf7, 0xf6,
+    0xf6, 0xf8, 0xfa, 0xfe, 0x02, 0x07, 0x0b, 0x0f, 0x12, 0x14, 0x14, 0x13,
+    0x10, 0x0c, 0x08, 0x03, 0xfe, 0xf9, 0xf4, 0xf0, 0xed, 0xeb, 0xea, 0xea,
+    0xeb, 0xed, 0xf0, 0xf3, 0xf8, 0xfd, 0x02, 0x08, 0x0d, 0x11, 0x15, 0x17,
+    0x17, 0x17, 0x14, 0x10, 0x0b, 0x05, 0xff, 0xf9, 0xf3, 0xef, 0xed, 0xed,
+    0xee, 0xf1, 0xf6, 0xfb, 0x00, 0x05, 0x08, 0x0a, 0x0b, 0x09, 0x05, 0x00,
+    0xfb, 0xf5, 0xf0, 0xed, 0xec, 0xee, 0xf2, 0xf8, 0x00, 0x08, 0x11, 0x18,
+    0x1e, 0x20, 0x20, 0x1d, 0x16, 0x0e, 0x04, 0xf9, 0xf0, 0xe8, 0xe2, 0xdf,
+    0xdf, 0xe2, 0xe7, 0xee, 0xf6, 0xfe, 0x05, 0x0a, 0x0e, 0x0f, 0x0f, 0x0d,
+    0x09, 0x06, 0x03, 0x01, 0x00, 0x00, 0x02, 0x05, 0x08, 0x0a, 0x0c, 0x0c,
+    0x0b, 0x08, 0x03, 0xfd, 0xf6, 0xf0, 0xeb, 0xe8, 0xe7, 0xe8, 0xec, 0xf1,
+    0xf8, 0x00, 0x07, 0x0e, 0x12, 0x14, 0x13, 0x10, 0x0b, 0x04, 0xfd, 0xf7,
+    0xf2, 0xf0, 0xf1, 0xf4, 0xfa, 0x02, 0x0a, 0x12, 0x18, 0x1c, 0x1c, 0x19,
+    0x12, 0x09, 0xfd, 0xf0, 0xe5, 0xdb, 0xd4, 0xd2, 0xd4, 0xda, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0x01,
+    0x03, 0x04, 0x07, 0x0a, 0x0c, 0x10, 0x12, 0x15, 0x17, 0x19, 0x1b, 0x1a,
+    0x1a, 0x17, 0x12, 0x0d, 0x06, 0xff, 0xf6, 0xee, 0xe6, 0xde, 0xd7, 0xd0,
+    0xcb, 0xc7, 0xc5, 0xc4, 0xc5, 0xc8, 0xcb, 0xd1, 0xd8, 0xe1, 0xea, 0xf3,
+    0xff, 0x0f, 0x20, 0x28, 0x1b, 0x12, 0x2a, 0x44, 0x44, 0x41, 0x30, 0x10,
+    0x02, 0xee, 0xec, 0x04, 0x07, 0xfe, 0xfa, 0x02, 0x02, 0xfd, 0x02, 0xff,
+    0xff, 0x01, 0xff, 0x01, 0x04, 0x0b, 0x1c, 0x30, 0x3a, 0x2c, 0x0a, 0xf3,
+    0xee, 0xec, 0xf1, 0xfd, 0xfe, 0xf8, 0xfc, 0xfb, 0xf7, 0xfc, 0xf8, 0xf5,
+    0xed, 0xd9, 0xc6, 0xbc, 0xc8, 0xdc, 0xdc, 0xd5, 0xd9, 0xe2, 0xe0, 0xe2,
+    0xe9, 0xed, 0xfc, 0x11, 0x21, 0x2a, 0x22, 0x23, 0x36, 0x48, 0x4c, 0x3c,
+    0x2e, 0x30, 0x35, 0x2d, 0x26, 0x2a, 0x25, 0x22, 0x24, 0x1e, 0x1d, 0x1b,
+    0x15, 0x10, 0x00, 0xea, 0xd7, 0xd1, 0xd8, 0xd0, 0xb7, 0xac, 0xbc, 0xca,
+    0xcb, 0xd0, 0xd3, 0xd3, 0xd6, 0xd7, 0xdb, 0xe0, 0xe9, 0xfa, 0x10, 0x21,
+    0x1d, 0x0c, 0x06, 0x0f, 0x11, 0x0a, 0x0b, 0x0e, 0x0b, 0x11, 0x1b, 0x28,
+    0x3b, 0x40, 0x35, 0x21, 0x09, 0xf5, 0xe7, 0xef, 0x03, 0x03, 0xf9, 0xfa,
+    0xff, 0xfc, 0xfc, 0xfe, 0xfc, 0xfd, 0xfe, 0xfd, 0xff, 0x03, 0x0c, 0x1e,
+    0x2f, 0x34, 0x1f, 0xff, 0xee, 0xea, 0xea, 0xf1, 0xfa, 0xf9, 0xf8, 0xfc,
+    0xf7, 0xf7, 0xf9, 0xf5, 0xf3, 0xe7, 0xd3, 0xc3, 0xbe, 0xcf, 0xdd, 0xda,
+    0xd7, 0xdd, 0xe1, 0xe0, 0xe5, 0xea, 0xf0, 0x03, 0x16, 0x23, 0x26, 0x1f,
+    0x26, 0x38, 0x46, 0x45, 0x35, 0x2c, 0x2f, 0x31, 0x29, 0x26, 0x27, 0x21,
+    0x21, 0x20, 0x1c, 0x1c, 0x18, 0x13, 0x0c, 0xfa, 0xe5, 0xd4, 0xd2, 0xd6,
+    0xc9, 0xb5, 0xb3, 0xc3, 0xcc, 0xce, 0xd4, 0xd5, 0xd5, 0xd8, 0xd9, 0xdd,
+    0xe3, 0xee, 0x02, 0x16, 0x21, 0x18, 0x09, 0x08, 0x10, 0x0e, 0x0a, 0x0d,
+    0x0c, 0x0c, 0x14, 0x1e, 0x2d, 0x3c, 0x3c, 0x2f, 0x1a, 0x04, 0xf0, 0xe7,
+    0xf4, 0x03, 0x00, 0xfa, 0xfc, 0xfe, 0xfb, 0xfd, 0xfe, 0xfc, 0xfe, 0xfe,
+    0xfd, 0x00, 0x04, 0x10, 0x23, 0x30, 0x2d, 0x13, 0xf8, 0xec, 0xea, 0xed,
+    0xf4, 0xfa, 0xf9, 0xfb, 0xfb, 0xf7, 0xf9, 0xf8, 0xf5, 0xf1, 0xe3, 0xd1,
+    0xc3, 0xc4, 0xd6, 0xde, 0xdb, 0xdb, 0xe1, 0xe2, 0xe2, 0xe9, 0xed, 0xf7,
+    0x0a, 0x1a, 0x24, 0x22, 0x20, 0x2b, 0x3b, 0x44, 0x3e, 0x2f, 0x2a, 0x2e,
+    0x2c, 0x25, 0x25, 0x24, 0x1f, 0x20, 0x1d, 0x1b, 0x1a, 0x15, 0x11, 0x07,
+    0xf4, 0xe1, 0xd4, 0xd4, 0xd4, 0xc5, 0xb7, 0xbb, 0xc8, 0xcd, 0xd2, 0xd8,
+    0xd8, 0xd9, 0xdb, 0xdc, 0xe1, 0xe7, 0xf4, 0x08, 0x1a, 0x1f, 0x13, 0x08,
+    0x0a, 0x0e, 0x0c, 0x0a, 0x0d, 0x0b, 0x0e, 0x17, 0x22, 0x32, 0x3b, 0x36,
+    0x27, 0x13, 0xfe, 0xec, 0xea, 0xf9, 0x02, 0xfe, 0xfb, 0xfe, 0xfd, 0xfb,
+    0xfd, 0xfd, 0xfc, 0xfe, 0xfd, 0xfe, 0x01, 0x07, 0x15, 0x25, 0x2f, 0x26,
+    0x0a, 0xf3, 0xeb, 0xeb, 0xef, 0xf6, 0xfa, 0xfa, 0xfc, 0xfb, 0xf8, 0xf9,
+    0xf7, 0xf5, 0xee, 0xdf, 0xce, 0xc4, 0xcb, 0xdb, 0xdf, 0xdd, 0xde, 0xe3,
+    0xe3, 0xe5, 0xeb, 0xf0, 0xfe, 0x10, 0x1d, 0x23, 0x20, 0x21, 0x2e, 0x3b,
+    0x40, 0x37, 0x2b, 0x29, 0x2c, 0x28, 0x23, 0x24, 0x20, 0x1e, 0x1e, 0x1a,
+    0x19, 0x18, 0x13, 0x0e, 0x01, 0xef, 0xdd, 0xd4, 0xd5, 0xd0, 0xc1, 0xba,
+    0xc3, 0xcc, 0xd0, 0xd7, 0xda, 0xda, 0xdc, 0xdd, 0xdf, 0xe4, 0xeb, 0xfa,
+    0x0d, 0x1c, 0x1d, 0x10, 0x08, 0x0b, 0x0d, 0x0a, 0x0b, 0x0c, 0x0b, 0x10,
+    0x19, 0x25, 0x34, 0x38, 0x30, 0x21, 0x0e, 0xf9, 0xea, 0xed, 0xfb, 0x01,
+    0xfe, 0xfd, 0xfe, 0xfc, 0xfb, 0xfe, 0xfc, 0xfd, 0xfe, 0xfd, 0xff, 0x02,
+    0x0a, 0x19, 0x27, 0x2c, 0x1c, 0x01, 0xf0, 0xeb, 0xec, 0xf0, 0xf7, 0xfa,
+    0xfb, 0xfd, 0xfa, 0xf9, 0xf9, 0xf6, 0xf4, 0xeb, 0xdc, 0xcd, 0xc7, 0xd1,
+    0xde, 0xe0, 0xdf, 0xe2, 0xe4, 0xe4, 0xe8, 0xee, 0xf5, 0x05, 0x14, 0x1e,
+    0x21, 0x1f, 0x24, 0x31, 0x3c, 0x3c, 0x31, 0x28, 0x28, 0x29, 0x24, 0x23,
+    0x22, 0x1d, 0x1c, 0x1b, 0x18, 0x18, 0x15, 0x11, 0x0a, 0xfc, 0xea, 0xda,
+    0xd4, 0xd5, 0xcd, 0xc2, 0xc0, 0xc8, 0xce, 0xd3, 0xda, 0xdc, 0xdd, 0xde,
+    0xde, 0xe1, 0xe6, 0xef, 0xff, 0x11, 0x1d, 0x18, 0x0c, 0x08, 0x0a, 0x0a,
+    0x09, 0x0b, 0x0b, 0x0c, 0x12, 0x1c, 0x29, 0x34, 0x34, 0x2b, 0x1b, 0x08,
+    0xf4, 0xe9, 0xf1, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfd, 0xfc,
+    0xfd, 0xfe, 0xfe, 0x00, 0x03, 0x0d, 0x1c, 0x28, 0x27, 0x13, 0xfb, 0xee,
+    0xeb, 0xed, 0xf2, 0xf8, 0xfa, 0xfc, 0xfc, 0xfa, 0xfa, 0xf8, 0xf6, 0xf2,
+    0xe7, 0xd8, 0xcc, 0xcb, 0xd7, 0xe0, 0xe1, 0xe1, 0xe4, 0xe5, 0xe6, 0xeb,
+    0xf0, 0xfa, 0x0a, 0x16, 0x1e, 0x1e, 0x1f, 0x27, 0x32, 0x3a, 0x37, 0x2c,
+    0x25, 0x26, 0x25, 0x22, 0x21, 0x1f, 0x1c, 0x1b, 0x19, 0x17, 0x16, 0x13,
+    0x0f, 0x06, 0xf7, 0xe6, 0xd8, 0xd5, 0xd3, 0xca, 0xc2, 0xc5, 0xcc, 0xd0,
+    0xd6, 0xdc, 0xde, 0xdf, 0xe0, 0xe1, 0xe4, 0xe9, 0xf3, 0x04, 0x14, 0x1c,
+    0x15, 0x0b, 0x09, 0x0a, 0x09, 0x09, 0x0b, 0x0b, 0x0d, 0x15, 0x1f, 0x2b,
+    0x32, 0x2f, 0x26, 0x16, 0x02, 0xf0, 0xeb, 0xf4, 0xfc, 0xfe, 0xfe, 0xff,
+    0xfe, 0xfc, 0xfd, 0xfd, 0xfc, 0xfe, 0xfd, 0xfe, 0x00, 0x05, 0x10, 0x1e,
+    0x27, 0x21, 0x0c, 0xf8, 0xed, 0xeb, 0xed, 0xf3, 0xf8, 0xfb, 0xfd, 0xfc,
+    0xfb, 0xfa, 0xf8, 0xf6, 0xf0, 0xe4, 0xd6, 0xcc, 0xd0, 0xda, 0xe1, 0xe2,
+    0xe4, 0xe6, 0xe6, 0xe8, 0xed, 0xf3, 0x00, 0x0e, 0x19, 0x1d, 0x1d, 0x20,
+    0x29, 0x33, 0x38, 0x32, 0x28, 0x24, 0x24, 0x22, 0x20, 0x20, 0x1d, 0x1b,
+    0x19, 0x17, 0x16, 0x14, 0x11, 0x0c, 0x02, 0xf3, 0xe2, 0xd8, 0xd5, 0xd1,
+    0xc9, 0xc5, 0xc9, 0xce, 0xd2, 0xd9, 0xde, 0xdf, 0xe2, 0xe2, 0xe3, 0xe6,
+    0xec, 0xf8, 0x09, 0x16, 0x1a, 0x11, 0x0a, 0x09, 0x09, 0x08, 0x09, 0x0b,
+    0x0b, 0x0f, 0x17, 0x21, 0x2c, 0x30, 0x2c, 0x21, 0x11, 0xfd, 0xee, 0xed,
+    0xf5, 0xfc, 0xfe, 0xff, 0x00, 0xfe, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xfd,
+    0xff, 0x01, 0x08, 0x13, 0x20, 0x25, 0x19, 0x05, 0xf4, 0xed, 0xec, 0xef,
+    0xf5, 0xf9, 0xfc, 0xfd, 0xfc, 0xfb, 0xfa, 0xf8, 0xf5, 0xed, 0xe1, 0xd4,
+    0xce, 0xd4, 0xdd, 0xe2, 0xe4, 0xe6, 0xe8, 0xe8, 0xea, 0xef, 0xf7, 0x04,
+    0x11, 0x19, 0x1c, 0x1d, 0x22, 0x2b, 0x34, 0x35, 0x2e, 0x25, 0x23, 0x21,
+    0x1f, 0x1e, 0x1e, 0x1c, 0x1a, 0x18, 0x16, 0x14, 0x12, 0x0f, 0x09, 0xfe,
+    0xee, 0xdf, 0xd7, 0xd4, 0xcf, 0xc9, 0xc9, 0xce, 0xd1, 0xd6, 0xdd, 0xe0,
+    0xe2, 0xe4, 0xe4, 0xe5, 0xe8, 0xef, 0xfd, 0x0c, 0x18, 0x17, 0x10, 0x0a,
+    0x09, 0x08, 0x07, 0x09, 0x0a, 0x0c, 0x12, 0x1a, 0x25, 0x2d, 0x2d, 0x27,
+    0x1a, 0x09, 0xf7, 0xec, 0xee, 0xf6, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xfc,
+    0xfc, 0xfb, 0xfd, 0xfd, 0xfe, 0x00, 0x03, 0x0a, 0x16, 0x20, 0x21, 0x13,
+    0x00, 0xf3, 0xed, 0xec, 0xf0, 0xf5, 0xf9, 0xfc, 0xfd, 0xfc, 0xfc, 0xfa,
+    0xf8, 0xf4, 0xeb, 0xdf, 0xd3, 0xd1, 0xd8, 0xe0, 0xe4, 0xe6, 0xe9, 0xe9,
+    0xe9, 0xed, 0xf2, 0xfc, 0x09, 0x14, 0x1a, 0x1b, 0x1d, 0x24, 0x2c, 0x33,
+    0x31, 0x2a, 0x23, 0x21, 0x1f, 0x1d, 0x1d, 0x1c, 0x1a, 0x19, 0x16, 0x14,
+    0x13, 0x11, 0x0d, 0x06, 0xfa, 0xeb, 0xdd, 0xd7, 0xd3, 0xce, 0xca, 0xcc,
+    0xd0, 0xd4, 0xd9, 0xde, 0xe1, 0xe3, 0xe5, 0xe5, 0xe8, 0xeb, 0xf4, 0x01,
+    0x0f, 0x17, 0x14, 0x0e, 0x0a, 0x09, 0x07, 0x07, 0x09, 0x0a, 0x0e, 0x14,
+    0x1c, 0x26, 0x2b, 0x2a, 0x24, 0x17, 0x06, 0xf6, 0xee, 0xf1, 0xf7, 0xfb,
+    0xfe, 0x00, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xfd, 0xfd, 0xfe, 0x00, 0x04,
+    0x0d, 0x18, 0x20, 0x1c, 0x0c, 0xfb, 0xf1, 0xee, 0xee, 0xf2, 0xf7, 0xfa,
+    0xfd, 0xfd, 0xfd, 0xfc, 0xfa, 0xf7, 0xf2, 0xe8, 0xdc, 0xd4, 0xd4, 0xdb,
+    0xe1, 0xe5, 0xe8, 0xea, 0xea, 0xec, 0xef, 0xf6, 0x00, 0x0c, 0x15, 0x19,
+    0x1b, 0x1e, 0x25, 0x2d, 0x31, 0x2d, 0x26, 0x21, 0x1f, 0x1d, 0x1b, 0x1c,
+    0x1a, 0x19, 0x17, 0x15, 0x13, 0x11, 0x0f, 0x0b, 0x02, 0xf5, 0xe7, 0xdc,
+    0xd6, 0xd2, 0xce, 0xcd, 0xd0, 0xd3, 0xd7, 0xdc, 0xe0, 0xe3, 0xe5, 0xe6,
+    0xe8, 0xea, 0xee, 0xf8, 0x05, 0x11, 0x16, 0x12, 0x0d, 0x0a, 0x08, 0x06,
+    0x07, 0x09, 0x0b, 0x10, 0x17, 0x1f, 0x27, 0x2a, 0x27, 0x1f, 0x11, 0x00,
+    0xf3, 0xef, 0xf3, 0xf8, 0xfb, 0xfe, 0x00, 0xff, 0xfe, 0xfd, 0xfc, 0xfd,
+    0xfd, 0xfd, 0xfe, 0x01, 0x06, 0x0f, 0x19, 0x1e, 0x16, 0x07, 0xfa, 0xf2,
+    0xee, 0xef, 0xf3, 0xf7, 0xfb, 0xfd, 0xfe, 0xfd, 0xfc, 0xfa, 0xf7, 0xf0,
+    0xe6, 0xdb, 0xd5, 0xd7, 0xde, 0xe3, 0xe6, 0xea, 0xeb, 0xec, 0xee, 0xf2,
+    0xfa, 0x05, 0x0f, 0x16, 0x19, 0x1b, 0x1f, 0x26, 0x2d, 0x2f, 0x2a, 0x23,
+    0x1f, 0x1d, 0x1a, 0x1a, 0x1a, 0x19, 0x18, 0x16, 0x14, 0x12, 0x10, 0x0d,
+    0x08, 0xfe, 0xf1, 0xe4, 0xdb, 0xd6, 0xd1, 0xcf, 0xd0, 0xd3, 0xd6, 0xda,
+    0xdf, 0xe2, 0xe5, 0xe7, 0xe8, 0xea, 0xec, 0xf2, 0xfd, 0x09, 0x13, 0x14,
+    0x10, 0x0c, 0x0a, 0x07, 0x06, 0x07, 0x09, 0x0c, 0x11, 0x19, 0x21, 0x27,
+    0x27, 0x24, 0x1b, 0x0c, 0xfd, 0xf2, 0xf0, 0xf4, 0xf8, 0xfc, 0xff, 0x00,
+    0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0x02, 0x09, 0x12, 0x1a,
+    0x1b, 0x10, 0x02, 0xf6, 0xf0, 0xee, 0xf0, 0xf4, 0xf8, 0xfc, 0xfe, 0xfe,
+    0xfd, 0xfc, 0xfa, 0xf6, 0xee, 0xe3, 0xda, 0xd7, 0xda, 0xe0, 0xe5, 0xe9,
+    0xec, 0xed, 0xee, 0xf1, 0xf5, 0xfe, 0x08, 0x10, 0x16, 0x19, 0x1c, 0x21,
+    0x27, 0x2d, 0x2c, 0x26, 0x21, 0x1d, 0x1a, 0x18, 0x18, 0x18, 0x17, 0x17,
+    0x15, 0x13, 0x11, 0x0e, 0x0b, 0x05, 0xfb, 0xee, 0xe2, 0xda, 0xd5, 0xd1,
+    0xd0, 0xd2, 0xd5, 0xd8, 0xdc, 0xe0, 0xe3, 0xe6, 0xe8, 0xea, 0xec, 0xef,
+    0xf5, 0x00, 0x0c, 0x13, 0x13, 0x0f, 0x0c, 0x09, 0x06, 0x06, 0x07, 0x09,
+    0x0d, 0x14, 0x1b, 0x22, 0x26, 0x25, 0x20, 0x16, 0x07, 0xf9, 0xf2, 0xf2,
+    0xf5, 0xf9, 0xfc, 0xff, 0x00, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfe,
+    0x00, 0x04, 0x0b, 0x14, 0x1a, 0x17, 0x0c, 0xff, 0xf6, 0xf0, 0xee, 0xf1,
+    0xf5, 0xf9, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xf9, 0xf4, 0xec, 0xe1, 0xda,
+    0xd9, 0xdd, 0xe2, 0xe7, 0xeb, 0xed, 0xee, 0xf0, 0xf3, 0xf8, 0x01, 0x0a,
+    0x11, 0x16, 0x19, 0x1c, 0x22, 0x28, 0x2c, 0x29, 0x24, 0x1f, 0x1b, 0x18,
+    0x17, 0x17, 0x16, 0x16, 0x15, 0x14, 0x12, 0x10, 0x0d, 0x09, 0x02, 0xf7,
+    0xea, 0xdf, 0xd9, 0xd5, 0xd2, 0xd2, 0xd5, 0xd8, 0xdb, 0xdf, 0xe2, 0xe5,
+    0xe8, 0xea, 0xeb, 0xee, 0xf1, 0xf9, 0x03, 0x0e, 0x12, 0x11, 0x0e, 0x0b,
+    0x08, 0x06, 0x06, 0x07, 0x0a, 0x0f, 0x15, 0x1d, 0x22, 0x24, 0x23, 0x1d,
+    0x12, 0x04, 0xf8, 0xf2, 0xf3, 0xf6, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xfd, 0xfd, 0xfd, 0xff, 0x01, 0x05, 0x0d, 0x15, 0x18, 0x13, 0x07,
+    0xfd, 0xf5, 0xf0, 0xef, 0xf2, 0xf5, 0xf9, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc,
+    0xf9, 0xf3, 0xea, 0xe0, 0xdb, 0xdb, 0xdf, 0xe4, 0xe9, 0xec, 0xef, 0xf0,
+    0xf2, 0xf5, 0xfc, 0x04, 0x0c, 0x12, 0x16, 0x19, 0x1d, 0x23, 0x29, 0x2a,
+    0x27, 0x21, 0x1d, 0x19, 0x16, 0x15, 0x15, 0x15, 0x15, 0x14, 0x13, 0x11,
+    0x0f, 0x0c, 0x07, 0xff, 0xf4, 0xe8, 0xde, 0xd8, 0xd5, 0xd3, 0xd5, 0xd7,
+    0xda, 0xdd, 0xe1, 0xe4, 0xe7, 0xe9, 0xeb, 0xed, 0xef, 0xf4, 0xfc, 0x07,
+    0x0f, 0x12, 0x10, 0x0d, 0x0a, 0x07, 0x05, 0x06, 0x07, 0x0b, 0x10, 0x17,
+    0x1e, 0x22, 0x23, 0x20, 0x19, 0x0e, 0x01, 0xf7, 0xf3, 0xf4, 0xf6, 0xfa,
+    0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0x02, 0x07,
+    0x0e, 0x15, 0x16, 0x0f, 0x04, 0xfb, 0xf4, 0xf0, 0xf0, 0xf2, 0xf6, 0xfa,
+    0xfc, 0xfe, 0xfe, 0xfd, 0xfc, 0xf8, 0xf1, 0xe8, 0xdf, 0xdc, 0xdd, 0xe1,
+    0xe6, 0xea, 0xee, 0xf0, 0xf1, 0xf4, 0xf8, 0xff, 0x06, 0x0d, 0x12, 0x15,
+    0x19, 0x1e, 0x24, 0x28, 0x28, 0x25, 0x20, 0x1b, 0x17, 0x15, 0x14, 0x14,
+    0x14, 0x14, 0x13, 0x12, 0x10, 0x0e, 0x0a, 0x05, 0xfc, 0xf0, 0xe5, 0xdd,
+    0xd8, 0xd5, 0xd5, 0xd7, 0xd9, 0xdc, 0xe0, 0xe3, 0xe5, 0xe8, 0xea, 0xec,
+    0xee, 0xf1, 0xf7, 0xff, 0x09, 0x0f, 0x11, 0x0f, 0x0c, 0x09, 0x06, 0x05,
+    0x06, 0x08, 0x0c, 0x12, 0x18, 0x1e, 0x21, 0x21, 0x1e, 0x15, 0x0a, 0xfe,
+    0xf6, 0xf4, 0xf5, 0xf7, 0xfa, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0x00, 0x03, 0x08, 0x0f, 0x14, 0x13, 0x0b, 0x02, 0xfa, 0xf4,
+    0xf1, 0xf1, 0xf3, 0xf6, 0xfa, 0xfc, 0xfe, 0xfe, 0xfe, 0xfb, 0xf7, 0xf0,
+    0xe7, 0xe0, 0xdd, 0xdf, 0xe3, 0xe7, 0xec, 0xef, 0xf1, 0xf3, 0xf6, 0xfb,
+    0x02, 0x09, 0x0e, 0x12, 0x15, 0x19, 0x1e, 0x24, 0x27, 0x26, 0x22, 0x1e,
+    0x19, 0x16, 0x14, 0x13, 0x12, 0x12, 0x12, 0x12, 0x11, 0x0f, 0x0c, 0x09,
+    0x02, 0xf9, 0xee, 0xe3, 0xdc, 0xd8, 0xd6, 0xd7, 0xd9, 0xdb, 0xdf, 0xe2,
+    0xe5, 0xe7, 0xea, 0xeb, 0xed, 0xf0, 0xf3, 0xfa, 0x02, 0x0b, 0x10, 0x10,
+    0x0e, 0x0b, 0x08, 0x06, 0x05, 0x06, 0x08, 0x0d, 0x13, 0x19, 0x1e, 0x20,
+    0x1f, 0x1b, 0x12, 0x07, 0xfc, 0xf6, 0xf4, 0xf5, 0xf7, 0xfb, 0xfd, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x04, 0x0a, 0x10, 0x13,
+    0x10, 0x08, 0x00, 0xf9, 0xf4, 0xf1, 0xf2, 0xf4, 0xf7, 0xfb, 0xfd, 0xfe,
+    0xfe, 0xfd, 0xfb, 0xf6, 0xee, 0xe6, 0xe0, 0xdf, 0xe1, 0xe4, 0xe9, 0xed,
+    0xf0, 0xf2, 0xf5, 0xf8, 0xfd, 0x04, 0x0a, 0x0f, 0x12, 0x15, 0x19, 0x1f,
+    0x24, 0x26, 0x24, 0x20, 0x1c, 0x18, 0x14, 0x12, 0x12, 0x11, 0x11, 0x11,
+    0x11, 0x10, 0x0e, 0x0b, 0x07, 0x00, 0xf6, 0xeb, 0xe2, 0xdc, 0xd8, 0xd7,
+    0xd8, 0xdb, 0xdd, 0xe1, 0xe4, 0xe6, 0xe9, 0xeb, 0xed, 0xef, 0xf1, 0xf6,
+    0xfc, 0x05, 0x0c, 0x0f, 0x0f, 0x0d, 0x0a, 0x08, 0x06, 0x05, 0x06, 0x09,
+    0x0e, 0x14, 0x1a, 0x1e, 0x1f, 0x1d, 0x18, 0x0e, 0x03, 0xfa, 0xf6, 0xf5,
+    0xf6, 0xf8, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
+    0x01, 0x05, 0x0b, 0x10, 0x11, 0x0d, 0x06, 0xff, 0xf8, 0xf4, 0xf2, 0xf3,
+    0xf5, 0xf8, 0xfb, 0xfd, 0xfe, 0xfe, 0xfd, 0xfa, 0xf5, 0xed, 0xe6, 0xe1,
+    0xe1, 0xe3, 0xe6, 0xea, 0xee, 0xf1, 0xf3, 0xf6, 0xfa, 0x00, 0x06, 0x0b,
+    0x0f, 0x12, 0x16, 0x1a, 0x1f, 0x23, 0x24, 0x22, 0x1f, 0x1a, 0x16, 0x13,
+    0x11, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x0d, 0x0a, 0x05, 0xfd, 0xf3,
+    0xe9, 0xe1, 0xdb, 0xd9, 0xd8, 0xda, 0xdc, 0xdf, 0xe3, 0xe5, 0xe8, 0xea,
+    0xec, 0xee, 0xf0, 0xf3, 0xf8, 0xff, 0x07, 0x0d, 0x0f, 0x0e, 0x0c, 0x09,
+    0x07, 0x05, 0x05, 0x06, 0x0a, 0x0f, 0x15, 0x1a, 0x1d, 0x1e, 0x1b, 0x15,
+    0x0b, 0x01, 0xfa, 0xf6, 0xf5, 0xf6, 0xf9, 0xfb, 0xfd, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x02, 0x06, 0x0c, 0x10, 0x0f, 0x0a, 0x04,
+    0xfd, 0xf7, 0xf3, 0xf3, 0xf3, 0xf6, 0xf9, 0xfb, 0xfd, 0xfe, 0xfe, 0xfd,
+    0xfa, 0xf4, 0xec, 0xe6, 0xe2, 0xe2, 0xe4, 0xe7, 0xeb, 0xef, 0xf2, 0xf5,
+    0xf8, 0xfd, 0x02, 0x07, 0x0c, 0x0f, 0x12, 0x16, 0x1a, 0x1f, 0x23, 0x23,
+    0x20, 0x1d, 0x19, 0x15, 0x12, 0x10, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+    0x0c, 0x09, 0x03, 0xfb, 0xf1, 0xe7, 0xe0, 0xdb, 0xd9, 0xd9, 0xdb, 0xde,
+    0xe1, 0xe5, 0xe7, 0xea, 0xec, 0xee, 0xef, 0xf1, 0xf5, 0xfa, 0x01, 0x08,
+    0x0d, 0x0e, 0x0e, 0x0c, 0x09, 0x06, 0x05, 0x05, 0x07, 0x0b, 0x11, 0x16,
+    0x1a, 0x1c, 0x1c, 0x19, 0x11, 0x08, 0xff, 0xf8, 0xf5, 0xf5, 0xf6, 0xf9,
+    0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0x00, 0x02, 0x07,
+    0x0c, 0x0f, 0x0d, 0x08, 0x02, 0xfc, 0xf7, 0xf4, 0xf3, 0xf4, 0xf6, 0xf9,
+    0xfb, 0xfd, 0xfe, 0xfe, 0xfd, 0xf9, 0xf2, 0xeb, 0xe6, 0xe3, 0xe4, 0xe6,
+    0xe9, 0xed, 0xf0, 0xf3, 0xf6, 0xfa, 0xff, 0x04, 0x08, 0x0c, 0x0f, 0x12,
+    0x16, 0x1b, 0x1f, 0x22, 0x21, 0x1f, 0x1b, 0x17, 0x13, 0x11, 0x0f, 0x0e,
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0d, 0x0b, 0x07, 0x01, 0xf9, 0xef, 0xe6, 0xe0,
+    0xdc, 0xda, 0xdb, 0xdd, 0xe0, 0xe3, 0xe6, 0xe9, 0xeb, 0xed, 0xef, 0xf0,
+    0xf3, 0xf6, 0xfc, 0x03, 0x09, 0x0d, 0x0e, 0x0d, 0x0b, 0x08, 0x06, 0x05,
+    0x05, 0x08, 0x0c, 0x11, 0x16, 0x1a, 0x1b, 0x1b, 0x16, 0x0f, 0x06, 0xfe,
+    0xf9, 0xf6, 0xf6, 0xf7, 0xf9, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xff, 0x00, 0x03, 0x08, 0x0c, 0x0e, 0x0b, 0x06, 0x01, 0xfb, 0xf7,
+    0xf4, 0xf4, 0xf5, 0xf7, 0xf9, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xf8, 0xf2,
+    0xeb, 0xe6, 0xe4, 0xe5, 0xe7, 0xea, 0xee, 0xf1, 0xf4, 0xf8, 0xfc, 0x01,
+    0x05, 0x09, 0x0d, 0x10, 0x12, 0x16, 0x1b, 0x1f, 0x20, 0x1f, 0x1d, 0x19,
+    0x15, 0x12, 0x0f, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x0a, 0x06,
+    0xff, 0xf6, 0xed, 0xe5, 0xdf, 0xdc, 0xdb, 0xdc, 0xdf, 0xe2, 0xe5, 0xe8,
+    0xea, 0xec, 0xee, 0xf0, 0xf1, 0xf4, 0xf8, 0xfe, 0x05, 0x0a, 0x0d, 0x0d,
+    0x0c, 0x0a, 0x08, 0x06, 0x05, 0x06, 0x09, 0x0d, 0x12, 0x16, 0x19, 0x1a,
+    0x19, 0x14, 0x0c, 0x04, 0xfd, 0xf8, 0xf6, 0xf6, 0xf7, 0xf9, 0xfb, 0xfd,
+    0xfe, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x01, 0x04, 0x09, 0x0c, 0x0c,
+    0x09, 0x05, 0x00, 0xfb, 0xf7, 0xf5, 0xf5, 0xf6, 0xf8, 0xfa, 0xfc, 0xfe,
+    0xfe, 0xfe, 0xfb, 0xf7, 0xf1, 0xeb, 0xe7, 0xe6, 0xe6, 0xe8, 0xec, 0xef,
+    0xf2, 0xf6, 0xf9, 0xfe, 0x02, 0x06, 0x0a, 0x0d, 0x10, 0x13, 0x16, 0x1b,
+    0x1e, 0x1f, 0x1e, 0x1b, 0x18, 0x14, 0x11, 0x0f, 0x0d, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0b, 0x08, 0x04, 0xfd, 0xf4, 0xeb, 0xe4, 0xdf, 0xdd, 0xdc,
+    0xde, 0xe0, 0xe3, 0xe6, 0xe9, 0xec, 0xee, 0xef, 0xf1, 0xf3, 0xf5, 0xfa,
+    0x00, 0x06, 0x0a, 0x0d, 0x0d, 0x0c, 0x0a, 0x07, 0x06, 0x05, 0x06, 0x0a,
+    0x0e, 0x12, 0x16, 0x19, 0x19, 0x17, 0x11, 0x0a, 0x02, 0xfc, 0xf8, 0xf6,
+    0xf6, 0xf8, 0xfa, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x02, 0x05, 0x09, 0x0b, 0x0a, 0x07, 0x03, 0xff, 0xfa, 0xf7, 0xf5, 0xf5,
+    0xf6, 0xf8, 0xfa, 0xfc, 0xfe, 0xfe, 0xfd, 0xfb, 0xf6, 0xf0, 0xeb, 0xe8,
+    0xe7, 0xe8, 0xea, 0xed, 0xf0, 0xf3, 0xf7, 0xfb, 0xff, 0x04, 0x08, 0x0b,
+    0x0d, 0x10, 0x13, 0x17, 0x1b, 0x1d, 0x1e, 0x1c, 0x19, 0x16, 0x12, 0x10,
+    0x0d, 0x0c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x07, 0x02, 0xfb, 0xf2,
+    0xea, 0xe4, 0xdf, 0xdd, 0xde, 0xdf, 0xe2, 0xe5, 0xe8, 0xea, 0xed, 0xef,
+    0xf0, 0xf2, 0xf4, 0xf7, 0xfc, 0x02, 0x07, 0x0b, 0x0d, 0x0c, 0x0b, 0x09,
+    0x07, 0x06, 0x05, 0x07, 0x0b, 0x0f, 0x13, 0x16, 0x18, 0x18, 0x15, 0x0f,
+    0x08, 0x01, 0xfb, 0xf8, 0xf6, 0xf7, 0xf8, 0xfa, 0xfc, 0xfd, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x06, 0x09, 0x0a, 0x09, 0x06, 0x02,
+    0xfd, 0xfa, 0xf7, 0xf6, 0xf6, 0xf7, 0xf9, 0xfb, 0xfc, 0xfe, 0xfe, 0xfd,
+    0xfa, 0xf5, 0xef, 0xeb, 0xe9, 0xe8, 0xe9, 0xeb, 0xee, 0xf1, 0xf5, 0xf8,
+    0xfd, 0x01, 0x05, 0x08, 0x0b, 0x0e, 0x10, 0x13, 0x17, 0x1b, 0x1c, 0x1c,
+    0x1b, 0x18, 0x15, 0x11, 0x0f, 0x0d, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0a,
+    0x09, 0x05, 0x00, 0xf8, 0xf0, 0xe9, 0xe3, 0xe0, 0xde, 0xdf, 0xe1, 0xe3,
+    0xe6, 0xe9, 0xec, 0xee, 0xf0, 0xf1, 0xf3, 0xf5, 0xf9, 0xfe, 0x03, 0x08,
+    0x0b, 0x0c, 0x0c, 0x0b, 0x08, 0x07, 0x06, 0x06, 0x08, 0x0b, 0x0f, 0x13,
+    0x16, 0x17, 0x16, 0x12, 0x0d, 0x06, 0xff, 0xfb, 0xf8, 0xf7, 0xf7, 0xf9,
+    0xfa, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x03, 0x06,
+    0x09, 0x09, 0x08, 0x05, 0x01, 0xfd, 0xfa, 0xf7, 0xf6, 0xf6, 0xf7, 0xf9,
+    0xfb, 0xfc, 0xfd, 0xfe, 0xfc, 0xf9, 0xf4, 0xef, 0xeb, 0xea, 0xe9, 0xea,
+    0xed, 0xef, 0xf2, 0xf6, 0xfa, 0xfe, 0x02, 0x06, 0x09, 0x0c, 0x0e, 0x10,
+    0x14, 0x17, 0x1a, 0x1b, 0x1b, 0x19, 0x17, 0x13, 0x10, 0x0e, 0x0c, 0x0b,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x09, 0x07, 0x04, 0xfe, 0xf6, 0xef, 0xe8, 0xe3,
+    0xe0, 0xdf, 0xe0, 0xe2, 0xe5, 0xe8, 0xea, 0xed, 0xef, 0xf1, 0xf2, 0xf4,
+    0xf6, 0xfa, 0xff, 0x05, 0x09, 0x0b, 0x0c, 0x0b, 0x0a, 0x08, 0x06, 0x06,
+    0x07, 0x09, 0x0c, 0x10, 0x13, 0x15, 0x16, 0x14, 0x10, 0x0a, 0x04, 0xfe,
+    0xfb, 0xf8, 0xf7, 0xf8, 0xf9, 0xfb, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x04, 0x07, 0x08, 0x08, 0x06, 0x03, 0x00, 0xfc, 0xf9,
+    0xf8, 0xf7, 0xf7, 0xf8, 0xfa, 0xfb, 0xfd, 0xfd, 0xfd, 0xfb, 0xf8, 0xf3,
+    0xef, 0xec, 0xeb, 0xea, 0xeb, 0xee, 0xf0, 0xf3, 0xf7, 0xfb, 0xff, 0x03,
+    0x07, 0x0a, 0x0c, 0x0e, 0x11, 0x14, 0x17, 0x1a, 0x1a, 0x1a, 0x18, 0x15,
+    0x12, 0x10, 0x0d, 0x0b, 0x0a, 0x0a, 0x09, 0x09, 0x09, 0x08, 0x06, 0x02,
+    0xfc, 0xf4, 0xed, 0xe8, 0xe3, 0xe1, 0xe1, 0xe2, 0xe4, 0xe6, 0xe9, 0xec,
+    0xee, 0xf0, 0xf2, 0xf3, 0xf5, 0xf8, 0xfc, 0x01, 0x06, 0x09, 0x0b, 0x0c,
+    0x0b, 0x09, 0x07, 0x06, 0x06, 0x07, 0x0a, 0x0d, 0x10, 0x13, 0x14, 0x14,
+    0x12, 0x0e, 0x08, 0x02, 0xfd, 0xfa, 0xf8, 0xf8, 0xf8, 0xfa, 0xfb, 0xfd,
+    0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05, 0x07, 0x08, 0x07,
+    0x05, 0x02, 0xff, 0xfc, 0xf9, 0xf8, 0xf7, 0xf7, 0xf8, 0xfa, 0xfb, 0xfd,
+    0xfd, 0xfd, 0xfa, 0xf7, 0xf2, 0xef, 0xec, 0xeb, 0xeb, 0xed, 0xef, 0xf2,
+    0xf5, 0xf9, 0xfd, 0x01, 0x05, 0x08, 0x0a, 0x0c, 0x0e, 0x11, 0x14, 0x17,
+    0x19, 0x19, 0x19, 0x17, 0x14, 0x11, 0x0e, 0x0c, 0x0a, 0x09, 0x09, 0x09,
+    0x08, 0x08, 0x07, 0x04, 0x00, 0xf9, 0xf2, 0xec, 0xe7, 0xe3, 0xe2, 0xe2,
+    0xe3, 0xe5, 0xe8, 0xeb, 0xed, 0xef, 0xf1, 0xf3, 0xf4, 0xf6, 0xf9, 0xfe,
+    0x03, 0x07, 0x0a, 0x0b, 0x0b, 0x0a, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0a,
+    0x0d, 0x10, 0x12, 0x14, 0x13, 0x10, 0x0c, 0x06, 0x01, 0xfd, 0xfa, 0xf8,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x03, 0x05, 0x07, 0x07, 0x06, 0x04, 0x01, 0xfe, 0xfb, 0xf9, 0xf8, 0xf8,
+    0xf8, 0xf9, 0xfb, 0xfc, 0xfd, 0xfd, 0xfc, 0xfa, 0xf6, 0xf2, 0xef, 0xed,
+    0xec, 0xed, 0xee, 0xf1, 0xf3, 0xf7, 0xfa, 0xfe, 0x02, 0x06, 0x08, 0x0a,
+    0x0c, 0x0f, 0x12, 0x15, 0x17, 0x18, 0x18, 0x17, 0x15, 0x12, 0x0f, 0x0d,
+    0x0b, 0x09, 0x09, 0x08, 0x08, 0x08, 0x07, 0x06, 0x03, 0xfe, 0xf7, 0xf1,
+    0xeb, 0xe7, 0xe4, 0xe3, 0xe3, 0xe5, 0xe7, 0xe9, 0xec, 0xee, 0xf0, 0xf2,
+    0xf4, 0xf6, 0xf8, 0xfb, 0xff, 0x04, 0x07, 0x0a, 0x0b, 0x0b, 0x0a, 0x08,
+    0x07, 0x06, 0x07, 0x09, 0x0b, 0x0e, 0x10, 0x12, 0x13, 0x11, 0x0e, 0x09,
+    0x04, 0xff, 0xfc, 0xf9, 0xf8, 0xf8, 0xf9, 0xfa, 0xfc, 0xfd, 0xfe, 0xfe,
+    0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05, 0x06, 0x06, 0x05, 0x03, 0x00,
+    0xfd, 0xfb, 0xf9, 0xf8, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfd, 0xfc,
+    0xf9, 0xf5, 0xf2, 0xef, 0xed, 0xed, 0xee, 0xf0, 0xf2, 0xf5, 0xf8, 0xfc,
+    0x00, 0x03, 0x06, 0x09, 0x0b, 0x0d, 0x0f, 0x12, 0x15, 0x17, 0x17, 0x17,
+    0x16, 0x13, 0x11, 0x0e, 0x0c, 0x0a, 0x09, 0x08, 0x07, 0x07, 0x07, 0x06,
+    0x05, 0x01, 0xfc, 0xf5, 0xef, 0xea, 0xe6, 0xe4, 0xe4, 0xe4, 0xe6, 0xe8,
+    0xeb, 0xed, 0xf0, 0xf2, 0xf3, 0xf5, 0xf7, 0xf9, 0xfd, 0x01, 0x05, 0x08,
+    0x0a, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x07, 0x07, 0x09, 0x0c, 0x0e, 0x10,
+    0x11, 0x12, 0x10, 0x0c, 0x07, 0x03, 0xfe, 0xfb, 0xf9, 0xf8, 0xf9, 0xfa,
+    0xfb, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x05,
+    0x06, 0x05, 0x04, 0x02, 0xff, 0xfd, 0xfb, 0xf9, 0xf9, 0xf9, 0xf9, 0xfa,
+    0xfb, 0xfc, 0xfd, 0xfd, 0xfb, 0xf8, 0xf5, 0xf2, 0xef, 0xee, 0xee, 0xef,
+    0xf1, 0xf3, 0xf6, 0xfa, 0xfd, 0x01, 0x04, 0x07, 0x09, 0x0b, 0x0d, 0x0f,
+    0x12, 0x15, 0x16, 0x16, 0x16, 0x14, 0x12, 0x0f, 0x0d, 0x0b, 0x09, 0x08,
+    0x07, 0x07, 0x07, 0x06, 0x05, 0x03, 0xff, 0xfa, 0xf4, 0xee, 0xea, 0xe7,
+    0xe5, 0xe5, 0xe6, 0xe8, 0xea, 0xec, 0xef, 0xf1, 0xf2, 0xf4, 0xf6, 0xf8,
+    0xfa, 0xfe, 0x02, 0x06, 0x08, 0x0a, 0x0a, 0x0a, 0x08, 0x07, 0x07, 0x07,
+    0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x11, 0x10, 0x0e, 0x0a, 0x06, 0x01, 0xfe,
+    0xfb, 0xf9, 0xf9, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0xff,
+    0xff, 0x00, 0x02, 0x04, 0x05, 0x05, 0x05, 0x03, 0x01, 0xff, 0xfc, 0xfb,
+    0xf9, 0xf9, 0xf9, 0xf9, 0xfa, 0xfc, 0xfc, 0xfd, 0xfc, 0xfa, 0xf7, 0xf4,
+    0xf1, 0xf0, 0xef, 0xef, 0xf0, 0xf2, 0xf5, 0xf8, 0xfb, 0xff, 0x02, 0x05,
+    0x07, 0x09, 0x0b, 0x0d, 0x10, 0x12, 0x14, 0x16, 0x16, 0x15, 0x13, 0x11,
+    0x0e, 0x0c, 0x0a, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x04, 0x01, 0xfd,
+    0xf8, 0xf2, 0xed, 0xe9, 0xe7, 0xe6, 0xe6, 0xe7, 0xe9, 0xeb, 0xee, 0xf0,
+    0xf2, 0xf3, 0xf5, 0xf7, 0xf9, 0xfc, 0xff, 0x03, 0x06, 0x08, 0x0a, 0x0a,
+    0x09, 0x08, 0x07, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0e, 0x10, 0x10, 0x0f,
+    0x0c, 0x08, 0x04, 0x00, 0xfd, 0xfb, 0xf9, 0xf9, 0xf9, 0xfa, 0xfb, 0xfc,
+    0xfd, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x04,
+    0x03, 0x00, 0xfe, 0xfc, 0xfb, 0xfa, 0xf9, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd,
+    0xfd, 0xfb, 0xf9, 0xf6, 0xf4, 0xf2, 0xf0, 0xf0, 0xf0, 0xf1, 0xf3, 0xf6,
+    0xf9, 0xfd, 0x00, 0x03, 0x06, 0x08, 0x0a, 0x0b, 0x0e, 0x10, 0x12, 0x14,
+    0x15, 0x15, 0x14, 0x12, 0x0f, 0x0d, 0x0b, 0x09, 0x08, 0x07, 0x06, 0x06,
+    0x05, 0x05, 0x03, 0x00, 0xfb, 0xf6, 0xf1, 0xed, 0xe9, 0xe7, 0xe7, 0xe7,
+    0xe9, 0xeb, 0xed, 0xef, 0xf1, 0xf3, 0xf5, 0xf6, 0xf8, 0xfa, 0xfd, 0x01,
+    0x04, 0x07, 0x09, 0x0a, 0x09, 0x09, 0x08, 0x07, 0x07, 0x08, 0x09, 0x0b,
+    0x0c, 0x0e, 0x0f, 0x0f, 0x0d, 0x0b, 0x07, 0x03, 0xff, 0xfc, 0xfa, 0xf9,
+    0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x01,
+    0x03, 0x04, 0x04, 0x04, 0x03, 0x02, 0x00, 0xfe, 0xfc, 0xfb, 0xfa, 0xfa,
+    0xfa, 0xfa, 0xfb, 0xfc, 0xfd, 0xfc, 0xfb, 0xf9, 0xf6, 0xf4, 0xf2, 0xf1,
+    0xf0, 0xf1, 0xf2, 0xf5, 0xf7, 0xfa, 0xfe, 0x01, 0x04, 0x06, 0x08, 0x0a,
+    0x0c, 0x0e, 0x10, 0x12, 0x14, 0x14, 0x14, 0x12, 0x11, 0x0e, 0x0c, 0x0a,
+    0x09, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x02, 0xfe, 0xf9, 0xf5, 0xf0,
+    0xec, 0xe9, 0xe8, 0xe8, 0xe9, 0xea, 0xec, 0xee, 0xf0, 0xf2, 0xf4, 0xf5,
+    0xf7, 0xf9, 0xfb, 0xff, 0x02, 0x05, 0x07, 0x09, 0x09, 0x09, 0x08, 0x07,
+    0x07, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0e, 0x0e, 0x0e, 0x0c, 0x09, 0x05,
+    0x01, 0xfe, 0xfc, 0xfa, 0xfa, 0xfa, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xfe,
+    0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x03, 0x01, 0xff,
+    0xfd, 0xfc, 0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfc, 0xfc, 0xfd, 0xfc, 0xfa,
+    0xf8, 0xf6, 0xf3, 0xf2, 0xf1, 0xf1, 0xf2, 0xf4, 0xf6, 0xf9, 0xfc, 0xff,
+    0x02, 0x05, 0x07, 0x09, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x13, 0x13, 0x13,
+    0x11, 0x0f, 0x0d, 0x0b, 0x09, 0x08, 0x07, 0x06, 0x05, 0x05, 0x04, 0x03,
+    0x00, 0xfd, 0xf8, 0xf3, 0xef, 0xec, 0xea, 0xe9, 0xe9, 0xea, 0xeb, 0xed,
+    0xef, 0xf1, 0xf3, 0xf4, 0xf6, 0xf8, 0xfa, 0xfc, 0x00, 0x03, 0x06, 0x08,
+    0x09, 0x09, 0x09, 0x08, 0x07, 0x07, 0x07, 0x08, 0x0a, 0x0b, 0x0c, 0x0d,
+    0x0e, 0x0d, 0x0b, 0x07, 0x04, 0x01, 0xfe, 0xfc, 0xfa, 0xfa, 0xfa, 0xfb,
+    0xfb, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x02, 0x03, 0x03,
+    0x04, 0x03, 0x02, 0x00, 0xff, 0xfd, 0xfc, 0xfb, 0xfa, 0xfa, 0xfb, 0xfb,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xf7, 0xf5, 0xf4, 0xf2, 0xf2, 0xf2, 0xf3,
+    0xf5, 0xf7, 0xfa, 0xfd, 0x00, 0x03, 0x05, 0x07, 0x09, 0x0a, 0x0c, 0x0e,
+    0x10, 0x12, 0x12, 0x12, 0x12, 0x10, 0x0e, 0x0c, 0x0a, 0x09, 0x07, 0x06,
+    0x05, 0x05, 0x04, 0x04, 0x02, 0xff, 0xfb, 0xf7, 0xf2, 0xef, 0xec, 0xea,
+    0xea, 0xea, 0xeb, 0xec, 0xee, 0xf0, 0xf2, 0xf4, 0xf5, 0xf7, 0xf9, 0xfb,
+    0xfe, 0x01, 0x04, 0x06, 0x08, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x08,
+    0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0d, 0x0c, 0x09, 0x06, 0x03, 0x00, 0xfd,
+    0xfb, 0xfa, 0xfa, 0xfa, 0xfb, 0xfc, 0xfc, 0xfd, 0xfe, 0xfe, 0xff, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0xfe, 0xfd, 0xfc,
+    0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfb, 0xf9, 0xf7, 0xf5,
+    0xf4, 0xf3, 0xf3, 0xf3, 0xf4, 0xf6, 0xf8, 0xfb, 0xfe, 0x01, 0x03, 0x05,
+    0x07, 0x09, 0x0a, 0x0c, 0x0e, 0x10, 0x11, 0x11, 0x11, 0x10, 0x0f, 0x0d,
+    0x0b, 0x0a, 0x08, 0x07, 0x06, 0x05, 0x04, 0x04, 0x03, 0x01, 0xfe, 0xfa,
+    0xf6, 0xf2, 0xef, 0xec, 0xeb, 0xeb, 0xeb, 0xec, 0xee, 0xf0, 0xf1, 0xf3,
+    0xf5, 0xf6, 0xf8, 0xfa, 0xfc, 0xff, 0x02, 0x04, 0x06, 0x08, 0x08, 0x08,
+    0x08, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0c, 0x0b, 0x0a,
+    0x08, 0x05, 0x02, 0xff, 0xfd, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfd,
+    0xfd, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x02,
+    0x01, 0x00, 0xfe, 0xfd, 0xfc, 0xfb, 0xfb, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfb, 0xf9, 0xf7, 0xf6, 0xf4, 0xf4, 0xf4, 0xf4, 0xf5, 0xf7, 0xfa,
+    0xfc, 0xff, 0x01, 0x04, 0x05, 0x07, 0x09, 0x0a, 0x0c, 0x0e, 0x0f, 0x10,
+    0x10, 0x10, 0x0f, 0x0e, 0x0c, 0x0a, 0x09, 0x07, 0x06, 0x05, 0x04, 0x04,
+    0x03, 0x02, 0x00, 0xfd, 0xf9, 0xf5, 0xf2, 0xef, 0xed, 0xec, 0xec, 0xed,
+    0xee, 0xef, 0xf1, 0xf3, 0xf4, 0xf6, 0xf7, 0xf9, 0xfb, 0xfd, 0xff, 0x02,
+    0x04, 0x06, 0x07, 0x08, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09,
+    0x0a, 0x0b, 0x0b, 0x0a, 0x09, 0x06, 0x04, 0x01, 0xff, 0xfd, 0xfc, 0xfb,
+    0xfb, 0xfb, 0xfc, 0xfc, 0xfd, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfb,
+    0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfc, 0xfa, 0xf9, 0xf7, 0xf6, 0xf5, 0xf4,
+    0xf5, 0xf5, 0xf7, 0xf9, 0xfb, 0xfd, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xfe, 0x01, 0x00, 0x01, 0x00, 0xfe,
+    0x00, 0xfe, 0xfe, 0xff, 0x06, 0x09, 0xfe, 0xfb, 0xf4, 0xef, 0x00, 0x0b,
+    0x0a, 0x0b, 0x08, 0xf6, 0xe6, 0xf4, 0x01, 0x04, 0x15, 0x10, 0x01, 0x00,
+    0xf6, 0xeb, 0xf6, 0x0a, 0x02, 0xfe, 0x0d, 0xfc, 0xf4, 0x0a, 0x05, 0xf7,
+    0xff, 0x02, 0xed, 0xf2, 0x12, 0x0f, 0x0b, 0x10, 0xfc, 0xf0, 0xed, 0xe9,
+    0xf5, 0x15, 0x20, 0x06, 0x02, 0xfb, 0xdd, 0xec, 0x06, 0x07, 0x12, 0x1a,
+    0x03, 0xe2, 0xef, 0x01, 0xfc, 0x10, 0x15, 0x03, 0xfd, 0xee, 0xe3, 0xf8,
+    0x17, 0x13, 0x03, 0x08, 0xf4, 0xe7, 0xfe, 0x02, 0x01, 0x11, 0x10, 0xf2,
+    0xe8, 0x02, 0x03, 0x02, 0x12, 0x06, 0xfd, 0xf8, 0xe7, 0xea, 0x09, 0x1f,
+    0x0e, 0x03, 0xfe, 0xe5, 0xed, 0x02, 0x00, 0x0c, 0x19, 0x05, 0xe6, 0xf0,
+    0x05, 0xfe, 0x0a, 0x14, 0x02, 0xfa, 0xf0, 0xe6, 0xf5, 0x17, 0x1b, 0x05,
+    0x04, 0xf7, 0xe3, 0xf5, 0x01, 0x03, 0x15, 0x17, 0xf8, 0xe6, 0xfc, 0x00,
+    0xfa, 0x0f, 0x0e, 0x00, 0xfb, 0xed, 0xec, 0x06, 0x1c, 0x0b, 0xfb, 0x02,
+    0xee, 0xeb, 0x05, 0x06, 0x08, 0x14, 0x05, 0xe5, 0xea, 0x06, 0x03, 0x0a,
+    0x18, 0x05, 0xf7, 0xed, 0xe4, 0xf6, 0x1a, 0x22, 0x04, 0xfd, 0xf7, 0xdf,
+    0xf2, 0x09, 0x09, 0x14, 0x16, 0xf8, 0xdd, 0xf3, 0x03, 0xff, 0x16, 0x18,
+    0x01, 0xf5, 0xe7, 0xe4, 0xff, 0x20, 0x17, 0x01, 0x03, 0xee, 0xe1, 0xfd,
+    0x07, 0x0a, 0x16, 0x0c, 0xe9, 0xe3, 0x02, 0x03, 0x07, 0x1c, 0x0c, 0xf7,
+    0xed, 0xe2, 0xef, 0x13, 0x26, 0x0c, 0xfe, 0xfa, 0xe0, 0xea, 0x08, 0x0c,
+    0x14, 0x18, 0xfc, 0xdb, 0xeb, 0x04, 0x02, 0x16, 0x1e, 0x03, 0xf3, 0xe4,
+    0xde, 0xf9, 0x21, 0x21, 0x06, 0x04, 0xf2, 0xdd, 0xf5, 0x06, 0x0b, 0x18,
+    0x12, 0xef, 0xe0, 0xfb, 0x04, 0x05, 0x1b, 0x10, 0xf9, 0xee, 0xe2, 0xea,
+    0x0e, 0x27, 0x12, 0xfe, 0xfd, 0xe3, 0xe5, 0x04, 0x0b, 0x12, 0x18, 0x01,
+    0xde, 0xe7, 0x05, 0x04, 0x12, 0x1e, 0x05, 0xf1, 0xe5, 0xdf, 0xf6, 0x1e,
+    0x25, 0x08, 0x01, 0xf4, 0xdb, 0xf0, 0x08, 0x0d, 0x19, 0x16, 0xf2, 0xda,
+    0xf5, 0x06, 0x06, 0x1b, 0x17, 0xfb, 0xec, 0xdf, 0xe4, 0x07, 0x29, 0x1b,
+    0x02, 0xff, 0xe6, 0xde, 0xfc, 0x09, 0x12, 0x1c, 0x0b, 0xe3, 0xe2, 0x01,
+    0x03, 0x0c, 0x1e, 0x0a, 0xf5, 0xe8, 0xde, 0xf0, 0x1a, 0x29, 0x0d, 0x00,
+    0xf7, 0xdb, 0xe8, 0x04, 0x0d, 0x19, 0x1b, 0xfb, 0xdb, 0xee, 0x03, 0x01,
+    0x17, 0x1c, 0x02, 0xf2, 0xe2, 0xe0, 0xfe, 0x25, 0x1f, 0x04, 0x02, 0xec,
+    0xdb, 0xf7, 0x08, 0x10, 0x1c, 0x11, 0xe9, 0xde, 0xfc, 0x02, 0x08, 0x1e,
+    0x11, 0xf9, 0xeb, 0xde, 0xe9, 0x11, 0x29, 0x12, 0x02, 0xfd, 0xe0, 0xe4,
+    0x00, 0x09, 0x15, 0x1c, 0x02, 0xde, 0xea, 0x04, 0x01, 0x13, 0x1d, 0x04,
+    0xf2, 0xe4, 0xdf, 0xf9, 0x22, 0x25, 0x07, 0x01, 0xef, 0xd9, 0xf0, 0x06,
+    0x0e, 0x1d, 0x18, 0xf2, 0xdc, 0xf6, 0x01, 0x02, 0x1c, 0x15, 0xfc, 0xee,
+    0xe1, 0xe7, 0x0b, 0x2a, 0x17, 0x00, 0xfd, 0xe1, 0xdf, 0xff, 0x0c, 0x16,
+    0x1f, 0x08, 0xdf, 0xe1, 0xff, 0x00, 0x0f, 0x22, 0x0c, 0xf6, 0xe6, 0xdc,
+    0xf0, 0x1b, 0x28, 0x0b, 0x02, 0xf6, 0xd9, 0xea, 0x04, 0x0d, 0x1b, 0x1c,
+    0xf8, 0xd9, 0xf0, 0x01, 0x00, 0x1a, 0x1c, 0x01, 0xf1, 0xe1, 0xe0, 0x01,
+    0x28, 0x1e, 0x04, 0x01, 0xe7, 0xda, 0xf8, 0x08, 0x12, 0x20, 0x11, 0xe5,
+    0xdd, 0xfc, 0xff, 0x09, 0x21, 0x11, 0xfb, 0xeb, 0xdc, 0xe9, 0x13, 0x29,
+    0x0f, 0x03, 0xfb, 0xdd, 0xe6, 0x01, 0x09, 0x17, 0x1e, 0x00, 0xdc, 0xec,
+    0x02, 0xfe, 0x15, 0x1d, 0x05, 0xf5, 0xe3, 0xdd, 0xf9, 0x23, 0x22, 0x07,
+    0x03, 0xee, 0xda, 0xf3, 0x06, 0x0e, 0x1e, 0x16, 0xed, 0xdc, 0xf8, 0x00,
+    0x05, 0x1e, 0x14, 0xfd, 0xee, 0xde, 0xe5, 0x0c, 0x2a, 0x15, 0x03, 0xfe,
+    0xe0, 0xe1, 0xfe, 0x09, 0x15, 0x1f, 0x06, 0xde, 0xe5, 0x00, 0xff, 0x11,
+    0x1f, 0x09, 0xf6, 0xe6, 0xdc, 0xf3, 0x1e, 0x26, 0x0a, 0x04, 0xf3, 0xda,
+    0xed, 0x04, 0x0d, 0x1c, 0x19, 0xf3, 0xda, 0xf3, 0x01, 0x03, 0x1c, 0x19,
+    0xff, 0xef, 0xde, 0xe1, 0x06, 0x2a, 0x1c, 0x04, 0x00, 0xe4, 0xdb, 0xf9,
+    0x08, 0x14, 0x21, 0x0e, 0xe3, 0xe0, 0xfd, 0xfe, 0x0c, 0x20, 0x0e, 0xf9,
+    0xe9, 0xdc, 0xed, 0x18, 0x29, 0x0e, 0x02, 0xf7, 0xdb, 0xe8, 0x02, 0x0b,
+    0x1a, 0x1d, 0xfa, 0xda, 0xee, 0x01, 0x00, 0x17, 0x1b, 0x02, 0xf2, 0xe1,
+    0xe0, 0x00, 0x27, 0x20, 0x04, 0x00, 0xe8, 0xda, 0xf6, 0x09, 0x12, 0x1f,
+    0x11, 0xe6, 0xdb, 0xfa, 0x01, 0x09, 0x20, 0x12, 0xf9, 0xe9, 0xdb, 0xe9,
+    0x14, 0x2c, 0x14, 0x01, 0xf9, 0xdc, 0xe2, 0x01, 0x0c, 0x19, 0x1f, 0x01,
+    0xda, 0xe7, 0x01, 0x01, 0x15, 0x1f, 0x06, 0xf2, 0xe2, 0xdc, 0xf9, 0x25,
+    0x27, 0x08, 0x00, 0xec, 0xd7, 0xf0, 0x07, 0x11, 0x20, 0x17, 0xed, 0xd8,
+    0xf5, 0x01, 0x05, 0x1f, 0x17, 0xfc, 0xec, 0xdc, 0xe3, 0x0c, 0x2d, 0x1a,
+    0x03, 0xfc, 0xde, 0xdc, 0xfd, 0x0b, 0x17, 0x21, 0x08, 0xde, 0xe1, 0xff,
+    0x00, 0x10, 0x21, 0x0b, 0xf5, 0xe4, 0xdb, 0xf2, 0x1f, 0x2b, 0x0d, 0x01,
+    0xf1, 0xd6, 0xea, 0x05, 0x0f, 0x1e, 0x1c, 0xf5, 0xd8, 0xef, 0x01, 0x02,
+    0x1b, 0x1b, 0x00, 0xef, 0xde, 0xe0, 0x04, 0x2a, 0x1f, 0x04, 0xfe, 0xe3,
+    0xd9, 0xf8, 0x0a, 0x15, 0x21, 0x0e, 0xe3, 0xdd, 0xfb, 0x00, 0x0b, 0x21,
+    0x0f, 0xf8, 0xe8, 0xdb, 0xec, 0x18, 0x2c, 0x11, 0x01, 0xf6, 0xd9, 0xe5,
+    0x02, 0x0d, 0x1b, 0x1e, 0xfc, 0xd9, 0xea, 0x01, 0x00, 0x17, 0x1d, 0x03,
+    0xf2, 0xe1, 0xde, 0xfd, 0x27, 0x24, 0x05, 0xff, 0xe9, 0xd8, 0xf4, 0x09,
+    0x12, 0x20, 0x14, 0xe9, 0xda, 0xf8, 0x01, 0x07, 0x20, 0x13, 0xfa, 0xeb,
+    0xdc, 0xe7, 0x11, 0x2d, 0x16, 0x01, 0xf9, 0xdc, 0xe0, 0x00, 0x0c, 0x19,
+    0x20, 0x03, 0xdb, 0xe4, 0x00, 0x00, 0x13, 0x20, 0x07, 0xf3, 0xe3, 0xdc,
+    0xf6, 0x23, 0x29, 0x09, 0xff, 0xed, 0xd6, 0xee, 0x07, 0x11, 0x1f, 0x19,
+    0xef, 0xd7, 0xf2, 0x01, 0x05, 0x1e, 0x19, 0xfd, 0xec, 0xdd, 0xe2, 0x09,
+    0x2d, 0x1c, 0x03, 0xfc, 0xe0, 0xdb, 0xfb, 0x0b, 0x16, 0x21, 0x0a, 0xdf,
+    0xdf, 0xfd, 0x00, 0x0f, 0x22, 0x0c, 0xf5, 0xe5, 0xdb, 0xef, 0x1d, 0x2c,
+    0x0e, 0x00, 0xf2, 0xd7, 0xe8, 0x05, 0x0f, 0x1d, 0x1c, 0xf7, 0xd7, 0xed,
+    0x01, 0x02, 0x1b, 0x1c, 0x00, 0xef, 0xdf, 0xdf, 0x02, 0x2a, 0x22, 0x04,
+    0xfe, 0xe5, 0xd8, 0xf7, 0x0a, 0x14, 0x20, 0x10, 0xe5, 0xdb, 0xfa, 0x00,
+    0x0b, 0x21, 0x10, 0xf7, 0xe8, 0xdb, 0xea, 0x16, 0x2e, 0x13, 0x00, 0xf6,
+    0xd9, 0xe3, 0x02, 0x0e, 0x1b, 0x1f, 0xfe, 0xd8, 0xe7, 0x01, 0x02, 0x17,
+    0x20, 0x04, 0xf0, 0xe0, 0xdc, 0xfa, 0x27, 0x28, 0x08, 0xff, 0xe9, 0xd6,
+    0xf1, 0x08, 0x12, 0x20, 0x16, 0xeb, 0xd8, 0xf5, 0x01, 0x07, 0x20, 0x16,
+    0xfa, 0xea, 0xdb, 0xe5, 0x0f, 0x2f, 0x1a, 0x01, 0xf9, 0xdc, 0xdd, 0xfe,
+    0x0c, 0x19, 0x21, 0x06, 0xdc, 0xe1, 0xff, 0x00, 0x12, 0x22, 0x09, 0xf3,
+    0xe3, 0xdb, 0xf3, 0x21, 0x2c, 0x0c, 0xff, 0xef, 0xd5, 0xeb, 0x06, 0x10,
+    0x1e, 0x1b, 0xf3, 0xd7, 0xf0, 0x02, 0x04, 0x1d, 0x1a, 0xfe, 0xec, 0xdd,
+    0xe1, 0x07, 0x2d, 0x20, 0x03, 0xfc, 0xe1, 0xd9, 0xfa, 0x0b, 0x16, 0x21,
+    0x0d, 0xe0, 0xdc, 0xfc, 0x01, 0x0e, 0x22, 0x0e, 0xf5, 0xe5, 0xda, 0xed,
+    0x1b, 0x2f, 0x11, 0xff, 0xf3, 0xd6, 0xe5, 0x04, 0x10, 0x1d, 0x1e, 0xfa,
+    0xd6, 0xe9, 0x01, 0x02, 0x1a, 0x1e, 0x02, 0xef, 0xde, 0xdd, 0xff, 0x2a,
+    0x26, 0x06, 0xfd, 0xe6, 0xd6, 0xf4, 0x0a, 0x15, 0x22, 0x13, 0xe6, 0xd8,
+    0xf7, 0x01, 0x0a, 0x22, 0x13, 0xf8, 0xe8, 0xda, 0xe7, 0x14, 0x30, 0x17,
+    0x01, 0xf7, 0xd9, 0xdf, 0x00, 0x0e, 0x1b, 0x21, 0x02, 0xd9, 0xe3, 0x00,
+    0x01, 0x16, 0x21, 0x06, 0xf1, 0xe1, 0xdb, 0xf8, 0x26, 0x2a, 0x0a, 0xfe,
+    0xeb, 0xd4, 0xee, 0x09, 0x13, 0x20, 0x18, 0xed, 0xd6, 0xf2, 0x02, 0x07,
+    0x21, 0x18, 0xfb, 0xea, 0xdb, 0xe3, 0x0d, 0x30, 0x1d, 0x02, 0xfa, 0xdd,
+    0xda, 0xfc, 0x0d, 0x19, 0x22, 0x08, 0xdc, 0xde, 0xfe, 0x02, 0x12, 0x23,
+    0x0b, 0xf3, 0xe3, 0xd9, 0xf1, 0x20, 0x2f, 0x0f, 0xff, 0xef, 0xd4, 0xe8,
+    0x06, 0x11, 0x1f, 0x1c, 0xf4, 0xd5, 0xed, 0x02, 0x05, 0x1e, 0x1d, 0xff,
+    0xec, 0xdc, 0xdf, 0x05, 0x2e, 0x23, 0x04, 0xfc, 0xe1, 0xd6, 0xf7, 0x0c,
+    0x17, 0x22, 0x0f, 0xe1, 0xd9, 0xfa, 0x02, 0x0e, 0x24, 0x10, 0xf6, 0xe5,
+    0xd9, 0xeb, 0x1a, 0x31, 0x14, 0x00, 0xf4, 0xd6, 0xe2, 0x03, 0x10, 0x1d,
+    0x1f, 0xfc, 0xd6, 0xe7, 0x01, 0x03, 0x1a, 0x20, 0x03, 0xef, 0xde, 0xdc,
+    0xfd, 0x2a, 0x29, 0x08, 0xfd, 0xe7, 0xd4, 0xf2, 0x0a, 0x15, 0x22, 0x15,
+    0xe8, 0xd6, 0xf6, 0x02, 0x0a, 0x22, 0x15, 0xf8, 0xe8, 0xda, 0xe6, 0x12,
+    0x31, 0x1a, 0x01, 0xf7, 0xda, 0xdd, 0xff, 0x0e, 0x1b, 0x21, 0x04, 0xd9,
+    0xe1, 0xff, 0x02, 0x15, 0x23, 0x08, 0xf1, 0xe1, 0xda, 0xf6, 0x24, 0x2d,
+    0x0c, 0xfe, 0xec, 0xd4, 0xec, 0x08, 0x12, 0x20, 0x19, 0xef, 0xd5, 0xf0,
+    0x03, 0x06, 0x20, 0x1a, 0xfc, 0xeb, 0xdb, 0xe1, 0x0a, 0x30, 0x20, 0x03,
+    0xfb, 0xdf, 0xd9, 0xfb, 0x0d, 0x18, 0x22, 0x0b, 0xde, 0xdc, 0xfd, 0x02,
+    0x10, 0x23, 0x0d, 0xf4, 0xe4, 0xd9, 0xef, 0x1e, 0x30, 0x11, 0xff, 0xf1,
+    0xd5, 0xe6, 0x05, 0x10, 0x1e, 0x1d, 0xf7, 0xd6, 0xeb, 0x02, 0x04, 0x1c,
+    0x1e, 0x00, 0xee, 0xdd, 0xdd, 0x02, 0x2c, 0x25, 0x05, 0xfd, 0xe4, 0xd6,
+    0xf5, 0x0b, 0x15, 0x22, 0x11, 0xe4, 0xd8, 0xf9, 0x02, 0x0c, 0x23, 0x12,
+    0xf7, 0xe7, 0xda, 0xe9, 0x17, 0x31, 0x16, 0x00, 0xf6, 0xd8, 0xe0, 0x02,
+    0x0f, 0x1c, 0x20, 0xff, 0xd8, 0xe5, 0x01, 0x03, 0x18, 0x21, 0x05, 0xf0,
+    0xe0, 0xdb, 0xfa, 0x28, 0x2a, 0x09, 0xfe, 0xe9, 0xd4, 0xef, 0x09, 0x13,
+    0x21, 0x17, 0xeb, 0xd6, 0xf4, 0x02, 0x08, 0x21, 0x17, 0xfa, 0xea, 0xdb,
+    0xe3, 0x0f, 0x31, 0x1c, 0x02, 0xf9, 0xdc, 0xdb, 0xfd, 0x0d, 0x1a, 0x22,
+    0x07, 0xdb, 0xdf, 0xfe, 0x02, 0x13, 0x23, 0x0a, 0xf3, 0xe3, 0xda, 0xf3,
+    0x22, 0x2e, 0x0d, 0xff, 0xef, 0xd5, 0xe9, 0x07, 0x11, 0x1f, 0x1b, 0xf3,
+    0xd5, 0xee, 0x02, 0x05, 0x1e, 0x1b, 0xfe, 0xec, 0xdc, 0xdf, 0x07, 0x2e,
+    0x22, 0x03, 0xfc, 0xe1, 0xd8, 0xf9, 0x0c, 0x17, 0x22, 0x0d, 0xe0, 0xdb,
+    0xfb, 0x02, 0x0e, 0x23, 0x0f, 0xf5, 0xe6, 0xd9, 0xec, 0x1b, 0x30, 0x13,
+    0xff, 0xf3, 0xd7, 0xe4, 0x04, 0x10, 0x1d, 0x1e, 0xfa, 0xd6, 0xe8, 0x02,
+    0x03, 0x1a, 0x1f, 0x02, 0xef, 0xdf, 0xdc, 0xfe, 0x2b, 0x27, 0x07, 0xfd,
+    0xe6, 0xd5, 0xf3, 0x0a, 0x14, 0x21, 0x13, 0xe7, 0xd7, 0xf7, 0x02, 0x0a,
+    0x22, 0x14, 0xf8, 0xe8, 0xda, 0xe6, 0x13, 0x31, 0x18, 0x00, 0xf7, 0xda,
+    0xde, 0x00, 0x0e, 0x1b, 0x21, 0x02, 0xd9, 0xe2, 0x00, 0x02, 0x16, 0x22,
+    0x07, 0xf1, 0xe1, 0xda, 0xf7, 0x25, 0x2c, 0x0b, 0xfe, 0xec, 0xd5, 0xed,
+    0x08, 0x12, 0x20, 0x19, 0xee, 0xd6, 0xf1, 0x02, 0x07, 0x20, 0x19, 0xfc,
+    0xeb, 0xdb, 0xe2, 0x0b, 0x30, 0x1e, 0x02, 0xfa, 0xde, 0xda, 0xfc, 0x0d,
+    0x18, 0x22, 0x09, 0xdd, 0xdd, 0xfd, 0x02, 0x11, 0x23, 0x0c, 0xf4, 0xe4,
+    0xd9, 0xf0, 0x1f, 0x2f, 0x0f, 0xff, 0xf1, 0xd5, 0xe7, 0x06, 0x10, 0x1e,
+    0x1d, 0xf6, 0xd5, 0xec, 0x02, 0x04, 0x1c, 0x1d, 0xff, 0xee, 0xde, 0xde,
+    0x03, 0x2d, 0x24, 0x05, 0xfc, 0xe3, 0xd6, 0xf6, 0x0b, 0x16, 0x22, 0x10,
+    0xe3, 0xd9, 0xf9, 0x02, 0x0c, 0x23, 0x11, 0xf6, 0xe7, 0xda, 0xe9, 0x18,
+    0x30, 0x15, 0x00, 0xf5, 0xd8, 0xe1, 0x02, 0x0f, 0x1c, 0x20, 0xfe, 0xd7,
+    0xe6, 0x01, 0x02, 0x18, 0x20, 0x04, 0xf0, 0xe0, 0xdb, 0xfb, 0x28, 0x29,
+    0x08, 0xfe, 0xe9, 0xd5, 0xf0, 0x09, 0x13, 0x21, 0x16, 0xea, 0xd7, 0xf5,
+    0x02, 0x08, 0x21, 0x16, 0xfa, 0xea, 0xdb, 0xe4, 0x10, 0x30, 0x1b, 0x01,
+    0xf9, 0xdc, 0xdc, 0xfe, 0x0d, 0x1a, 0x22, 0x06, 0xdb, 0xe0, 0xff, 0x02,
+    0x13, 0x22, 0x09, 0xf3, 0xe3, 0xda, 0xf3, 0x22, 0x2d, 0x0d, 0xff, 0xee,
+    0xd5, 0xea, 0x07, 0x11, 0x20, 0x1b, 0xf2, 0xd6, 0xef, 0x02, 0x05, 0x1e,
+    0x1b, 0xfd, 0xec, 0xdc, 0xe0, 0x07, 0x2e, 0x21, 0x03, 0xfc, 0xe0, 0xd8,
+    0xf9, 0x0c, 0x17, 0x22, 0x0d, 0xe0, 0xdc, 0xfc, 0x01, 0x0f, 0x23, 0x0e,
+    0xf5, 0xe6, 0xd9, 0xed, 0x1c, 0x2f, 0x12, 0x00, 0xf3, 0xd6, 0xe4, 0x04,
+    0x0f, 0x1d, 0x1f, 0xfa, 0xd7, 0xe9, 0x01, 0x03, 0x1a, 0x1f, 0x02, 0xef,
+    0xdf, 0xdd, 0xff, 0x2b, 0x26, 0x06, 0xfd, 0xe6, 0xd5, 0xf3, 0x0a, 0x14,
+    0x22, 0x13, 0xe6, 0xd8, 0xf7, 0x01, 0x0a, 0x22, 0x13, 0xf8, 0xe9, 0xda,
+    0xe7, 0x14, 0x30, 0x18, 0x01, 0xf7, 0xd9, 0xde, 0x00, 0x0d, 0x1b, 0x21,
+    0x02, 0xd9, 0xe4, 0x00, 0x01, 0x16, 0x21, 0x06, 0xf2, 0xe2, 0xdb, 0xf7,
+    0x26, 0x2b, 0x0a, 0xff, 0xeb, 0xd4, 0xed, 0x08, 0x12, 0x21, 0x19, 0xee,
+    0xd6, 0xf2, 0x01, 0x06, 0x20, 0x18, 0xfc, 0xec, 0xdc, 0xe2, 0x0c, 0x2f,
+    0x1d, 0x02, 0xfa, 0xde, 0xda, 0xfc, 0x0c, 0x18, 0x22, 0x09, 0xdd, 0xde,
+    0xfd, 0x01, 0x11, 0x23, 0x0b, 0xf4, 0xe5, 0xda, 0xf0, 0x1f, 0x2e, 0x0f,
+    0x00, 0xf0, 0xd5, 0xe7, 0x05, 0x10, 0x1f, 0x1d, 0xf6, 0xd6, 0xed, 0x01,
+    0x03, 0x1d, 0x1d, 0x00, 0xee, 0xde, 0xde, 0x03, 0x2d, 0x23, 0x05, 0xfd,
+    0xe3, 0xd6, 0xf6, 0x0a, 0x16, 0x23, 0x10, 0xe3, 0xda, 0xfa, 0x01, 0x0c,
+    0x23, 0x11, 0xf7, 0xe8, 0xda, 0xea, 0x18, 0x30, 0x14, 0x01, 0xf5, 0xd7,
+    0xe1, 0x02, 0x0e, 0x1c, 0x20, 0xfe, 0xd8, 0xe7, 0x00, 0x01, 0x18, 0x20,
+    0x04, 0xf1, 0xe0, 0xdb, 0xfb, 0x28, 0x28, 0x08, 0xff, 0xe8, 0xd4, 0xf0,
+    0x08, 0x13, 0x22, 0x16, 0xea, 0xd7, 0xf5, 0x01, 0x08, 0x21, 0x16, 0xfa,
+    0xea, 0xdb, 0xe4, 0x10, 0x30, 0x1a, 0x02, 0xf9, 0xdb, 0xdc, 0xfe, 0x0c,
+    0x1a, 0x22, 0x06, 0xdb, 0xe1, 0xfe, 0x01, 0x14, 0x22, 0x09, 0xf3, 0xe3,
+    0xda, 0xf4, 0x23, 0x2c, 0x0c, 0x00, 0xee, 0xd4, 0xea, 0x06, 0x11, 0x20,
+    0x1b, 0xf1, 0xd6, 0xf0, 0x01, 0x05, 0x1f, 0x1a, 0xfd, 0xed, 0xdc, 0xe0,
+    0x08, 0x2e, 0x20, 0x04, 0xfc, 0xe0, 0xd8, 0xf9, 0x0b, 0x17, 0x23, 0x0d,
+    0xe0, 0xdd, 0xfc, 0x00, 0x0f, 0x23, 0x0e, 0xf6, 0xe6, 0xd9, 0xed, 0x1c,
+    0x2f, 0x11, 0x00, 0xf3, 0xd6, 0xe4, 0x04, 0x0f, 0x1e, 0x1f, 0xf9, 0xd7,
+    0xea, 0x01, 0x02, 0x1b, 0x1e, 0x01, 0xef, 0xdf, 0xdd, 0x00, 0x2b, 0x25,
+    0x06, 0xfe, 0xe5, 0xd5, 0xf4, 0x09, 0x14, 0x23, 0x13, 0xe6, 0xd9, 0xf8,
+    0x01, 0x0a, 0x22, 0x13, 0xf8, 0xe9, 0xda, 0xe7, 0x15, 0x30, 0x17, 0x01,
+    0xf7, 0xd9, 0xdf, 0x00, 0x0d, 0x1b, 0x21, 0x01, 0xd9, 0xe4, 0xff, 0x01,
+    0x16, 0x21, 0x06, 0xf2, 0xe2, 0xda, 0xf8, 0x26, 0x2a, 0x0a, 0xff, 0xea,
+    0xd4, 0xee, 0x08, 0x12, 0x21, 0x19, 0xed, 0xd7, 0xf3, 0x01, 0x06, 0x20,
+    0x18, 0xfb, 0xec, 0xdb, 0xe2, 0x0d, 0x2f, 0x1d, 0x03, 0xfa, 0xdd, 0xda,
+    0xfc, 0x0c, 0x18, 0x23, 0x09, 0xdd, 0xdf, 0xfd, 0x00, 0x12, 0x23, 0x0b,
+    0xf4, 0xe4, 0xd9, 0xf1, 0x20, 0x2d, 0x0e, 0x00, 0xf0, 0xd4, 0xe8, 0x05,
+    0x10, 0x1f, 0x1d, 0xf5, 0xd6, 0xed, 0x01, 0x04, 0x1d, 0x1c, 0xff, 0xee,
+    0xdd, 0xde, 0x04, 0x2d, 0x22, 0x05, 0xfd, 0xe2, 0xd7, 0xf7, 0x0a, 0x16,
+    0x23, 0x10, 0xe2, 0xdb, 0xfa, 0x00, 0x0d, 0x23, 0x10, 0xf7, 0xe7, 0xd9,
+    0xea, 0x19, 0x2f, 0x14, 0x01, 0xf5, 0xd7, 0xe2, 0x02, 0x0e, 0x1d, 0x20,
+    0xfd, 0xd8, 0xe8, 0x00, 0x02, 0x19, 0x20, 0x03, 0xf1, 0xe0, 0xdb, 0xfc,
+    0x29, 0x28, 0x08, 0xfe, 0xe7, 0xd4, 0xf1, 0x09, 0x13, 0x22, 0x16, 0xe9,
+    0xd8, 0xf6, 0x01, 0x09, 0x22, 0x15, 0xfa, 0xea, 0xda, 0xe5, 0x11, 0x30,
+    0x19, 0x02, 0xf8, 0xda, 0xdd, 0xfe, 0x0c, 0x1a, 0x22, 0x05, 0xda, 0xe2,
+    0xff, 0x00, 0x15, 0x22, 0x08, 0xf3, 0xe3, 0xda, 0xf5, 0x24, 0x2c, 0x0c,
+    0x00, 0xed, 0xd4, 0xeb, 0x07, 0x11, 0x21, 0x1b, 0xf0, 0xd6, 0xf0, 0x01,
+    0x05, 0x1f, 0x1a, 0xfd, 0xed, 0xdc, 0xe0, 0x09, 0x2e, 0x1f, 0x04, 0xfc,
+    0xdf, 0xd8, 0xfa, 0x0b, 0x17, 0x23, 0x0c, 0xdf, 0xdd, 0xfc, 0x00, 0x10,
+    0x23, 0x0d, 0xf5, 0xe6, 0xd9, 0xee, 0x1d, 0x2e, 0x11, 0x01, 0xf2, 0xd5,
+    0xe5, 0x04, 0x0f, 0x1e, 0x1f, 0xf8, 0xd7, 0xeb, 0x00, 0x02, 0x1c, 0x1e,
+    0x01, 0xef, 0xdf, 0xdd, 0x01, 0x2b, 0x24, 0x06, 0xfe, 0xe4, 0xd5, 0xf4,
+    0x09, 0x14, 0x23, 0x13, 0xe5, 0xd9, 0xf8, 0x00, 0x0b, 0x23, 0x12, 0xf8,
+    0xe9, 0xda, 0xe8, 0x16, 0x30, 0x16, 0x01, 0xf7, 0xd8, 0xe0, 0x01, 0x0d,
+    0x1c, 0x21, 0x00, 0xd9, 0xe5, 0xff, 0x01, 0x17, 0x21, 0x05, 0xf2, 0xe1,
+    0xdb, 0xf9, 0x27, 0x29, 0x09, 0xff, 0xea, 0xd4, 0xef, 0x08, 0x12, 0x22,
+    0x18, 0xec, 0xd7, 0xf3, 0x00, 0x07, 0x21, 0x17, 0xfb, 0xec, 0xdb, 0xe3,
+    0x0e, 0x2f, 0x1c, 0x03, 0xfa, 0xdc, 0xdb, 0xfc, 0x0b, 0x19, 0x23, 0x08,
+    0xdc, 0xe0, 0xfd, 0x00, 0x12, 0x23, 0x0a, 0xf4, 0xe4, 0xda, 0xf2, 0x21,
+    0x2d, 0x0e, 0x00, 0xef, 0xd4, 0xe9, 0x05, 0x10, 0x20, 0x1d, 0xf4, 0xd6,
+    0xee, 0x01, 0x04, 0x1e, 0x1b, 0xff, 0xee, 0xdd, 0xdf, 0x06, 0x2d, 0x21,
+    0x05, 0xfd, 0xe1, 0xd7, 0xf8, 0x0a, 0x16, 0x23, 0x0f, 0xe2, 0xdc, 0xfa,
+    0x00, 0x0d, 0x23, 0x0f, 0xf7, 0xe7, 0xd9, 0xeb, 0x1a, 0x2f, 0x13, 0x01,
+    0xf4, 0xd6, 0xe3, 0x03, 0x0e, 0x1d, 0x20, 0xfc, 0xd7, 0xe8, 0x00, 0x02,
+    0x1a, 0x1f, 0x03, 0xf1, 0xe0, 0xdc, 0xfe, 0x2a, 0x26, 0x07, 0xff, 0xe7,
+    0xd5, 0xf2, 0x08, 0x13, 0x23, 0x15, 0xe8, 0xd8, 0xf6, 0x00, 0x09, 0x22,
+    0x14, 0xf9, 0xea, 0xda, 0xe6, 0x12, 0x30, 0x18, 0x02, 0xf8, 0xda, 0xdd,
+    0xff, 0x0c, 0x1b, 0x22, 0x04, 0xda, 0xe3, 0xff, 0x00, 0x15, 0x22, 0x07,
+    0xf3, 0xe3, 0xda, 0xf6, 0x25, 0x2b, 0x0b, 0x00, 0xec, 0xd4, 0xec, 0x07,
+    0x11, 0x21, 0x1a, 0xef, 0xd6, 0xf1, 0x00, 0x05, 0x20, 0x19, 0xfc, 0xed,
+    0xdc, 0xe1, 0x0a, 0x2f, 0x1e, 0x03, 0xfb, 0xde, 0xd9, 0xfa, 0x0b, 0x18,
+    0x23, 0x0b, 0xde, 0xde, 0xfc, 0x00, 0x10, 0x23, 0x0c, 0xf5, 0xe6, 0xd9,
+    0xef, 0x1e, 0x2e, 0x10, 0x01, 0xf1, 0xd5, 0xe6, 0x04, 0x0f, 0x1f, 0x1e,
+    0xf7, 0xd6, 0xec, 0x00, 0x03, 0x1c, 0x1d, 0x00, 0xef, 0xde, 0xdd, 0x02,
+    0x2c, 0x24, 0x06, 0xfe, 0xe3, 0xd6, 0xf5, 0x09, 0x15, 0x23, 0x12, 0xe4,
+    0xda, 0xf9, 0x00, 0x0c, 0x23, 0x11, 0xf8, 0xe8, 0xda, 0xe9, 0x17, 0x30,
+    0x15, 0x01, 0xf6, 0xd7, 0xe0, 0x01, 0x0d, 0x1c, 0x21, 0xff, 0xd8, 0xe6,
+    0x00, 0x01, 0x18, 0x20, 0x04, 0xf1, 0xe1, 0xdb, 0xfa, 0x28, 0x28, 0x09,
+    0xff, 0xe9, 0xd4, 0xf0, 0x08, 0x12, 0x22, 0x17, 0xeb, 0xd7, 0xf4, 0x00,
+    0x08, 0x21, 0x16, 0xfb, 0xeb, 0xdb, 0xe3, 0x0f, 0x2f, 0x1b, 0x03, 0xfa,
+    0xdb, 0xdb, 0xfd, 0x0c, 0x19, 0x23, 0x06, 0xdb, 0xe1, 0xfe, 0x00, 0x13,
+    0x22, 0x09, 0xf4, 0xe4, 0xda, 0xf3, 0x22, 0x2c, 0x0d, 0x00, 0xee, 0xd4,
+    0xea, 0x06, 0x10, 0x20, 0x1c, 0xf2, 0xd6, 0xef, 0x01, 0x04, 0x1e, 0x1b,
+    0xfe, 0xee, 0xdd, 0xdf, 0x07, 0x2e, 0x20, 0x04, 0xfd, 0xe0, 0xd8, 0xf9,
+    0x0a, 0x17, 0x23, 0x0e, 0xe0, 0xdc, 0xfb, 0x00, 0x0e, 0x23, 0x0e, 0xf6,
+    0xe7, 0xd9, 0xec, 0x1b, 0x2f, 0x12, 0x01, 0xf3, 0xd6, 0xe4, 0x03, 0x0e,
+    0x1e, 0x20, 0xfa, 0xd7, 0xe9, 0x00, 0x02, 0x1a, 0x1e, 0x02, 0xf0, 0xdf,
+    0xdc, 0xff, 0x2a, 0x26, 0x07, 0xfe, 0xe6, 0xd5, 0xf3, 0x09, 0x14, 0x23,
+    0x14, 0xe7, 0xd9, 0xf7, 0x00, 0x0a, 0x22, 0x13, 0xf9, 0xea, 0xda, 0xe6,
+    0x14, 0x30, 0x17, 0x02, 0xf8, 0xd9, 0xde, 0x00, 0x0d, 0x1b, 0x22, 0x02,
+    0xd9, 0xe4, 0xff, 0x01, 0x16, 0x21, 0x06, 0xf2, 0xe2, 0xda, 0xf7, 0x26,
+    0x2a, 0x0b, 0x00, 0xeb, 0xd4, 0xed, 0x07, 0x11, 0x21, 0x19, 0xee, 0xd7,
+    0xf2, 0x01, 0x06, 0x20, 0x18, 0xfc, 0xec, 0xdc, 0xe2, 0x0c, 0x2f, 0x1d,
+    0x03, 0xfb, 0xdd, 0xda, 0xfc, 0x0b, 0x18, 0x23, 0x09, 0xdd, 0xdf, 0xfd,
+    0x00, 0x11, 0x23, 0x0b, 0xf5, 0xe5, 0xd9, 0xf0, 0x20, 0x2d, 0x0f, 0x00,
+    0xf0, 0xd5, 0xe7, 0x05, 0x0f, 0x1f, 0x1e, 0xf5, 0xd6, 0xed, 0x01, 0x03,
+    0x1d, 0x1c, 0xff, 0xef, 0xde, 0xde, 0x04, 0x2d, 0x23, 0x05, 0xfd, 0xe2,
+    0xd6, 0xf7, 0x0a, 0x16, 0x23, 0x10, 0xe3, 0xda, 0xfa, 0x00, 0x0d, 0x23,
+    0x10, 0xf7, 0xe8, 0xd9, 0xea, 0x19, 0x30, 0x14, 0x01, 0xf5, 0xd7, 0xe2,
+    0x02, 0x0e, 0x1d, 0x21, 0xfd, 0xd8, 0xe7, 0x00, 0x01, 0x19, 0x20, 0x03,
+    0xf1, 0xe0, 0xdb, 0xfc, 0x29, 0x28, 0x08, 0xff, 0xe8, 0xd4, 0xf1, 0x09,
+    0x13, 0x22, 0x16, 0xe9, 0xd8, 0xf5, 0x00, 0x08, 0x22, 0x15, 0xfa, 0xeb,
+    0xda, 0xe4, 0x11, 0x30, 0x1a, 0x02, 0xf9, 0xda, 0xdc, 0xfe, 0x0c, 0x1a,
+    0x23, 0x05, 0xda, 0xe2, 0xfe, 0x01, 0x14, 0x22, 0x08, 0xf3, 0xe3, 0xd9,
+    0xf4, 0x23, 0x2c, 0x0c, 0x00, 0xed, 0xd4, 0xeb, 0x06, 0x11, 0x21, 0x1b,
+    0xf1, 0xd6, 0xf0, 0x01, 0x05, 0x1f, 0x1a, 0xfd, 0xed, 0xdc, 0xe0, 0x09,
+    0x2e, 0x20, 0x04, 0xfc, 0xdf, 0xd8, 0xfa, 0x0b, 0x17, 0x23, 0x0c, 0xdf,
+    0xdd, 0xfb, 0x00, 0x0f, 0x23, 0x0d, 0xf6, 0xe6, 0xd9, 0xee, 0x1d, 0x2e,
+    0x11, 0x01, 0xf2, 0xd5, 0xe5, 0x04, 0x0f, 0x1e, 0x1f, 0xf8, 0xd7, 0xeb,
+    0x01, 0x02, 0x1b, 0x1e, 0x01, 0xef, 0xdf, 0xdd, 0x01, 0x2b, 0x25, 0x06,
+    0xfe, 0xe4, 0xd5, 0xf4, 0x09, 0x15, 0x23, 0x13, 0xe5, 0xd9, 0xf8, 0x00,
+    0x0b, 0x23, 0x12, 0xf8, 0xe9, 0xda, 0xe7, 0x15, 0x30, 0x17, 0x01, 0xf7,
+    0xd8, 0xdf, 0x00, 0x0d, 0x1c, 0x22, 0x00, 0xd9, 0xe5, 0x00, 0x01, 0x17,
+    0x21, 0x05, 0xf2, 0xe1, 0xdb, 0xf9, 0x27, 0x2a, 0x09, 0xff, 0xea, 0xd4,
+    0xef, 0x08, 0x12, 0x22, 0x18, 0xec, 0xd7, 0xf3, 0x01, 0x07, 0x21, 0x17,
+    0xfb, 0xec, 0xdb, 0xe2, 0x0d, 0x2f, 0x1c, 0x03, 0xfa, 0xdc, 0xda, 0xfd,
+    0x0c, 0x19, 0x23, 0x08, 0xdc, 0xe0, 0xfe, 0x00, 0x12, 0x23, 0x0a, 0xf4,
+    0xe5, 0xd9, 0xf1, 0x21, 0x2d, 0x0e, 0x00, 0xef, 0xd4, 0xe8, 0x06, 0x10,
+    0x20, 0x1d, 0xf4, 0xd6, 0xee, 0x01, 0x04, 0x1e, 0x1c, 0xfe, 0xee, 0xdd,
+    0xde, 0x05, 0x2d, 0x22, 0x05, 0xfd, 0xe1, 0xd7, 0xf7, 0x0a, 0x16, 0x23,
+    0x0f, 0xe2, 0xdb, 0xfa, 0x00, 0x0d, 0x23, 0x0f, 0xf6, 0xe7, 0xd9, 0xeb,
+    0x1a, 0x30, 0x13, 0x01, 0xf4, 0xd6, 0xe2, 0x03, 0x0e, 0x1d, 0x20, 0xfc,
+    0xd7, 0xe8, 0x00, 0x01, 0x1a, 0x1f, 0x02, 0xf1, 0xe0, 0xdc, 0xfd, 0x29,
+    0x27, 0x08, 0xfe, 0xe7, 0xd5, 0xf2, 0x09, 0x14, 0x23, 0x15, 0xe8, 0xd8,
+    0xf6, 0x00, 0x09, 0x22, 0x14, 0xf9, 0xea, 0xdb, 0xe5, 0x12, 0x30, 0x19,
+    0x02, 0xf8, 0xda, 0xdd, 0xff, 0x0d, 0x1b, 0x22, 0x04, 0xda, 0xe2, 0xfe,
+    0x01, 0x15, 0x22, 0x07, 0xf3, 0xe3, 0xda, 0xf6, 0x24, 0x2b, 0x0c, 0x00,
+    0xec, 0xd4, 0xec, 0x07, 0x11, 0x21, 0x1a, 0xf0, 0xd7, 0xf1, 0x00, 0x05,
+    0x20, 0x19, 0xfc, 0xed, 0xdc, 0xe1, 0x0a, 0x2e, 0x1e, 0x04, 0xfb, 0xde,
+    0xd9, 0xfa, 0x0b, 0x18, 0x23, 0x0b, 0xdf, 0xde, 0xfc, 0x00, 0x10, 0x23,
+    0x0c, 0xf5, 0xe6, 0xd9, 0xee, 0x1e, 0x2e, 0x10, 0x01, 0xf2, 0xd5, 0xe6,
+    0x04, 0x0f, 0x1f, 0x1e, 0xf7, 0xd7, 0xeb, 0x00, 0x02, 0x1c, 0x1d, 0x00,
+    0xef, 0xdf, 0xdd, 0x02, 0x2c, 0x24, 0x06, 0xfe, 0xe4, 0xd6, 0xf5, 0x0a,
+    0x15, 0x23, 0x12, 0xe4, 0xda, 0xf8, 0x00, 0x0b, 0x23, 0x11, 0xf7, 0xe9,
+    0xda, 0xe8, 0x17, 0x30, 0x16, 0x02, 0xf6, 0xd8, 0xe0, 0x01, 0x0d, 0x1c,
+    0x21, 0xff, 0xd8, 0xe6, 0xff, 0x01, 0x18, 0x20, 0x04, 0xf2, 0xe1, 0xdb,
+    0xfa, 0x27, 0x29, 0x09, 0xff, 0xe9, 0xd4, 0xf0, 0x08, 0x12, 0x22, 0x18,
+    0xeb, 0xd7, 0xf4, 0x00, 0x07, 0x22, 0x16, 0xfa, 0xec, 0xdb, 0xe3, 0x0f,
+    0x2f, 0x1b, 0x03, 0xfa, 0xdc, 0xdc, 0xfd, 0x0c, 0x19, 0x23, 0x07, 0xdc,
+    0xe1, 0xfd, 0x00, 0x13, 0x22, 0x09, 0xf4, 0xe4, 0xd9, 0xf2, 0x21, 0x2c,
+    0x0d, 0x00, 0xef, 0xd5, 0xea, 0x05, 0x10, 0x20, 0x1c, 0xf2, 0xd6, 0xef,
+    0x01, 0x05, 0x1e, 0x1a, 0xfe, 0xed, 0xdd, 0xdf, 0x06, 0x2e, 0x21, 0x05,
+    0xfd, 0xe0, 0xd8, 0xf7, 0x0a, 0x17, 0x23, 0x0f, 0xe1, 0xdc, 0xfb, 0xff,
+    0x0d, 0x22, 0x0e, 0xf7, 0xe8, 0xdb, 0xec, 0x1a, 0x2e, 0x11, 0x00, 0xf3,
+    0xd7, 0xe4, 0x04, 0x0f, 0x1d, 0x20, 0xfa, 0xd7, 0xe9, 0x00, 0x02, 0x1a,
+    0x1f, 0x02, 0xef, 0xe0, 0xdc, 0xfd, 0x2a, 0x26, 0x08, 0x00, 0xe7, 0xd5,
+    0xf2, 0x08, 0x12, 0x22, 0x15, 0xe8, 0xdb, 0xf7, 0x00, 0x08, 0x21, 0x13,
+    0xf8, 0xeb, 0xdc, 0xe7, 0x14, 0x2e, 0x17, 0x02, 0xf7, 0xd9, 0xde, 0x01,
+    0x0d, 0x1b, 0x23, 0x02, 0xd9, 0xe3, 0xfe, 0x00, 0x15, 0x22, 0x07, 0xf3,
+    0xe3, 0xda, 0xf7, 0x24, 0x29, 0x0a, 0xff, 0xee, 0xd5, 0xee, 0x08, 0x10,
+    0x20, 0x18, 0xee, 0xd8, 0xf1, 0x01, 0x07, 0x1f, 0x18, 0xfd, 0xec, 0xdd,
+    0xe2, 0x0b, 0x2d, 0x1d, 0x04, 0xfb, 0xdf, 0xdb, 0xfb, 0x0b, 0x17, 0x22,
+    0x09, 0xdf, 0xdf, 0xfd, 0x01, 0x10, 0x23, 0x0b, 0xf4, 0xe6, 0xd9, 0xf1,
+    0x1d, 0x2d, 0x11, 0xff, 0xf2, 0xd6, 0xe6, 0x05, 0x0e, 0x20, 0x1d, 0xf7,
+    0xd9, 0xec, 0x01, 0x02, 0x1c, 0x1c, 0xfe, 0xf0, 0xdf, 0xde, 0x04, 0x2a,
+    0x22, 0x05, 0xfd, 0xe5, 0xd7, 0xf6, 0x0a, 0x15, 0x22, 0x10, 0xec, 0xe4,
+    0xf4, 0xfc, 0x03, 0x13, 0x14, 0xff, 0xeb, 0xe3, 0xf6, 0x10, 0x13, 0x0d,
+    0x01, 0xf9, 0xfe, 0xf7, 0xf7, 0x06, 0x0d, 0x04, 0xf2, 0xf1, 0xf5, 0x02,
+    0x13, 0x0d, 0x0a, 0x01, 0xec, 0xe0, 0xe5, 0x01, 0x1e, 0x29, 0x1c, 0x00,
+    0xf0, 0xe0, 0xdd, 0xf0, 0x00, 0x17, 0x26, 0x17, 0xfc, 0xec, 0xed, 0xf1,
+    0xf8, 0xfe, 0xff, 0x08, 0x11, 0x0d, 0x06, 0x05, 0x00, 0xf3, 0xe7, 0xe9,
+    0xfa, 0x12, 0x1d, 0x10, 0x02, 0xfb, 0xee, 0xe7, 0xf1, 0x04, 0x14, 0x1b,
+    0x0a, 0xef, 0xf0, 0xf9, 0xfc, 0x02, 0x0b, 0x0b, 0x03, 0xfd, 0xf1, 0xf0,
+    0x05, 0x0b, 0x03, 0x00, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0x05, 0x09, 0xfa,
+    0xf0, 0xf7, 0x03, 0x0d, 0x0c, 0x05, 0xfe, 0xf9, 0xf5, 0xf0, 0xfb, 0x0c,
+    0x10, 0x0a, 0x00, 0xf3, 0xf1, 0xf9, 0x00, 0x06, 0x0c, 0x0a, 0xfc, 0xf4,
+    0xf7, 0xfc, 0x06, 0x0b, 0x07, 0xff, 0xf7, 0xf4, 0xf5, 0x02, 0x0f, 0x0d,
+    0x05, 0xf8, 0xf1, 0xf3, 0xfc, 0x07, 0x0e, 0x0f, 0x05, 0xf5, 0xee, 0xf1,
+    0xfd, 0x0a, 0x0f, 0x0d, 0x03, 0xf8, 0xf1, 0xf3, 0xfd, 0x06, 0x0a, 0x06,
+    0x00, 0xfd, 0xfb, 0xfb, 0xff, 0x03, 0x05, 0xff, 0xfa, 0xfb, 0xfd, 0x02,
+    0x04, 0x05, 0x02, 0xfd, 0xfb, 0xf8, 0xfc, 0x05, 0x08, 0x03, 0xfd, 0xfc,
+    0xfc, 0xfe, 0x02, 0x03, 0x05, 0x02, 0xf9, 0xf6, 0xf9, 0x01, 0x08, 0x0a,
+    0x08, 0x02, 0xfb, 0xf5, 0xf3, 0xfb, 0x04, 0x08, 0x07, 0x02, 0xfe, 0xfa,
+    0xfa, 0xfd, 0xff, 0x03, 0x03, 0x00, 0xfe, 0xfe, 0x00, 0x02, 0x03, 0x02,
+    0xfe, 0xfc, 0xfa, 0xfa, 0xff, 0x03, 0x04, 0x03, 0x00, 0xfe, 0xfe, 0xff,
+    0x00, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0x00, 0x05, 0x07, 0x04, 0xfe, 0xf8,
+    0xf6, 0xf7, 0xfe, 0x06, 0x0a, 0x0a, 0x03, 0xfb, 0xf7, 0xf7, 0xfc, 0x00,
+    0x05, 0x06, 0x03, 0xff, 0xfb, 0xfb, 0x00, 0x04, 0x04, 0x00, 0xfd, 0xfa,
+    0xfa, 0xfe, 0x01, 0x05, 0x06, 0x02, 0xfd, 0xfb, 0xfc, 0xfe, 0x00, 0x01,
+    0x00, 0x00, 0xff, 0xfc, 0xff, 0x04, 0x05, 0x02, 0xfe, 0xfa, 0xf9, 0xfd,
+    0x00, 0x01, 0x05, 0x05, 0x01, 0xfe, 0xfb, 0xfc, 0xfd, 0xff, 0x00, 0x01,
+    0x03, 0x00, 0xff, 0x01, 0x01, 0x00, 0xfd, 0xfb, 0xfc, 0xfe, 0x01, 0x02,
+    0x04, 0x04, 0xff, 0xfc, 0xfb, 0xfc, 0xfe, 0x01, 0x03, 0x02, 0x01, 0xff,
+    0xfc, 0xfe, 0x01, 0x01, 0x00, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x00, 0x01,
+    0xff, 0xfc, 0xfc, 0xff, 0x02, 0x03, 0x02, 0xff, 0xfd, 0xfd, 0xfc, 0xfe,
+    0x04, 0x06, 0x04, 0xff, 0xfb, 0xfa, 0xfa, 0xfe, 0x02, 0x04, 0x05, 0x01,
+    0xfd, 0xfc, 0xfe, 0x00, 0x01, 0x01, 0xff, 0xfe, 0xfe, 0xfe, 0x01, 0x04,
+    0x05, 0x02, 0xfd, 0xfb, 0xfa, 0xfc, 0x00, 0x03, 0x04, 0x04, 0x00, 0xfd,
+    0xfc, 0xfd, 0xfe, 0xff, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x01,
+    0xfe, 0xfc, 0xfc, 0xfd, 0x02, 0x04, 0x03, 0x02, 0xfe, 0xfb, 0xfa, 0xfd,
+    0x00, 0x02, 0x04, 0x03, 0x01, 0xfe, 0xfb, 0xfb, 0xff, 0x02, 0x03, 0x01,
+    0x01, 0x00, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0x00, 0x02, 0x04, 0x02,
+    0xff, 0xfd, 0xfb, 0xfc, 0xff, 0x01, 0x04, 0x05, 0x04, 0xff, 0xfb, 0xfa,
+    0xfc, 0xff, 0x02, 0x03, 0x03, 0x01, 0xfe, 0xfd, 0xfe, 0x00, 0x00, 0xff,
+    0xfd, 0xfd, 0xff, 0x01, 0x02, 0x03, 0x03, 0x00, 0xfc, 0xfb, 0xfd, 0xff,
+    0x02, 0x02, 0x01, 0xff, 0xfd, 0xfd, 0xfe, 0x01, 0x03, 0x02, 0xff, 0xfc,
+    0xfc, 0xfd, 0x00, 0x03, 0x05, 0x04, 0x00, 0xfb, 0xfa, 0xfb, 0xff, 0x02,
+    0x03, 0x02, 0x00, 0xfe, 0xfd, 0xfe, 0x02, 0x02, 0x01, 0xfe, 0xfc, 0xfd,
+    0xff, 0x02, 0x04, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x0b, 0x15, 0x14, 0x0f, 0x0d, 0x10, 0x14,
+    0x11, 0x06, 0xfb, 0xf5, 0xf7, 0xfa, 0xf8, 0xf0, 0xe5, 0xe2, 0xe9, 0xf7,
+    0x05, 0x0b, 0x09, 0x07, 0x0b, 0x13, 0x18, 0x15, 0x0b, 0x02, 0x01, 0x05,
+    0x05, 0xfc, 0xec, 0xe0, 0xe1, 0xec, 0xf7, 0xfc, 0xfb, 0xfb, 0xff, 0x09,
+    0x12, 0x16, 0x12, 0x0d, 0x0c, 0x0f, 0x11, 0x0c, 0xfe, 0xee, 0xe5, 0xe8,
+    0xf0, 0xf6, 0xf4, 0xee, 0xef, 0xf8, 0x05, 0x0d, 0x0e, 0x0b, 0x0c, 0x13,
+    0x1a, 0x1a, 0x10, 0x00, 0xf5, 0xf2, 0xf5, 0xf8, 0xf4, 0xec, 0xe7, 0xe9,
+    0xf3, 0xfd, 0x02, 0x03, 0x04, 0x0b, 0x16, 0x1e, 0x1c, 0x11, 0x04, 0xff,
+    0x01, 0x04, 0xff, 0xf4, 0xe9, 0xe5, 0xea, 0xf0, 0xf4, 0xf5, 0xf6, 0xfd,
+    0x09, 0x14, 0x19, 0x16, 0x0f, 0x0a, 0x0c, 0x0f, 0x0e, 0x05, 0xf8, 0xed,
+    0xeb, 0xee, 0xf0, 0xed, 0xea, 0xec, 0xf6, 0x03, 0x0d, 0x0f, 0x0c, 0x0b,
+    0x0f, 0x16, 0x19, 0x14, 0x0a, 0xff, 0xf8, 0xf6, 0xf4, 0xf0, 0xe9, 0xe5,
+    0xe8, 0xf2, 0xfb, 0x01, 0x01, 0x01, 0x07, 0x11, 0x19, 0x1b, 0x16, 0x0e,
+    0x08, 0x06, 0x03, 0xfc, 0xf2, 0xea, 0xe7, 0xea, 0xef, 0xf2, 0xf3, 0xf4,
+    0xf9, 0x02, 0x0d, 0x15, 0x17, 0x14, 0x11, 0x11, 0x11, 0x0d, 0x04, 0xf9,
+    0xf1, 0xef, 0xf0, 0xef, 0xec, 0xe8, 0xea, 0xf2, 0xfc, 0x05, 0x0a, 0x0d,
+    0x10, 0x14, 0x17, 0x17, 0x12, 0x0b, 0x03, 0xfe, 0xfa, 0xf7, 0xf1, 0xea,
+    0xe5, 0xe6, 0xed, 0xf4, 0xfa, 0xfd, 0x02, 0x09, 0x12, 0x18, 0x18, 0x13,
+    0x0f, 0x0d, 0x0b, 0x07, 0xfe, 0xf5, 0xed, 0xea, 0xe9, 0xea, 0xeb, 0xee,
+    0xf2, 0xfa, 0x02, 0x0b, 0x10, 0x12, 0x12, 0x13, 0x15, 0x15, 0x10, 0x07,
+    0xfd, 0xf6, 0xf2, 0xf0, 0xeb, 0xe7, 0xe6, 0xeb, 0xf3, 0xfb, 0x00, 0x03,
+    0x07, 0x0e, 0x15, 0x19, 0x19, 0x14, 0x0e, 0x09, 0x03, 0xfd, 0xf6, 0xee,
+    0xe8, 0xe6, 0xe9, 0xee, 0xf2, 0xf3, 0xf6, 0xfc, 0x07, 0x12, 0x17, 0x17,
+    0x14, 0x12, 0x13, 0x11, 0x09, 0xfe, 0xf4, 0xef, 0xee, 0xee, 0xec, 0xe8,
+    0xe7, 0xec, 0xf5, 0xff, 0x08, 0x0d, 0x0f, 0x12, 0x16, 0x19, 0x18, 0x11,
+    0x06, 0xfd, 0xfa, 0xf9, 0xf6, 0xed, 0xe3, 0xe0, 0xe5, 0xf0, 0xf8, 0xfc,
+    0xfe, 0x04, 0x0d, 0x16, 0x1a, 0x18, 0x12, 0x0d, 0x0b, 0x0a, 0x06, 0xfd,
+    0xf0, 0xe6, 0xe2, 0xe6, 0xec, 0xf0, 0xf0, 0xf1, 0xf8, 0x05, 0x11, 0x15,
+    0x13, 0x10, 0x12, 0x17, 0x19, 0x11, 0x03, 0xf5, 0xee, 0xee, 0xef, 0xec,
+    0xe8, 0xe5, 0xe9, 0xf2, 0xfd, 0x05, 0x08, 0x0a, 0x0d, 0x15, 0x1d, 0x20,
+    0x18, 0x09, 0xfe, 0xfb, 0xfb, 0xf9, 0xf0, 0xe5, 0xe0, 0xe5, 0xef, 0xf6,
+    0xf8, 0xf8, 0xfd, 0x09, 0x17, 0x1f, 0x1d, 0x16, 0x0f, 0x0b, 0x0b, 0x0a,
+    0x02, 0xf6, 0xea, 0xe4, 0xe7, 0xed, 0xef, 0xec, 0xeb, 0xf2, 0x02, 0x12,
+    0x19, 0x15, 0x0f, 0x10, 0x16, 0x1b, 0x16, 0x09, 0xfa, 0xf3, 0xf2, 0xf1,
+    0xed, 0xe7, 0xe2, 0xe4, 0xee, 0xfb, 0x06, 0x0a, 0x09, 0x0a, 0x11, 0x1c,
+    0x21, 0x1c, 0x10, 0x04, 0xff, 0x00, 0xfe, 0xf3, 0xe5, 0xdd, 0xe1, 0xed,
+    0xf6, 0xf8, 0xf6, 0xf9, 0x03, 0x12, 0x1c, 0x1e, 0x19, 0x12, 0x10, 0x0f,
+    0x0d, 0x06, 0xf9, 0xeb, 0xe4, 0xe6, 0xed, 0xf0, 0xec, 0xe8, 0xec, 0xfb,
+    0x0c, 0x16, 0x15, 0x11, 0x11, 0x18, 0x1e, 0x1a, 0x0c, 0xfe, 0xf5, 0xf3,
+    0xf3, 0xf0, 0xe9, 0xe2, 0xe1, 0xe8, 0xf4, 0x00, 0x06, 0x07, 0x09, 0x10,
+    0x1a, 0x22, 0x1f, 0x13, 0x06, 0x01, 0x02, 0x00, 0xf7, 0xe9, 0xdf, 0xdf,
+    0xe8, 0xf1, 0xf4, 0xf3, 0xf6, 0x00, 0x0e, 0x19, 0x1d, 0x19, 0x14, 0x11,
+    0x10, 0x0f, 0x0a, 0xfe, 0xf0, 0xe7, 0xe6, 0xe9, 0xec, 0xe9, 0xe6, 0xe9,
+    0xf6, 0x07, 0x12, 0x13, 0x10, 0x11, 0x17, 0x1d, 0x1b, 0x11, 0x04, 0xfb,
+    0xf6, 0xf4, 0xef, 0xe8, 0xe1, 0xe0, 0xe5, 0xf1, 0xfc, 0x03, 0x05, 0x07,
+    0x0d, 0x17, 0x1f, 0x1f, 0x17, 0x0d, 0x07, 0x05, 0x02, 0xf7, 0xea, 0xe0,
+    0xe0, 0xe7, 0xee, 0xf1, 0xf1, 0xf4, 0xfc, 0x08, 0x13, 0x19, 0x1b, 0x19,
+    0x17, 0x16, 0x12, 0x0b, 0xff, 0xf2, 0xea, 0xe8, 0xeb, 0xec, 0xe9, 0xe5,
+    0xe6, 0xf0, 0xff, 0x0a, 0x10, 0x12, 0x16, 0x1c, 0x1f, 0x1b, 0x11, 0x05,
+    0xfe, 0xfb, 0xf8, 0xf3, 0xeb, 0xe3, 0xdf, 0xe1, 0xe8, 0xf2, 0xfc, 0x03,
+    0x09, 0x11, 0x19, 0x1d, 0x1b, 0x15, 0x0e, 0x0b, 0x0b, 0x08, 0xfe, 0xef,
+    0xe3, 0xdf, 0xe2, 0xe6, 0xea, 0xee, 0xf5, 0xff, 0x0a, 0x11, 0x13, 0x13,
+    0x15, 0x18, 0x1a, 0x1a, 0x13, 0x07, 0xf8, 0xed, 0xe7, 0xe5, 0xe6, 0xe5,
+    0xe6, 0xeb, 0xf4, 0xfd, 0x03, 0x05, 0x08, 0x11, 0x1c, 0x24, 0x23, 0x19,
+    0x0c, 0x02, 0xfb, 0xf5, 0xef, 0xe9, 0xe6, 0xe6, 0xe9, 0xec, 0xee, 0xf0,
+    0xf5, 0xff, 0x0d, 0x1b, 0x23, 0x22, 0x1b, 0x12, 0x0d, 0x09, 0x04, 0xfc,
+    0xf3, 0xed, 0xeb, 0xea, 0xe6, 0xe1, 0xe0, 0xe8, 0xf8, 0x09, 0x15, 0x19,
+    0x18, 0x17, 0x16, 0x16, 0x14, 0x10, 0x09, 0x02, 0xfc, 0xf5, 0xec, 0xe2,
+    0xda, 0xd9, 0xe2, 0xf2, 0x00, 0x08, 0x09, 0x09, 0x0e, 0x15, 0x1b, 0x1c,
+    0x18, 0x14, 0x11, 0x0c, 0x01, 0xf1, 0xe2, 0xda, 0xdc, 0xe6, 0xef, 0xf5,
+    0xf7, 0xf7, 0xfb, 0x03, 0x0f, 0x18, 0x1d, 0x1e, 0x1e, 0x1d, 0x17, 0x0a,
+    0xf8, 0xe9, 0xe4, 0xe7, 0xee, 0xf0, 0xeb, 0xe5, 0xe5, 0xed, 0xfa, 0x06,
+    0x0f, 0x16, 0x1e, 0x24, 0x24, 0x1d, 0x0f, 0x00, 0xf8, 0xf7, 0xfa, 0xf9,
+    0xf1, 0xe5, 0xdc, 0xdb, 0xe4, 0xf0, 0xfa, 0x03, 0x0d, 0x18, 0x21, 0x23,
+    0x1b, 0x0f, 0x08, 0x09, 0x0e, 0x0d, 0x04, 0xf3, 0xe3, 0xda, 0xda, 0xe0,
+    0xe7, 0xee, 0xf7, 0x03, 0x0f, 0x16, 0x16, 0x11, 0x0e, 0x12, 0x1b, 0x21,
+    0x1c, 0x0c, 0xf8, 0xe7, 0xe1, 0xe0, 0xe2, 0xe3, 0xe7, 0xee, 0xf8, 0x01,
+    0x05, 0x04, 0x04, 0x0c, 0x1a, 0x28, 0x2c, 0x23, 0x11, 0xff, 0xf3, 0xee,
+    0xec, 0xe9, 0xe6, 0xe5, 0xe9, 0xef, 0xf2, 0xf0, 0xf0, 0xf8, 0x09, 0x1e,
+    0x2c, 0x2c, 0x21, 0x12, 0x07, 0x03, 0x00, 0xfb, 0xf5, 0xee, 0xea, 0xe9,
+    0xe7, 0xe2, 0xde, 0xe1, 0xef, 0x06, 0x1b, 0x25, 0x22, 0x18, 0x11, 0x10,
+    0x12, 0x11, 0x0b, 0x03, 0xfb, 0xf5, 0xed, 0xe2, 0xd7, 0xd3, 0xda, 0xec,
+    0x01, 0x10, 0x13, 0x0f, 0x0c, 0x0e, 0x15, 0x1c, 0x1e, 0x19, 0x11, 0x09,
+    0x00, 0xf3, 0xe3, 0xd5, 0xd2, 0xdd, 0xee, 0xfb, 0xff, 0xfc, 0xf9, 0xfe,
+    0x09, 0x17, 0x20, 0x23, 0x22, 0x1e, 0x17, 0x0a, 0xf9, 0xe8, 0xde, 0xdf,
+    0xe8, 0xf1, 0xf3, 0xee, 0xe6, 0xe6, 0xf1, 0x02, 0x13, 0x1d, 0x22, 0x24,
+    0x25, 0x1f, 0x12, 0x01, 0xf4, 0xf0, 0xf4, 0xf8, 0xf5, 0xea, 0xde, 0xd7,
+    0xdb, 0xe8, 0xf9, 0x08, 0x13, 0x1b, 0x20, 0x22, 0x1d, 0x14, 0x09, 0x04,
+    0x06, 0x0a, 0x07, 0xfa, 0xe6, 0xd6, 0xd1, 0xd8, 0xe4, 0xf0, 0xfb, 0x05,
+    0x0f, 0x16, 0x18, 0x14, 0x11, 0x11, 0x17, 0x1d, 0x1c, 0x11, 0xfe, 0xe9,
+    0xda, 0xd6, 0xdb, 0xe3, 0xea, 0xf0, 0xf7, 0xff, 0x05, 0x08, 0x08, 0x0c,
+    0x17, 0x25, 0x2d, 0x28, 0x17, 0x02, 0xf1, 0xe8, 0xe6, 0xe6, 0xe7, 0xe8,
+    0xea, 0xed, 0xef, 0xf1, 0xf4, 0xfc, 0x09, 0x1b, 0x2a, 0x30, 0x29, 0x19,
+    0x08, 0xfe, 0xfb, 0xf9, 0xf6, 0xf0, 0xea, 0xe7, 0xe5, 0xe2, 0xe0, 0xe3,
+    0xf0, 0x05, 0x19, 0x26, 0x27, 0x20, 0x16, 0x10, 0x0e, 0x0e, 0x0c, 0x06,
+    0xfd, 0xf3, 0xe9, 0xe0, 0xd9, 0xd5, 0xdb, 0xea, 0xfe, 0x10, 0x17, 0x15,
+    0x10, 0x10, 0x15, 0x1c, 0x1e, 0x1a, 0x13, 0x0a, 0xff, 0xf1, 0xe1, 0xd6,
+    0xd4, 0xdc, 0xea, 0xf7, 0xff, 0x01, 0x00, 0x01, 0x09, 0x16, 0x21, 0x27,
+    0x25, 0x1f, 0x16, 0x0a, 0xfa, 0xea, 0xdf, 0xdd, 0xe5, 0xee, 0xf1, 0xee,
+    0xe9, 0xea, 0xf4, 0x03, 0x12, 0x1e, 0x25, 0x27, 0x25, 0x1e, 0x12, 0x03,
+    0xf6, 0xf0, 0xf0, 0xf2, 0xf1, 0xea, 0xdf, 0xd9, 0xdc, 0xe8, 0xfa, 0x0a,
+    0x14, 0x1c, 0x21, 0x23, 0x20, 0x16, 0x0c, 0x05, 0x06, 0x07, 0x03, 0xf6,
+    0xe5, 0xd8, 0xd3, 0xd8, 0xe3, 0xf0, 0xfc, 0x06, 0x0f, 0x16, 0x1a, 0x19,
+    0x16, 0x15, 0x16, 0x1a, 0x1a, 0x10, 0xfd, 0xe8, 0xda, 0xd7, 0xdc, 0xe3,
+    0xe9, 0xee, 0xf6, 0xff, 0x07, 0x0b, 0x0d, 0x12, 0x1a, 0x24, 0x2a, 0x26,
+    0x17, 0x03, 0xf2, 0xe8, 0xe6, 0xe6, 0xe6, 0xe5, 0xe5, 0xe8, 0xee, 0xf4,
+    0xfa, 0x00, 0x0b, 0x1a, 0x29, 0x2f, 0x28, 0x18, 0x09, 0x00, 0xfc, 0xf9,
+    0xf4, 0xed, 0xe6, 0xe2, 0xe1, 0xe1, 0xe3, 0xe8, 0xf3, 0x04, 0x16, 0x23,
+    0x27, 0x21, 0x17, 0x11, 0x10, 0x10, 0x0d, 0x04, 0xf7, 0xec, 0xe4, 0xdf,
+    0xdb, 0xd9, 0xdd, 0xea, 0xfc, 0x0c, 0x15, 0x16, 0x13, 0x13, 0x18, 0x1e,
+    0x20, 0x1c, 0x11, 0x04, 0xf8, 0xed, 0xe3, 0xdb, 0xd7, 0xda, 0xe5, 0xf3,
+    0xfd, 0x00, 0x00, 0x03, 0x0c, 0x1a, 0x25, 0x28, 0x23, 0x1a, 0x10, 0x06,
+    0xfa, 0xed, 0xe3, 0xde, 0xe1, 0xe7, 0xeb, 0xeb, 0xe9, 0xeb, 0xf5, 0x05,
+    0x16, 0x22, 0x26, 0x23, 0x1f, 0x19, 0x12, 0x07, 0xfb, 0xf2, 0xed, 0xed,
+    0xeb, 0xe5, 0xdd, 0xd9, 0xdd, 0xeb, 0xfd, 0x0d, 0x16, 0x1b, 0x1d, 0x1e,
+    0x1e, 0x1b, 0x13, 0x0b, 0x05, 0x01, 0xfc, 0xf2, 0xe4, 0xd7, 0xd3, 0xd9,
+    0xe6, 0xf4, 0xff, 0x05, 0x0b, 0x11, 0x18, 0x1d, 0x1e, 0x1c, 0x1a, 0x18,
+    0x14, 0x0a, 0xf9, 0xe7, 0xdb, 0xd8, 0xdd, 0xe5, 0xeb, 0xef, 0xf2, 0xf9,
+    0x02, 0x0d, 0x15, 0x1a, 0x1f, 0x24, 0x26, 0x21, 0x14, 0x02, 0xf2, 0xe9,
+    0xe7, 0xe8, 0xe8, 0xe5, 0xe2, 0xe3, 0xea, 0xf4, 0xfe, 0x08, 0x13, 0x1d,
+    0x27, 0x2a, 0x25, 0x18, 0x0b, 0x01, 0xfd, 0xfb, 0xf6, 0xed, 0xe2, 0xdb,
+    0xdb, 0xdf, 0xe7, 0xef, 0xfa, 0x08, 0x16, 0x20, 0x23, 0x1f, 0x18, 0x14,
+    0x13, 0x13, 0x0f, 0x04, 0xf5, 0xe7, 0xde, 0xda, 0xdb, 0xde, 0xe4, 0xee,
+    0xfc, 0x09, 0x12, 0x14, 0x13, 0x15, 0x1b, 0x22, 0x24, 0x1d, 0x0f, 0xff,
+    0xf1, 0xe8, 0xe2, 0xdd, 0xdc, 0xdf, 0xe6, 0xf0, 0xf8, 0xfd, 0xff, 0x05,
+    0x10, 0x1e, 0x29, 0x2b, 0x24, 0x17, 0x0a, 0x00, 0xf8, 0xef, 0xe6, 0xe1,
+    0xe1, 0xe4, 0xe7, 0xe7, 0xe7, 0xec, 0xf8, 0x0a, 0x1b, 0x26, 0x27, 0x22,
+    0x1b, 0x15, 0x0f, 0x08, 0xff, 0xf6, 0xee, 0xea, 0xe7, 0xe1, 0xda, 0xd7,
+    0xde, 0xed, 0x01, 0x12, 0x19, 0x1a, 0x19, 0x1a, 0x1c, 0x1b, 0x16, 0x0e,
+    0x07, 0x00, 0xf8, 0xec, 0xdf, 0xd4, 0xd2, 0xda, 0xe8, 0xf7, 0x01, 0x06,
+    0x08, 0x0d, 0x15, 0x1d, 0x21, 0x20, 0x1c, 0x17, 0x11, 0x06, 0xf5, 0xe3,
+    0xd7, 0xd6, 0xde, 0xe8, 0xed, 0xee, 0xef, 0xf5, 0x00, 0x0c, 0x17, 0x1e,
+    0x22, 0x25, 0x24, 0x1d, 0x10, 0xff, 0xef, 0xe6, 0xe5, 0xe9, 0xea, 0xe6,
+    0xdf, 0xde, 0xe4, 0xf2, 0x01, 0x0c, 0x15, 0x1e, 0x26, 0x29, 0x23, 0x16,
+    0x07, 0xfe, 0xfc, 0xfc, 0xf8, 0xee, 0xe1, 0xd8, 0xd6, 0xdc, 0xe7, 0xf3,
+    0xff, 0x0a, 0x16, 0x1f, 0x23, 0x20, 0x18, 0x11, 0x10, 0x12, 0x11, 0x07,
+    0xf5, 0xe3, 0xd8, 0xd6, 0xda, 0xe0, 0xe7, 0xf0, 0xfc, 0x09, 0x12, 0x15,
+    0x14, 0x15, 0x1a, 0x20, 0x24, 0x20, 0x12, 0xfe, 0xed, 0xe2, 0xde, 0xdf,
+    0xdf, 0xe1, 0xe6, 0xef, 0xf9, 0x00, 0x02, 0x06, 0x0e, 0x1d, 0x2a, 0x2f,
+    0x28, 0x18, 0x08, 0xfc, 0xf4, 0xee, 0xe8, 0xe4, 0xe2, 0xe3, 0xe6, 0xe9,
+    0xeb, 0xef, 0xf8, 0x08, 0x1a, 0x29, 0x2d, 0x27, 0x1b, 0x10, 0x0b, 0x07,
+    0x01, 0xf8, 0xee, 0xe9, 0xe5, 0xe2, 0xdd, 0xda, 0xde, 0xed, 0x01, 0x13,
+    0x1e, 0x20, 0x1d, 0x1a, 0x19, 0x18, 0x17, 0x12, 0x09, 0xff, 0xf5, 0xeb,
+    0xe1, 0xd7, 0xd3, 0xd7, 0xe5, 0xf8, 0x06, 0x0c, 0x0d, 0x0e, 0x14, 0x1b,
+    0x21, 0x21, 0x1e, 0x18, 0x10, 0x04, 0xf5, 0xe5, 0xd9, 0xd6, 0xdb, 0xe5,
+    0xef, 0xf5, 0xf7, 0xfa, 0xff, 0x0a, 0x17, 0x21, 0x26, 0x26, 0x23, 0x1c,
+    0x11, 0x01, 0xf0, 0xe5, 0xe2, 0xe6, 0xe9, 0xe9, 0xe5, 0xe4, 0xe8, 0xf2,
+    0xff, 0x0d, 0x19, 0x23, 0x28, 0x29, 0x23, 0x18, 0x0b, 0xff, 0xf8, 0xf5,
+    0xf4, 0xf0, 0xe7, 0xdd, 0xd7, 0xda, 0xe5, 0xf3, 0x00, 0x0c, 0x18, 0x21,
+    0x25, 0x22, 0x1a, 0x12, 0x0e, 0x0e, 0x0c, 0x04, 0xf7, 0xe8, 0xdc, 0xd6,
+    0xd6, 0xdd, 0xe7, 0xf3, 0xff, 0x0b, 0x13, 0x18, 0x19, 0x17, 0x18, 0x1c,
+    0x20, 0x1e, 0x13, 0x02, 0xf0, 0xe3, 0xdd, 0xdb, 0xdc, 0xe0, 0xe8, 0xf3,
+    0xfc, 0x02, 0x05, 0x09, 0x10, 0x1c, 0x26, 0x2b, 0x27, 0x1c, 0x0d, 0xfd,
+    0xf1, 0xe9, 0xe4, 0xe1, 0xe1, 0xe3, 0xe8, 0xec, 0xef, 0xf1, 0xf8, 0x06,
+    0x18, 0x27, 0x2c, 0x28, 0x1f, 0x15, 0x0d, 0x04, 0xfa, 0xf2, 0xec, 0xe9,
+    0xe7, 0xe4, 0xdf, 0xdd, 0xe0, 0xec, 0xfd, 0x10, 0x1e, 0x23, 0x22, 0x1e,
+    0x1b, 0x18, 0x13, 0x0c, 0x03, 0xfc, 0xf6, 0xef, 0xe4, 0xd9, 0xd2, 0xd5,
+    0xe3, 0xf5, 0x04, 0x0d, 0x11, 0x14, 0x18, 0x1c, 0x1e, 0x1c, 0x19, 0x14,
+    0x0f, 0x06, 0xf9, 0xe8, 0xda, 0xd2, 0xd6, 0xe1, 0xee, 0xf6, 0xfa, 0xfd,
+    0x04, 0x0e, 0x18, 0x1d, 0x1f, 0x21, 0x22, 0x1f, 0x15, 0x03, 0xf0, 0xe1,
+    0xdd, 0xe0, 0xe5, 0xe8, 0xe7, 0xe7, 0xeb, 0xf4, 0x00, 0x0c, 0x15, 0x1c,
+    0x24, 0x29, 0x28, 0x1e, 0x0c, 0xfb, 0xf1, 0xef, 0xf1, 0xee, 0xe7, 0xde,
+    0xdb, 0xdf, 0xe8, 0xf2, 0xfc, 0x08, 0x15, 0x22, 0x29, 0x28, 0x1f, 0x12,
+    0x09, 0x06, 0x06, 0x03, 0xf9, 0xea, 0xdd, 0xd7, 0xd9, 0xdf, 0xe6, 0xee,
+    0xf9, 0x09, 0x18, 0x21, 0x1f, 0x19, 0x14, 0x16, 0x1a, 0x1a, 0x12, 0x03,
+    0xf1, 0xe4, 0xdd, 0xdb, 0xdb, 0xdd, 0xe3, 0xee, 0xfc, 0x09, 0x0f, 0x0f,
+    0x0e, 0x14, 0x1e, 0x28, 0x28, 0x1d, 0x0c, 0xfc, 0xf2, 0xeb, 0xe4, 0xde,
+    0xdb, 0xde, 0xe8, 0xf1, 0xf7, 0xf8, 0xfb, 0x03, 0x11, 0x21, 0x2c, 0x2c,
+    0x22, 0x15, 0x0a, 0x02, 0xfa, 0xf1, 0xe7, 0xe1, 0xe1, 0xe5, 0xe8, 0xe6,
+    0xe4, 0xe8, 0xf6, 0x0b, 0x1d, 0x26, 0x25, 0x20, 0x1b, 0x17, 0x12, 0x0a,
+    0x00, 0xf6, 0xf0, 0xec, 0xe8, 0xe1, 0xda, 0xd6, 0xdd, 0xed, 0x02, 0x11,
+    0x18, 0x18, 0x18, 0x1b, 0x1e, 0x1e, 0x17, 0x0e, 0x07, 0x02, 0xfb, 0xef,
+    0xe0, 0xd4, 0xd2, 0xda, 0xe8, 0xf6, 0xff, 0x04, 0x07, 0x0e, 0x16, 0x1d,
+    0x21, 0x1f, 0x1c, 0x18, 0x12, 0x08, 0xf8, 0xe6, 0xd9, 0xd7, 0xde, 0xe8,
+    0xed, 0xee, 0xef, 0xf6, 0x01, 0x0d, 0x17, 0x1c, 0x21, 0x24, 0x25, 0x1f,
+    0x12, 0x01, 0xf2, 0xe9, 0xe7, 0xe8, 0xe9, 0xe5, 0xe1, 0xe0, 0xe6, 0xf3,
+    0x00, 0x0b, 0x14, 0x1c, 0x25, 0x29, 0x25, 0x19, 0x0b, 0x01, 0xfd, 0xfb,
+    0xf6, 0xed, 0xe2, 0xdb, 0xd9, 0xde, 0xe6, 0xf0, 0xfc, 0x08, 0x14, 0x1e,
+    0x23, 0x21, 0x1b, 0x14, 0x11, 0x11, 0x0e, 0x05, 0xf6, 0xe7, 0xdd, 0xda,
+    0xdb, 0xdf, 0xe4, 0xed, 0xfa, 0x07, 0x11, 0x14, 0x15, 0x17, 0x1b, 0x20,
+    0x20, 0x1b, 0x10, 0x01, 0xf3, 0xe8, 0xe1, 0xde, 0xdd, 0xdf, 0xe5, 0xee,
+    0xf7, 0xfe, 0x03, 0x07, 0x10, 0x1c, 0x26, 0x29, 0x23, 0x18, 0x0c, 0x02,
+    0xf8, 0xee, 0xe6, 0xe2, 0xe2, 0xe3, 0xe6, 0xe7, 0xea, 0xf0, 0xfb, 0x09,
+    0x17, 0x22, 0x26, 0x24, 0x1e, 0x17, 0x10, 0x08, 0xff, 0xf5, 0xee, 0xe9,
+    0xe6, 0xe2, 0xdd, 0xdc, 0xe2, 0xef, 0x00, 0x0d, 0x15, 0x1a, 0x1d, 0x1f,
+    0x1e, 0x1a, 0x14, 0x0e, 0x07, 0x00, 0xf7, 0xec, 0xe2, 0xda, 0xd7, 0xdc,
+    0xe7, 0xf4, 0xfe, 0x05, 0x0a, 0x11, 0x19, 0x1f, 0x20, 0x1d, 0x19, 0x16,
+    0x11, 0x06, 0xf6, 0xe7, 0xde, 0xdc, 0xe0, 0xe4, 0xe8, 0xed, 0xf3, 0xfb,
+    0x05, 0x0f, 0x17, 0x1c, 0x20, 0x22, 0x21, 0x1c, 0x11, 0x02, 0xf3, 0xea,
+    0xe8, 0xe8, 0xe6, 0xe2, 0xdf, 0xe3, 0xed, 0xf8, 0x02, 0x09, 0x12, 0x1c,
+    0x25, 0x27, 0x22, 0x17, 0x0c, 0x04, 0xfe, 0xfa, 0xf3, 0xe9, 0xe0, 0xdb,
+    0xdc, 0xe3, 0xeb, 0xf3, 0xfb, 0x05, 0x12, 0x1e, 0x23, 0x21, 0x19, 0x14,
+    0x13, 0x12, 0x0c, 0xff, 0xf0, 0xe4, 0xdf, 0xdf, 0xe0, 0xe1, 0xe5, 0xed,
+    0xf9, 0x07, 0x11, 0x16, 0x17, 0x18, 0x1c, 0x20, 0x21, 0x19, 0x0b, 0xfb,
+    0xef, 0xea, 0xe7, 0xe4, 0xde, 0xdc, 0xe2, 0xee, 0xfa, 0x01, 0x04, 0x08,
+    0x12, 0x1f, 0x27, 0x27, 0x1e, 0x12, 0x08, 0x01, 0xfb, 0xf3, 0xea, 0xe1,
+    0xdd, 0xdf, 0xe5, 0xeb, 0xef, 0xf2, 0xfb, 0x0a, 0x1a, 0x25, 0x25, 0x1d,
+    0x16, 0x14, 0x13, 0x0e, 0x02, 0xf4, 0xe9, 0xe5, 0xe4, 0xe3, 0xe1, 0xdf,
+    0xe4, 0xf1, 0x01, 0x10, 0x17, 0x18, 0x17, 0x19, 0x1d, 0x20, 0x1c, 0x10,
+    0x01, 0xf7, 0xf1, 0xed, 0xe6, 0xdd, 0xd8, 0xdd, 0xea, 0xf9, 0x01, 0x04,
+    0x06, 0x0d, 0x18, 0x22, 0x26, 0x22, 0x18, 0x0f, 0x08, 0x01, 0xf8, 0xec,
+    0xe1, 0xdb, 0xde, 0xe7, 0xee, 0xf0, 0xf0, 0xf4, 0x01, 0x12, 0x20, 0x24,
+    0x21, 0x1b, 0x19, 0x17, 0x10, 0x04, 0xf6, 0xeb, 0xe7, 0xe8, 0xe8, 0xe5,
+    0xe0, 0xe0, 0xe8, 0xf7, 0x08, 0x14, 0x19, 0x1a, 0x1b, 0x1d, 0x1f, 0x1b,
+    0x10, 0x04, 0xfb, 0xf8, 0xf5, 0xed, 0xe1, 0xd7, 0xd7, 0xe1, 0xf0, 0xfd,
+    0x04, 0x08, 0x0d, 0x15, 0x1d, 0x20, 0x1e, 0x18, 0x12, 0x0e, 0x09, 0x00,
+    0xf2, 0xe3, 0xd9, 0xd8, 0xe0, 0xea, 0xf1, 0xf3, 0xf6, 0xfe, 0x0a, 0x16,
+    0x1b, 0x1c, 0x1c, 0x1d, 0x1e, 0x18, 0x0b, 0xfa, 0xeb, 0xe4, 0xe4, 0xe7,
+    0xe8, 0xe6, 0xe5, 0xe8, 0xf1, 0xfd, 0x08, 0x11, 0x17, 0x1d, 0x22, 0x25,
+    0x1f, 0x13, 0x04, 0xf9, 0xf5, 0xf5, 0xf1, 0xe9, 0xe0, 0xdc, 0xde, 0xe6,
+    0xf0, 0xf9, 0x02, 0x0d, 0x18, 0x20, 0x23, 0x1e, 0x16, 0x0e, 0x0b, 0x09,
+    0x05, 0xfc, 0xef, 0xe3, 0xdb, 0xdb, 0xdf, 0xe5, 0xec, 0xf5, 0x01, 0x0d,
+    0x16, 0x19, 0x17, 0x15, 0x17, 0x1b, 0x1b, 0x14, 0x07, 0xf8, 0xec, 0xe3,
+    0xdf, 0xde, 0xe0, 0xe5, 0xec, 0xf6, 0xff, 0x05, 0x09, 0x0c, 0x13, 0x1c,
+    0x24, 0x25, 0x1e, 0x11, 0x03, 0xf8, 0xf0, 0xea, 0xe4, 0xe2, 0xe3, 0xe7,
+    0xec, 0xef, 0xf1, 0xf7, 0x01, 0x0e, 0x1b, 0x24, 0x25, 0x20, 0x17, 0x0e,
+    0x06, 0xfe, 0xf7, 0xf0, 0xeb, 0xe8, 0xe6, 0xe4, 0xe1, 0xe2, 0xe8, 0xf6,
+    0x06, 0x14, 0x1c, 0x1e, 0x1c, 0x1a, 0x17, 0x12, 0x0c, 0x06, 0x00, 0xfa,
+    0xf2, 0xe9, 0xdf, 0xda, 0xda, 0xe2, 0xee, 0xfc, 0x07, 0x0e, 0x11, 0x14,
+    0x18, 0x1a, 0x1a, 0x18, 0x15, 0x11, 0x0a, 0xfe, 0xef, 0xe2, 0xda, 0xdb,
+    0xe2, 0xea, 0xf1, 0xf7, 0xfc, 0x02, 0x09, 0x10, 0x16, 0x1b, 0x1f, 0x21,
+    0x1e, 0x16, 0x08, 0xf8, 0xeb, 0xe5, 0xe5, 0xe8, 0xe9, 0xe9, 0xe9, 0xec,
+    0xf3, 0xfd, 0x05, 0x0e, 0x17, 0x20, 0x26, 0x25, 0x1c, 0x0e, 0x02, 0xfa,
+    0xf7, 0xf5, 0xf1, 0xeb, 0xe4, 0xe1, 0xe2, 0xe7, 0xef, 0xf8, 0x03, 0x0f,
+    0x1b, 0x23, 0x23, 0x1c, 0x12, 0x0c, 0x0a, 0x0a, 0x06, 0xfc, 0xef, 0xe5,
+    0xe0, 0xe0, 0xe1, 0xe5, 0xec, 0xf8, 0x06, 0x12, 0x18, 0x18, 0x15, 0x14,
+    0x16, 0x1a, 0x1b, 0x14, 0x07, 0xf8, 0xed, 0xe6, 0xe3, 0xe1, 0xe0, 0xe4,
+    0xee, 0xfb, 0x05, 0x08, 0x08, 0x0a, 0x12, 0x1d, 0x25, 0x24, 0x1b, 0x0f,
+    0x03, 0xfa, 0xf3, 0xeb, 0xe4, 0xe1, 0xe3, 0xea, 0xf0, 0xf4, 0xf5, 0xf7,
+    0xff, 0x0d, 0x1d, 0x26, 0x25, 0x1d, 0x14, 0x0e, 0x09, 0x02, 0xf7, 0xed,
+    0xe8, 0xe9, 0xeb, 0xea, 0xe6, 0xe3, 0xe8, 0xf6, 0x07, 0x16, 0x1d, 0x1d,
+    0x1a, 0x18, 0x17, 0x15, 0x0e, 0x04, 0xfb, 0xf5, 0xf2, 0xef, 0xe7, 0xdd,
+    0xd9, 0xe0, 0xef, 0x00, 0x0a, 0x0d, 0x0e, 0x12, 0x18, 0x1d, 0x1c, 0x16,
+    0x0f, 0x0a, 0x06, 0x00, 0xf5, 0xe7, 0xdc, 0xd9, 0xe0, 0xeb, 0xf6, 0xfa,
+    0xfc, 0xff, 0x08, 0x13, 0x1b, 0x1d, 0x1a, 0x17, 0x16, 0x14, 0x0c, 0xfd,
+    0xec, 0xe2, 0xe2, 0xe7, 0xeb, 0xec, 0xea, 0xec, 0xf3, 0xfe, 0x0a, 0x12,
+    0x16, 0x19, 0x1c, 0x1f, 0x1d, 0x15, 0x06, 0xf8, 0xf0, 0xf0, 0xf1, 0xee,
+    0xe6, 0xe0, 0xe0, 0xe9, 0xf5, 0xff, 0x04, 0x0a, 0x12, 0x1c, 0x22, 0x20,
+    0x18, 0x0d, 0x06, 0x03, 0x01, 0xfc, 0xf2, 0xe6, 0xdf, 0xde, 0xe4, 0xec,
+    0xf2, 0xf7, 0xfd, 0x09, 0x15, 0x1d, 0x1d, 0x17, 0x12, 0x12, 0x14, 0x11,
+    0x07, 0xf8, 0xec, 0xe5, 0xe5, 0xe5, 0xe6, 0xe7, 0xeb, 0xf3, 0xff, 0x09,
+    0x10, 0x12, 0x13, 0x16, 0x1a, 0x1e, 0x1a, 0x10, 0x02, 0xf7, 0xf1, 0xef,
+    0xeb, 0xe5, 0xe0, 0xe2, 0xeb, 0xf5, 0xfc, 0x00, 0x04, 0x0b, 0x15, 0x1d,
+    0x20, 0x1c, 0x15, 0x0c, 0x06, 0x00, 0xfa, 0xf1, 0xe8, 0xe2, 0xe1, 0xe6,
+    0xeb, 0xef, 0xf2, 0xf7, 0x01, 0x0e, 0x18, 0x1c, 0x1a, 0x17, 0x15, 0x14,
+    0x0f, 0x06, 0xfa, 0xf0, 0xeb, 0xe9, 0xe7, 0xe6, 0xe5, 0xe7, 0xee, 0xf8,
+    0x02, 0x0c, 0x11, 0x14, 0x17, 0x1a, 0x1b, 0x18, 0x10, 0x05, 0xfc, 0xf7,
+    0xf3, 0xee, 0xe7, 0xe2, 0xe1, 0xe7, 0xef, 0xf6, 0xfc, 0x03, 0x0b, 0x14,
+    0x1a, 0x1c, 0x1a, 0x15, 0x10, 0x0a, 0x05, 0xfe, 0xf6, 0xed, 0xe6, 0xe3,
+    0xe3, 0xe7, 0xeb, 0xf0, 0xf7, 0x01, 0x0b, 0x13, 0x16, 0x16, 0x16, 0x16,
+    0x16, 0x12, 0x0a, 0x00, 0xf7, 0xef, 0xea, 0xe6, 0xe3, 0xe3, 0xe8, 0xef,
+    0xf8, 0x00, 0x06, 0x0b, 0x0f, 0x14, 0x19, 0x1c, 0x1a, 0x14, 0x0c, 0x03,
+    0xfb, 0xf3, 0xec, 0xe6, 0xe3, 0xe6, 0xeb, 0xf0, 0xf3, 0xf6, 0xfc, 0x05,
+    0x10, 0x18, 0x1c, 0x1c, 0x1a, 0x15, 0x0f, 0x07, 0xfd, 0xf5, 0xef, 0xec,
+    0xeb, 0xea, 0xe9, 0xe8, 0xea, 0xf0, 0xfb, 0x07, 0x11, 0x16, 0x19, 0x1a,
+    0x1a, 0x17, 0x10, 0x07, 0x00, 0xfc, 0xf9, 0xf4, 0xed, 0xe5, 0xe0, 0xe2,
+    0xe9, 0xf3, 0xfc, 0x05, 0x0c, 0x11, 0x16, 0x18, 0x18, 0x14, 0x10, 0x0d,
+    0x0b, 0x07, 0xff, 0xf2, 0xe6, 0xdf, 0xe0, 0xe6, 0xed, 0xf3, 0xf8, 0xfe,
+    0x06, 0x0d, 0x11, 0x12, 0x13, 0x16, 0x19, 0x19, 0x13, 0x06, 0xf8, 0xec,
+    0xe7, 0xe7, 0xe9, 0xeb, 0xec, 0xee, 0xf2, 0xfa, 0x01, 0x05, 0x09, 0x10,
+    0x18, 0x20, 0x21, 0x19, 0x0c, 0xff, 0xf7, 0xf4, 0xf3, 0xf0, 0xec, 0xe8,
+    0xe8, 0xeb, 0xef, 0xf3, 0xf7, 0xff, 0x0b, 0x18, 0x20, 0x21, 0x19, 0x0f,
+    0x07, 0x04, 0x04, 0x02, 0xfa, 0xf1, 0xea, 0xe7, 0xe7, 0xe7, 0xe7, 0xec,
+    0xf6, 0x06, 0x13, 0x19, 0x18, 0x12, 0x0e, 0x0f, 0x12, 0x13, 0x0e, 0x04,
+    0xfa, 0xf1, 0xeb, 0xe6, 0xe2, 0xe1, 0xe5, 0xf1, 0xff, 0x09, 0x0b, 0x09,
+    0x07, 0x0b, 0x14, 0x1c, 0x1d, 0x17, 0x0d, 0x04, 0xfb, 0xf3, 0xea, 0xe3,
+    0xe2, 0xe7, 0xf0, 0xf8, 0xfb, 0xfa, 0xf8, 0xfd, 0x08, 0x15, 0x1f, 0x20,
+    0x1b, 0x13, 0x0c, 0x05, 0xfd, 0xf3, 0xeb, 0xe9, 0xed, 0xf2, 0xf2, 0xed,
+    0xe8, 0xea, 0xf4, 0x04, 0x12, 0x1a, 0x1c, 0x19, 0x16, 0x12, 0x0d, 0x06,
+    0xfd, 0xf8, 0xf7, 0xf8, 0xf6, 0xee, 0xe3, 0xdd, 0xe1, 0xef, 0xff, 0x0b,
+    0x10, 0x11, 0x13, 0x15, 0x15, 0x12, 0x0d, 0x09, 0x08, 0x07, 0x03, 0xf9,
+    0xeb, 0xdf, 0xdb, 0xe1, 0xed, 0xf9, 0x00, 0x03, 0x05, 0x09, 0x0e, 0x12,
+    0x12, 0x12, 0x13, 0x16, 0x15, 0x0d, 0xfd, 0xec, 0xe2, 0xe1, 0xe8, 0xf0,
+    0xf4, 0xf5, 0xf5, 0xf8, 0xfe, 0x04, 0x0a, 0x0f, 0x15, 0x1b, 0x1f, 0x1c,
+    0x11, 0x02, 0xf3, 0xed, 0xee, 0xf3, 0xf4, 0xf1, 0xec, 0xea, 0xed, 0xf3,
+    0xf9, 0x00, 0x09, 0x14, 0x1e, 0x21, 0x1c, 0x11, 0x05, 0xfe, 0xfd, 0xff,
+    0xfe, 0xf9, 0xf1, 0xe9, 0xe4, 0xe5, 0xea, 0xf0, 0xf8, 0x03, 0x0f, 0x18,
+    0x1b, 0x16, 0x0e, 0x09, 0x0a, 0x0d, 0x0f, 0x09, 0xff, 0xf3, 0xea, 0xe5,
+    0xe3, 0xe5, 0xea, 0xf2, 0xfd, 0x07, 0x0c, 0x0d, 0x0a, 0x0a, 0x0d, 0x13,
+    0x19, 0x19, 0x12, 0x06, 0xf9, 0xf0, 0xea, 0xe7, 0xe6, 0xe9, 0xf0, 0xf8,
+    0xfd, 0xfe, 0xfd, 0xfe, 0x05, 0x0f, 0x1a, 0x1f, 0x1d, 0x16, 0x0c, 0x02,
+    0xf9, 0xf3, 0xef, 0xee, 0xef, 0xf1, 0xf2, 0xf2, 0xef, 0xef, 0xf4, 0xff,
+    0x0e, 0x19, 0x1d, 0x1b, 0x16, 0x10, 0x0a, 0x04, 0xfe, 0xfa, 0xf9, 0xf8,
+    0xf5, 0xef, 0xe8, 0xe4, 0xe6, 0xef, 0xfb, 0x08, 0x10, 0x14, 0x15, 0x13,
+    0x10, 0x0e, 0x0c, 0x0a, 0x08, 0x05, 0x01, 0xf9, 0xee, 0xe4, 0xe0, 0xe3,
+    0xed, 0xf7, 0xff, 0x04, 0x07, 0x0a, 0x0c, 0x0e, 0x0f, 0x11, 0x13, 0x14,
+    0x11, 0x09, 0xfd, 0xf0, 0xe8, 0xe5, 0xe8, 0xee, 0xf3, 0xf7, 0xf8, 0xfa,
+    0xfe, 0x03, 0x08, 0x0e, 0x14, 0x19, 0x1c, 0x18, 0x0e, 0x01, 0xf6, 0xf1,
+    0xf0, 0xf2, 0xf2, 0xf0, 0xef, 0xee, 0xf0, 0xf3, 0xf9, 0x00, 0x09, 0x13,
+    0x1a, 0x1c, 0x18, 0x0f, 0x06, 0x00, 0xfe, 0xfe, 0xfd, 0xf8, 0xf1, 0xeb,
+    0xe8, 0xe9, 0xec, 0xf0, 0xf8, 0x02, 0x0e, 0x15, 0x16, 0x12, 0x0c, 0x0a,
+    0x0b, 0x0c, 0x0b, 0x05, 0xfd, 0xf4, 0xed, 0xe8, 0xe7, 0xe7, 0xeb, 0xf3,
+    0xfc, 0x05, 0x0b, 0x0b, 0x09, 0x09, 0x0d, 0x14, 0x17, 0x15, 0x0d, 0x02,
+    0xfa, 0xf4, 0xef, 0xea, 0xe8, 0xea, 0xf1, 0xf8, 0xfc, 0xfd, 0xfc, 0xff,
+    0x05, 0x0f, 0x18, 0x1b, 0x18, 0x11, 0x09, 0x02, 0xfd, 0xf7, 0xf2, 0xee,
+    0xee, 0xf1, 0xf3, 0xf3, 0xf0, 0xef, 0xf6, 0x02, 0x0e, 0x16, 0x18, 0x15,
+    0x11, 0x0e, 0x0b, 0x06, 0x00, 0xfb, 0xf8, 0xf6, 0xf4, 0xf0, 0xea, 0xe6,
+    0xe8, 0xf1, 0xfd, 0x09, 0x0e, 0x0f, 0x0d, 0x0e, 0x10, 0x11, 0x0e, 0x09,
+    0x05, 0x02, 0xff, 0xf9, 0xf0, 0xe7, 0xe3, 0xe7, 0xf0, 0xfa, 0x00, 0x02,
+    0x02, 0x05, 0x0a, 0x10, 0x13, 0x13, 0x11, 0x0f, 0x0c, 0x08, 0xfe, 0xf3,
+    0xea, 0xe7, 0xec, 0xf3, 0xf6, 0xf6, 0xf4, 0xf6, 0xfc, 0x05, 0x0c, 0x10,
+    0x12, 0x14, 0x15, 0x13, 0x0d, 0x02, 0xf8, 0xf2, 0xf2, 0xf4, 0xf5, 0xf2,
+    0xed, 0xea, 0xec, 0xf4, 0xfe, 0x05, 0x0a, 0x0e, 0x12, 0x16, 0x15, 0x0e,
+    0x06, 0x00, 0xfe, 0xff, 0xff, 0xf9, 0xf0, 0xe8, 0xe5, 0xe9, 0xf0, 0xf7,
+    0xfc, 0x02, 0x07, 0x0d, 0x11, 0x11, 0x0d, 0x09, 0x09, 0x0b, 0x0c, 0x08,
+    0xfd, 0xf1, 0xe9, 0xe7, 0xeb, 0xef, 0xf2, 0xf5, 0xf9, 0xff, 0x05, 0x08,
+    0x09, 0x09, 0x0c, 0x12, 0x16, 0x14, 0x0c, 0x01, 0xf6, 0xf0, 0xef, 0xf0,
+    0xf1, 0xf0, 0xf0, 0xf3, 0xf7, 0xfb, 0xfd, 0xff, 0x05, 0x0d, 0x16, 0x1a,
+    0x17, 0x0e, 0x04, 0xfd, 0xfb, 0xfa, 0xf8, 0xf5, 0xf1, 0xef, 0xef, 0xf0,
+    0xf1, 0xf3, 0xf8, 0x01, 0x0c, 0x15, 0x17, 0x13, 0x0c, 0x07, 0x06, 0x07,
+    0x06, 0x02, 0xfc, 0xf6, 0xf2, 0xee, 0xeb, 0xea, 0xec, 0xf4, 0xff, 0x09,
+    0x0e, 0x0e, 0x0b, 0x09, 0x0a, 0x0e, 0x10, 0x0f, 0x0a, 0x03, 0xfc, 0xf6,
+    0xf0, 0xeb, 0xe9, 0xeb, 0xf3, 0xfc, 0x02, 0x03, 0x01, 0x01, 0x05, 0x0c,
+    0x13, 0x16, 0x15, 0x11, 0x0b, 0x03, 0xfb, 0xf4, 0xee, 0xed, 0xf0, 0xf5,
+    0xf8, 0xf8, 0xf6, 0xf5, 0xf8, 0x00, 0x0b, 0x13, 0x16, 0x16, 0x13, 0x0f,
+    0x08, 0x01, 0xfa, 0xf7, 0xf7, 0xf9, 0xf9, 0xf6, 0xf0, 0xeb, 0xec, 0xf2,
+    0xfc, 0x06, 0x0e, 0x12, 0x13, 0x12, 0x0f, 0x0a, 0x05, 0x02, 0x02, 0x03,
+    0x02, 0xfd, 0xf4, 0xea, 0xe6, 0xe8, 0xf0, 0xf9, 0x01, 0x06, 0x09, 0x0c,
+    0x0c, 0x0b, 0x09, 0x09, 0x0b, 0x0e, 0x0e, 0x09, 0xff, 0xf3, 0xea, 0xe7,
+    0xea, 0xf0, 0xf6, 0xfb, 0xfe, 0x00, 0x02, 0x03, 0x04, 0x07, 0x0b, 0x12,
+    0x17, 0x16, 0x0d, 0x01, 0xf5, 0xf0, 0xef, 0xf2, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf7, 0xf7, 0xf9, 0xfd, 0x04, 0x0d, 0x16, 0x1a, 0x17, 0x0d, 0x02, 0xfb,
+    0xf9, 0xfa, 0xfb, 0xfa, 0xf7, 0xf3, 0xf1, 0xf0, 0xef, 0xf0, 0xf6, 0x01,
+    0x0e, 0x16, 0x17, 0x11, 0x09, 0x04, 0x03, 0x05, 0x06, 0x05, 0x01, 0xfb,
+    0xf5, 0xef, 0xeb, 0xe9, 0xec, 0xf4, 0xff, 0x0a, 0x10, 0x0e, 0x08, 0x04,
+    0x05, 0x0a, 0x0f, 0x10, 0x0c, 0x06, 0x00, 0xf8, 0xf0, 0xe9, 0xe7, 0xeb,
+    0xf5, 0xff, 0x04, 0x04, 0x00, 0xfd, 0xff, 0x06, 0x0f, 0x15, 0x16, 0x12,
+    0x0c, 0x04, 0xfc, 0xf4, 0xed, 0xec, 0xf1, 0xf9, 0xfe, 0xfd, 0xf7, 0xf2,
+    0xf3, 0xfb, 0x07, 0x10, 0x15, 0x16, 0x14, 0x0f, 0x08, 0xff, 0xf8, 0xf5,
+    0xf7, 0xfb, 0xfe, 0xfc, 0xf5, 0xed, 0xe9, 0xed, 0xf8, 0x05, 0x0e, 0x12,
+    0x12, 0x11, 0x0e, 0x09, 0x02, 0xfe, 0xff, 0x03, 0x06, 0x03, 0xf9, 0xee,
+    0xe6, 0xe6, 0xed, 0xf7, 0x01, 0x07, 0x0a, 0x0b, 0x0a, 0x09, 0x06, 0x05,
+    0x06, 0x0a, 0x0f, 0x0e, 0x06, 0xf8, 0xeb, 0xe5, 0xe8, 0xf0, 0xf8, 0xfd,
+    0xff, 0x01, 0x02, 0x02, 0x01, 0x02, 0x06, 0x0d, 0x15, 0x17, 0x12, 0x06,
+    0xf8, 0xee, 0xeb, 0xef, 0xf5, 0xf9, 0xfa, 0xf9, 0xf8, 0xf7, 0xf8, 0xfa,
+    0xfe, 0x06, 0x12, 0x1a, 0x1a, 0x11, 0x04, 0xf9, 0xf5, 0xf7, 0xfb, 0xfd,
+    0xfc, 0xf9, 0xf5, 0xf1, 0xef, 0xef, 0xf3, 0xfc, 0x08, 0x13, 0x18, 0x15,
+    0x0c, 0x02, 0xfd, 0xfe, 0x03, 0x06, 0x05, 0xff, 0xf8, 0xf2, 0xed, 0xe9,
+    0xe9, 0xef, 0xfb, 0x08, 0x10, 0x11, 0x0b, 0x03, 0x00, 0x03, 0x08, 0x0d,
+    0x0f, 0x0b, 0x04, 0xfb, 0xf2, 0xeb, 0xe8, 0xea, 0xf1, 0xfc, 0x05, 0x08,
+    0x05, 0xfe, 0xfb, 0xff, 0x07, 0x10, 0x15, 0x14, 0x0f, 0x07, 0xfe, 0xf5,
+    0xee, 0xeb, 0xef, 0xf7, 0xfe, 0x00, 0xfd, 0xf7, 0xf3, 0xf5, 0xfe, 0x09,
+    0x13, 0x17, 0x15, 0x10, 0x08, 0x00, 0xf9, 0xf4, 0xf4, 0xf9, 0xff, 0x00,
+    0xfb, 0xf2, 0xeb, 0xeb, 0xf2, 0xfe, 0x09, 0x11, 0x14, 0x12, 0x0e, 0x07,
+    0x01, 0xfd, 0xfd, 0x01, 0x05, 0x05, 0x00, 0xf6, 0xeb, 0xe5, 0xe8, 0xf2,
+    0xfd, 0x06, 0x0b, 0x0c, 0x0b, 0x08, 0x05, 0x01, 0x02, 0x07, 0x0d, 0x0f,
+    0x0a, 0xff, 0xf1, 0xe8, 0xe6, 0xeb, 0xf4, 0xfc, 0x02, 0x04, 0x03, 0x01,
+    0x00, 0xff, 0x02, 0x08, 0x10, 0x16, 0x15, 0x0c, 0xfe, 0xf1, 0xec, 0xee,
+    0xf3, 0xf9, 0xfc, 0xfc, 0xfc, 0xfa, 0xf8, 0xf7, 0xfa, 0x02, 0x0d, 0x16,
+    0x1a, 0x14, 0x09, 0xfd, 0xf5, 0xf4, 0xf8, 0xfc, 0xfe, 0xfc, 0xf9, 0xf5,
+    0xf1, 0xef, 0xf0, 0xf6, 0x02, 0x0f, 0x17, 0x17, 0x0f, 0x04, 0xfd, 0xfd,
+    0x00, 0x04, 0x05, 0x03, 0xfe, 0xf8, 0xf1, 0xeb, 0xe9, 0xed, 0xf7, 0x03,
+    0x0e, 0x11, 0x0e, 0x06, 0x00, 0xff, 0x05, 0x0b, 0x0e, 0x0c, 0x07, 0x00,
+    0xf8, 0xf0, 0xea, 0xe9, 0xee, 0xf9, 0x04, 0x09, 0x07, 0x00, 0xfc, 0xfc,
+    0x03, 0x0b, 0x12, 0x14, 0x11, 0x0a, 0x02, 0xf9, 0xf2, 0xed, 0xee, 0xf5,
+    0xfd, 0x03, 0x01, 0xfa, 0xf3, 0xf3, 0xfa, 0x05, 0x0f, 0x14, 0x14, 0x11,
+    0x0c, 0x04, 0xfc, 0xf5, 0xf4, 0xf8, 0xfe, 0x02, 0xff, 0xf8, 0xef, 0xeb,
+    0xef, 0xfa, 0x06, 0x0e, 0x12, 0x11, 0x0e, 0x0a, 0x05, 0xff, 0xfc, 0xfe,
+    0x04, 0x08, 0x05, 0xfc, 0xef, 0xe8, 0xe8, 0xf0, 0xfb, 0x04, 0x09, 0x0b,
+    0x0b, 0x09, 0x06, 0x03, 0x02, 0x05, 0x0a, 0x0f, 0x0e, 0x06, 0xf8, 0xec,
+    0xe7, 0xeb, 0xf4, 0xfd, 0x01, 0x02, 0x02, 0x02, 0x01, 0x00, 0x01, 0x05,
+    0x0c, 0x14, 0x16, 0x10, 0x03, 0xf7, 0xef, 0xef, 0xf4, 0xfa, 0xfe, 0xfd,
+    0xfb, 0xf9, 0xf9, 0xf9, 0xfb, 0x00, 0x08, 0x11, 0x18, 0x17, 0x0e, 0x01,
+    0xf8, 0xf6, 0xfa, 0xff, 0x00, 0xfe, 0xfa, 0xf6, 0xf3, 0xf1, 0xf2, 0xf6,
+    0xff, 0x0a, 0x12, 0x15, 0x11, 0x08, 0x00, 0xfd, 0xff, 0x05, 0x08, 0x06,
+    0xff, 0xf8, 0xf3, 0xef, 0xee, 0xef, 0xf4, 0xfe, 0x09, 0x0f, 0x0d, 0x07,
+    0x00, 0xff, 0x04, 0x0a, 0x0e, 0x0e, 0x09, 0x01, 0xf9, 0xf3, 0xee, 0xed,
+    0xf0, 0xf6, 0xff, 0x05, 0x06, 0x02, 0xfc, 0xfb, 0x00, 0x09, 0x12, 0x14,
+    0x11, 0x0a, 0x03, 0xfc, 0xf6, 0xf2, 0xf1, 0xf5, 0xfb, 0xff, 0xff, 0xfa,
+    0xf5, 0xf4, 0xf8, 0x02, 0x0c, 0x13, 0x14, 0x10, 0x0a, 0x04, 0xff, 0xfc,
+    0xfa, 0xfa, 0xfd, 0xff, 0xff, 0xf9, 0xf1, 0xec, 0xef, 0xf8, 0x03, 0x0c,
+    0x0f, 0x0e, 0x0c, 0x08, 0x05, 0x02, 0x01, 0x02, 0x04, 0x05, 0x03, 0xfc,
+    0xf3, 0xeb, 0xea, 0xef, 0xf9, 0x02, 0x08, 0x08, 0x06, 0x04, 0x04, 0x04,
+    0x05, 0x07, 0x0a, 0x0d, 0x0c, 0x05, 0xfa, 0xef, 0xeb, 0xee, 0xf4, 0xfb,
+    0xff, 0x00, 0xff, 0xfd, 0xfd, 0xff, 0x02, 0x07, 0x0d, 0x11, 0x12, 0x0e,
+    0x04, 0xfa, 0xf2, 0xf1, 0xf6, 0xfb, 0xfe, 0xfb, 0xf8, 0xf5, 0xf5, 0xf7,
+    0xfa, 0x00, 0x08, 0x10, 0x14, 0x12, 0x0b, 0x02, 0xfb, 0xfa, 0xfc, 0x00,
+    0x01, 0xff, 0xf9, 0xf3, 0xef, 0xef, 0xf2, 0xf8, 0xff, 0x07, 0x00, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0x08, 0x14, 0x18, 0x17, 0x1b, 0x1c, 0x1f, 0x22, 0x22, 0x26, 0x24,
+    0x2b, 0x27, 0x0e, 0x05, 0x0f, 0x27, 0x2f, 0x2c, 0x2c, 0x2b, 0x2b, 0x2b,
+    0x2a, 0x29, 0x29, 0x23, 0x25, 0x1e, 0x01, 0xfb, 0x08, 0x1a, 0x1f, 0x1a,
+    0x1d, 0x19, 0x19, 0x17, 0x13, 0x14, 0x11, 0x0f, 0x0e, 0x04, 0xed, 0xe8,
+    0xf6, 0x05, 0x0b, 0x07, 0x0c, 0x0b, 0x0d, 0x10, 0x0f, 0x12, 0x0f, 0x11,
+    0x0f, 0x02, 0xf0, 0xf1, 0x04, 0x0e, 0x11, 0x12, 0x16, 0x16, 0x1a, 0x1a,
+    0x18, 0x1a, 0x15, 0x18, 0x15, 0x04, 0xf9, 0xfe, 0x12, 0x19, 0x16, 0x16,
+    0x15, 0x13, 0x12, 0x10, 0x0f, 0x10, 0x0a, 0x0e, 0x0a, 0xf0, 0xe8, 0xed,
+    0xfc, 0x01, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf7, 0xf8,
+    0xf1, 0xd9, 0xd5, 0xe0, 0xf0, 0xf8, 0xf6, 0xfd, 0xfc, 0xff, 0x00, 0xfe,
+    0x00, 0xff, 0x03, 0x08, 0x04, 0xf7, 0xfa, 0x0a, 0x16, 0x19, 0x15, 0x18,
+    0x17, 0x1a, 0x1e, 0x20, 0x25, 0x25, 0x2b, 0x2b, 0x1d, 0x0f, 0x12, 0x24,
+    0x29, 0x27, 0x25, 0x27, 0x28, 0x29, 0x2c, 0x2b, 0x2a, 0x21, 0x22, 0x1c,
+    0x07, 0xfe, 0x05, 0x1c, 0x23, 0x20, 0x21, 0x1d, 0x19, 0x15, 0x12, 0x0f,
+    0x10, 0x0c, 0x12, 0x10, 0xf7, 0xf0, 0xf7, 0x05, 0x0a, 0x04, 0x06, 0x04,
+    0x05, 0x06, 0x07, 0x0c, 0x0f, 0x10, 0x12, 0x09, 0xf1, 0xeb, 0xf6, 0x03,
+    0x0a, 0x0a, 0x14, 0x17, 0x19, 0x19, 0x16, 0x15, 0x10, 0x12, 0x13, 0x0a,
+    0xfe, 0x01, 0x13, 0x1e, 0x1f, 0x1a, 0x19, 0x15, 0x12, 0x10, 0x0c, 0x0c,
+    0x08, 0x0d, 0x0d, 0x00, 0xf2, 0xf0, 0xfe, 0x00, 0xfa, 0xf7, 0xf7, 0xf9,
+    0xfd, 0x01, 0x01, 0x02, 0xfa, 0xfa, 0xf4, 0xdd, 0xd4, 0xda, 0xee, 0xf8,
+    0xf8, 0xff, 0x01, 0x04, 0x05, 0x06, 0x06, 0x08, 0x04, 0x08, 0x07, 0xf5,
+    0xf8, 0x08, 0x1a, 0x20, 0x19, 0x1b, 0x16, 0x16, 0x18, 0x1a, 0x21, 0x26,
+    0x2c, 0x30, 0x29, 0x16, 0x12, 0x1c, 0x24, 0x26, 0x21, 0x27, 0x26, 0x28,
+    0x29, 0x27, 0x27, 0x20, 0x21, 0x1d, 0x0f, 0x00, 0xfe, 0x0f, 0x1a, 0x1e,
+    0x1f, 0x21, 0x1d, 0x18, 0x12, 0x0c, 0x0c, 0x07, 0x0e, 0x0e, 0x01, 0xf9,
+    0xfa, 0x0a, 0x0c, 0x05, 0x04, 0x03, 0x03, 0x04, 0x07, 0x0a, 0x0f, 0x0c,
+    0x10, 0x0d, 0xf6, 0xf1, 0xf7, 0x06, 0x0a, 0x07, 0x0d, 0x11, 0x16, 0x19,
+    0x18, 0x17, 0x14, 0x0f, 0x10, 0x0d, 0xfc, 0x00, 0x10, 0x20, 0x24, 0x1c,
+    0x1b, 0x13, 0x0f, 0x0c, 0x09, 0x0a, 0x08, 0x0a, 0x0b, 0x03, 0xf3, 0xef,
+    0xfa, 0x02, 0x01, 0xfa, 0xf9, 0xf5, 0xf8, 0xfc, 0xfd, 0x00, 0xfc, 0xfd,
+    0xf6, 0xe6, 0xd6, 0xd4, 0xe8, 0xf4, 0xfb, 0x00, 0x06, 0x07, 0x06, 0x06,
+    0x02, 0x04, 0x02, 0x09, 0x0c, 0xff, 0xfa, 0x02, 0x17, 0x1d, 0x1b, 0x1d,
+    0x1d, 0x1d, 0x1c, 0x1b, 0x1c, 0x22, 0x25, 0x30, 0x32, 0x1b, 0x15, 0x1b,
+    0x25, 0x26, 0x1e, 0x23, 0x26, 0x2a, 0x2e, 0x2d, 0x2b, 0x27, 0x21, 0x1d,
+    0x15, 0x01, 0x01, 0x0d, 0x1a, 0x1e, 0x19, 0x1c, 0x17, 0x16, 0x13, 0x0f,
+    0x10, 0x0a, 0x09, 0x09, 0x02, 0xf6, 0xf8, 0x04, 0x0a, 0x09, 0x03, 0x03,
+    0x00, 0x03, 0x06, 0x0a, 0x12, 0x0f, 0x13, 0x10, 0x00, 0xf3, 0xf2, 0x03,
+    0x09, 0x09, 0x0c, 0x11, 0x12, 0x12, 0x12, 0x10, 0x12, 0x0d, 0x13, 0x10,
+    0xff, 0xfb, 0x05, 0x19, 0x20, 0x1c, 0x1b, 0x15, 0x10, 0x0b, 0x08, 0x07,
+    0x09, 0x09, 0x11, 0x10, 0xfa, 0xf4, 0xf9, 0x01, 0x02, 0xfa, 0xfd, 0xfb,
+    0xfb, 0xfd, 0xfb, 0xfc, 0xf9, 0xf7, 0xf7, 0xed, 0xdc, 0xd7, 0xe2, 0xed,
+    0xf4, 0xff, 0x13, 0x1b, 0x1d, 0x21, 0x1f, 0x22, 0x20, 0x25, 0x2d, 0x26,
+    0x28, 0x2b, 0x27, 0x26, 0x2f, 0x42, 0x49, 0x45, 0x46, 0x46, 0x47, 0x4c,
+    0x4a, 0x4c, 0x4c, 0x3c, 0x3a, 0x39, 0x2f, 0x2b, 0x31, 0x41, 0x44, 0x3d,
+    0x40, 0x3c, 0x3d, 0x42, 0x3d, 0x40, 0x37, 0x1a, 0x0e, 0x04, 0xf7, 0xf6,
+    0x03, 0x1a, 0x26, 0x29, 0x2f, 0x2b, 0x2a, 0x24, 0x1a, 0x17, 0x0a, 0xf8,
+    0xf6, 0xf9, 0xfb, 0x05, 0x13, 0x1f, 0x1d, 0x1a, 0x1c, 0x1a, 0x20, 0x20,
+    0x22, 0x29, 0x21, 0x19, 0x16, 0x10, 0x08, 0x07, 0x13, 0x18, 0x16, 0x1c,
+    0x23, 0x28, 0x2f, 0x2c, 0x2b, 0x28, 0x15, 0x08, 0x03, 0xf9, 0xf7, 0x00,
+    0x12, 0x19, 0x12, 0x12, 0x0d, 0x09, 0x0a, 0x03, 0x07, 0x05, 0xf3, 0xf0,
+    0xf0, 0xea, 0xe8, 0xea, 0xf3, 0xf2, 0xed, 0xf1, 0xf2, 0xf7, 0xfb, 0xf8,
+    0x00, 0xfd, 0xe9, 0xe7, 0xea, 0xe8, 0xee, 0xf9, 0x0a, 0x11, 0x17, 0x22,
+    0x23, 0x25, 0x22, 0x1f, 0x25, 0x20, 0x19, 0x20, 0x2a, 0x30, 0x3a, 0x47,
+    0x4e, 0x46, 0x41, 0x40, 0x3c, 0x3f, 0x3f, 0x42, 0x48, 0x3e, 0x39, 0x37,
+    0x32, 0x2c, 0x2d, 0x38, 0x3b, 0x33, 0x32, 0x32, 0x32, 0x37, 0x35, 0x36,
+    0x31, 0x1b, 0x10, 0x0b, 0x01, 0x01, 0x0c, 0x21, 0x29, 0x25, 0x25, 0x1e,
+    0x19, 0x16, 0x0d, 0x11, 0x0f, 0x01, 0x01, 0x03, 0x01, 0x02, 0x08, 0x14,
+    0x16, 0x11, 0x14, 0x11, 0x12, 0x16, 0x18, 0x23, 0x25, 0x18, 0x15, 0x12,
+    0x0a, 0x0a, 0x12, 0x1f, 0x22, 0x25, 0x2c, 0x2a, 0x2c, 0x27, 0x20, 0x1e,
+    0x13, 0x09, 0x06, 0x04, 0x01, 0x06, 0x14, 0x18, 0x11, 0x0d, 0x0b, 0x05,
+    0x04, 0xfe, 0xfb, 0xfd, 0xf3, 0xf1, 0xf3, 0xed, 0xe7, 0xe8, 0xf3, 0xf5,
+    0xef, 0xf3, 0xf7, 0xfc, 0x06, 0x09, 0x0d, 0x0d, 0xfa, 0xf4, 0xf3, 0xed,
+    0xf2, 0xfd, 0x10, 0x17, 0x16, 0x1d, 0x1e, 0x20, 0x24, 0x21, 0x27, 0x25,
+    0x15, 0x17, 0x1e, 0x21, 0x2a, 0x37, 0x44, 0x42, 0x3c, 0x3b, 0x35, 0x36,
+    0x39, 0x3c, 0x47, 0x48, 0x3e, 0x3b, 0x35, 0x2a, 0x28, 0x2f, 0x36, 0x35,
+    0x34, 0x37, 0x32, 0x33, 0x2e, 0x29, 0x28, 0x1b, 0x12, 0x0c, 0x03, 0xfd,
+    0xff, 0x11, 0x1c, 0x1c, 0x1d, 0x1a, 0x15, 0x13, 0x0d, 0x0c, 0x0e, 0x06,
+    0x08, 0x0c, 0x05, 0x06, 0x0b, 0x16, 0x17, 0x10, 0x13, 0x14, 0x16, 0x1c,
+    0x1b, 0x21, 0x22, 0x13, 0x10, 0x11, 0x0a, 0x0b, 0x12, 0x1e, 0x1f, 0x1c,
+    0x23, 0x22, 0x21, 0x21, 0x19, 0x19, 0x13, 0x02, 0x01, 0x04, 0x02, 0x08,
+    0x12, 0x1b, 0x15, 0x0d, 0x0b, 0x04, 0x03, 0x01, 0x00, 0x04, 0xfd, 0xf4,
+    0xf0, 0xeb, 0xe5, 0xe6, 0xf2, 0xf8, 0xf5, 0xf5, 0xf9, 0xf9, 0x00, 0x02,
+    0x05, 0x07, 0xfb, 0xf4, 0xf0, 0xec, 0xec, 0xf6, 0x0c, 0x19, 0x1c, 0x22,
+    0x23, 0x21, 0x22, 0x1f, 0x23, 0x27, 0x1e, 0x21, 0x27, 0x20, 0x24, 0x2d,
+    0x3a, 0x3e, 0x39, 0x3b, 0x36, 0x34, 0x36, 0x34, 0x3d, 0x40, 0x36, 0x34,
+    0x32, 0x25, 0x20, 0x23, 0x2d, 0x30, 0x2e, 0x35, 0x36, 0x35, 0x33, 0x2a,
+    0x2a, 0x21, 0x12, 0x0e, 0x0a, 0x04, 0x06, 0x12, 0x1b, 0x18, 0x13, 0x13,
+    0x10, 0x11, 0x0e, 0x0a, 0x0e, 0x08, 0x05, 0x06, 0x04, 0x00, 0x02, 0x0d,
+    0x0f, 0x09, 0x0a, 0x0e, 0x11, 0x18, 0x1c, 0x1f, 0x22, 0x16, 0x11, 0x0f,
+    0x08, 0x07, 0x0e, 0x1d, 0x21, 0x1e, 0x20, 0x1e, 0x1c, 0x1b, 0x17, 0x19,
+    0x18, 0x0a, 0x08, 0x09, 0x02, 0x03, 0x0a, 0x14, 0x12, 0x08, 0x07, 0x00,
+    0xfc, 0xfe, 0xfc, 0x04, 0x05, 0xf8, 0xf6, 0xf0, 0xe5, 0xe1, 0xe7, 0xf3,
+    0xf5, 0xfc, 0x0e, 0x12, 0x15, 0x1a, 0x1a, 0x21, 0x21, 0x19, 0x1c, 0x17,
+    0x1a, 0x1c, 0x16, 0x1b, 0x29, 0x42, 0x4c, 0x45, 0x47, 0x45, 0x45, 0x4a,
+    0x48, 0x49, 0x50, 0x4d, 0x4e, 0x4a, 0x3a, 0x36, 0x3b, 0x4b, 0x50, 0x4a,
+    0x50, 0x4a, 0x4b, 0x4c, 0x41, 0x42, 0x42, 0x37, 0x33, 0x2e, 0x23, 0x22,
+    0x27, 0x37, 0x3b, 0x38, 0x3e, 0x38, 0x3d, 0x3a, 0x28, 0x21, 0x15, 0x09,
+    0x06, 0x06, 0x0b, 0x18, 0x2b, 0x3a, 0x3a, 0x35, 0x33, 0x27, 0x26, 0x20,
+    0x11, 0x15, 0x15, 0x19, 0x1d, 0x1b, 0x1b, 0x1e, 0x2b, 0x32, 0x2d, 0x2e,
+    0x2e, 0x2d, 0x33, 0x2f, 0x27, 0x25, 0x19, 0x12, 0x0c, 0xff, 0xfd, 0x02,
+    0x15, 0x20, 0x1d, 0x22, 0x1e, 0x1c, 0x1a, 0x0b, 0x01, 0xfa, 0xee, 0xed,
+    0xee, 0xe9, 0xec, 0xf1, 0xfd, 0xfe, 0xf7, 0xfc, 0xf9, 0xfd, 0x00, 0xf6,
+    0xf9, 0xfa, 0xf1, 0xf0, 0xed, 0xe8, 0xed, 0xf8, 0x08, 0x0e, 0x11, 0x1a,
+    0x19, 0x1f, 0x1f, 0x14, 0x17, 0x16, 0x15, 0x18, 0x19, 0x1e, 0x28, 0x3a,
+    0x46, 0x43, 0x40, 0x41, 0x3c, 0x41, 0x41, 0x3d, 0x48, 0x4a, 0x4f, 0x51,
+    0x48, 0x42, 0x3e, 0x49, 0x4b, 0x43, 0x45, 0x44, 0x46, 0x4a, 0x44, 0x3e,
+    0x3d, 0x32, 0x2e, 0x2b, 0x1c, 0x19, 0x1a, 0x25, 0x2b, 0x27, 0x2c, 0x26,
+    0x24, 0x21, 0x13, 0x0e, 0x0a, 0x03, 0x09, 0x10, 0x11, 0x16, 0x1b, 0x24,
+    0x21, 0x19, 0x1d, 0x19, 0x1e, 0x20, 0x18, 0x1b, 0x1a, 0x14, 0x13, 0x12,
+    0x0f, 0x12, 0x1c, 0x24, 0x22, 0x21, 0x27, 0x26, 0x2d, 0x2c, 0x1e, 0x1b,
+    0x12, 0x0c, 0x0b, 0x08, 0x09, 0x0e, 0x1f, 0x26, 0x1f, 0x1a, 0x15, 0x0e,
+    0x10, 0x0e, 0x06, 0x0a, 0x06, 0x08, 0x07, 0xfc, 0xf8, 0xf9, 0x08, 0x0c,
+    0x04, 0x05, 0x02, 0x04, 0x0a, 0x07, 0x06, 0x06, 0xfc, 0xf9, 0xf6, 0xeb,
+    0xef, 0xfa, 0x0e, 0x18, 0x18, 0x20, 0x1d, 0x1d, 0x1c, 0x12, 0x13, 0x15,
+    0x11, 0x16, 0x1b, 0x1b, 0x22, 0x2e, 0x3a, 0x3c, 0x3a, 0x40, 0x3c, 0x3f,
+    0x3f, 0x37, 0x3e, 0x41, 0x41, 0x40, 0x3b, 0x32, 0x2e, 0x34, 0x39, 0x38,
+    0x3b, 0x43, 0x42, 0x46, 0x42, 0x32, 0x30, 0x27, 0x22, 0x20, 0x18, 0x17,
+    0x19, 0x27, 0x2d, 0x27, 0x26, 0x23, 0x1f, 0x20, 0x1b, 0x13, 0x14, 0x0d,
+    0x11, 0x16, 0x0f, 0x11, 0x15, 0x21, 0x24, 0x1c, 0x20, 0x1f, 0x23, 0x2a,
+    0x27, 0x27, 0x24, 0x18, 0x15, 0x13, 0x0a, 0x0e, 0x17, 0x27, 0x2b, 0x26,
+    0x29, 0x23, 0x23, 0x23, 0x19, 0x19, 0x17, 0x0d, 0x0c, 0x0c, 0x07, 0x0a,
+    0x14, 0x1c, 0x17, 0x0e, 0x0d, 0x06, 0x09, 0x0b, 0x05, 0x0b, 0x0b, 0x09,
+    0x05, 0xfa, 0xf0, 0xee, 0xf9, 0x02, 0x00, 0x00, 0x04, 0x03, 0x07, 0x03,
+    0xf9, 0xfb, 0xf6, 0xf7, 0xf7, 0xef, 0xf1, 0xfa, 0x10, 0x1c, 0x1a, 0x1e,
+    0x1d, 0x1b, 0x1b, 0x15, 0x12, 0x18, 0x19, 0x22, 0x29, 0x20, 0x23, 0x2a,
+    0x36, 0x3a, 0x36, 0x3f, 0x3f, 0x43, 0x47, 0x41, 0x43, 0x43, 0x3c, 0x3c,
+    0x3b, 0x30, 0x2e, 0x33, 0x3d, 0x41, 0x3f, 0x47, 0x43, 0x42, 0x3e, 0x30,
+    0x2f, 0x29, 0x22, 0x21, 0x1e, 0x1b, 0x1c, 0x23, 0x28, 0x22, 0x1b, 0x1a,
+    0x14, 0x17, 0x17, 0x0f, 0x14, 0x0f, 0x0b, 0x09, 0x01, 0xff, 0x03, 0x12,
+    0x18, 0x14, 0x15, 0x18, 0x19, 0x1e, 0x1c, 0x15, 0x13, 0x0a, 0x0a, 0x0b,
+    0x05, 0x08, 0x12, 0x25, 0x2c, 0x26, 0x27, 0x21, 0x1d, 0x1e, 0x18, 0x16,
+    0x17, 0x11, 0x15, 0x17, 0x08, 0x04, 0x08, 0x13, 0x15, 0x0d, 0x0f, 0x0a,
+    0x0c, 0x10, 0x0a, 0x0d, 0x0c, 0x02, 0x00, 0xfa, 0xed, 0xec, 0xf4, 0x04,
+    0x09, 0x08, 0x0d, 0x09, 0x0a, 0x06, 0xfc, 0xfe, 0xfc, 0xfc, 0xfe, 0xfb,
+    0xfa, 0xff, 0x0c, 0x15, 0x14, 0x14, 0x18, 0x14, 0x17, 0x15, 0x0f, 0x17,
+    0x18, 0x1d, 0x1f, 0x19, 0x17, 0x1a, 0x2a, 0x30, 0x2e, 0x35, 0x3b, 0x3e,
+    0x42, 0x3e, 0x38, 0x38, 0x30, 0x31, 0x32, 0x27, 0x27, 0x2d, 0x3a, 0x3d,
+    0x35, 0x38, 0x34, 0x33, 0x33, 0x2b, 0x29, 0x28, 0x22, 0x23, 0x23, 0x18,
+    0x14, 0x15, 0x1c, 0x1c, 0x14, 0x18, 0x17, 0x1b, 0x1f, 0x19, 0x1c, 0x19,
+    0x10, 0x0e, 0x0a, 0x05, 0x08, 0x11, 0x1e, 0x20, 0x1f, 0x23, 0x1e, 0x1f,
+    0x1e, 0x16, 0x18, 0x14, 0x12, 0x14, 0x12, 0x12, 0x17, 0x23, 0x28, 0x24,
+    0x21, 0x20, 0x1d, 0x20, 0x20, 0x1b, 0x1e, 0x19, 0x19, 0x16, 0x0a, 0x04,
+    0x03, 0x10, 0x14, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x0b, 0x06, 0x07, 0x00,
+    0x00, 0xfe, 0xef, 0xef, 0xf5, 0x02, 0x05, 0xfd, 0xff, 0xfb, 0xfa, 0xfb,
+    0xf4, 0xf6, 0xf8, 0xf6, 0xfa, 0xfb, 0xf4, 0xf7, 0xff, 0x0a, 0x0e, 0x0c,
+    0x12, 0x11, 0x15, 0x16, 0x10, 0x13, 0x12, 0x10, 0x13, 0x12, 0x0f, 0x13,
+    0x20, 0x2b, 0x2f, 0x31, 0x36, 0x34, 0x36, 0x34, 0x2b, 0x2e, 0x2b, 0x2b,
+    0x2d, 0x2a, 0x29, 0x29, 0x33, 0x36, 0x2f, 0x2f, 0x2e, 0x2c, 0x2e, 0x2c,
+    0x28, 0x2a, 0x24, 0x22, 0x1f, 0x14, 0x12, 0x12, 0x1c, 0x1f, 0x19, 0x1d,
+    0x1c, 0x1c, 0x1c, 0x14, 0x10, 0x0e, 0x05, 0x06, 0x08, 0x01, 0x05, 0x0e,
+    0x1a, 0x1d, 0x18, 0x1b, 0x17, 0x18, 0x18, 0x12, 0x13, 0x11, 0x0c, 0x0e,
+    0x0d, 0x07, 0x09, 0x11, 0x1b, 0x1c, 0x18, 0x1c, 0x19, 0x1d, 0x1e, 0x17,
+    0x17, 0x12, 0x0e, 0x0c, 0x07, 0x01, 0x01, 0x0b, 0x13, 0x11, 0x0f, 0x0f,
+    0x0b, 0x0d, 0x0c, 0x05, 0x08, 0x05, 0x05, 0x04, 0xfc, 0xf9, 0xf8, 0x04,
+    0x09, 0x06, 0x08, 0x07, 0x05, 0x07, 0x05, 0x03, 0x05, 0x00, 0x02, 0x02,
+    0xf9, 0xfb, 0x02, 0x0f, 0x16, 0x15, 0x1b, 0x1b, 0x1c, 0x1c, 0x16, 0x15,
+    0x15, 0x11, 0x15, 0x17, 0x11, 0x15, 0x1e, 0x28, 0x2a, 0x26, 0x2a, 0x29,
+    0x2d, 0x2e, 0x28, 0x2b, 0x2c, 0x29, 0x29, 0x26, 0x1e, 0x1d, 0x22, 0x28,
+    0x26, 0x23, 0x27, 0x24, 0x27, 0x26, 0x1d, 0x1e, 0x1a, 0x17, 0x15, 0x10,
+    0x0b, 0x0a, 0x13, 0x17, 0x13, 0x12, 0x11, 0x0d, 0x0e, 0x0b, 0x06, 0x07,
+    0x04, 0x06, 0x08, 0x03, 0x03, 0x06, 0x11, 0x16, 0x14, 0x17, 0x17, 0x18,
+    0x1b, 0x18, 0x16, 0x16, 0x10, 0x11, 0x11, 0x09, 0x0c, 0x12, 0x1d, 0x21,
+    0x1d, 0x20, 0x1d, 0x1d, 0x1e, 0x19, 0x19, 0x18, 0x12, 0x12, 0x10, 0x09,
+    0x08, 0x0b, 0x11, 0x10, 0x0b, 0x0c, 0x09, 0x0b, 0x0c, 0x07, 0x09, 0x08,
+    0x05, 0x04, 0xfe, 0xf7, 0xf6, 0xfd, 0x04, 0x04, 0x02, 0x05, 0x01, 0x03,
+    0x01, 0xf9, 0xfa, 0xf8, 0xf8, 0xf9, 0xf5, 0xf5, 0xfa, 0x07, 0x0e, 0x0d,
+    0x0e, 0x0f, 0x0e, 0x11, 0x10, 0x0d, 0x10, 0x0e, 0x11, 0x13, 0x0d, 0x0e,
+    0x13, 0x1f, 0x24, 0x23, 0x28, 0x29, 0x2b, 0x2e, 0x2c, 0x2b, 0x2a, 0x25,
+    0x26, 0x25, 0x1d, 0x1c, 0x20, 0x28, 0x2a, 0x25, 0x27, 0x24, 0x23, 0x22,
+    0x1c, 0x1d, 0x1c, 0x18, 0x18, 0x15, 0x0e, 0x0d, 0x10, 0x15, 0x13, 0x10,
+    0x11, 0x0d, 0x0e, 0x0d, 0x07, 0x09, 0x07, 0x05, 0x04, 0x01, 0xfe, 0x01,
+    0x0a, 0x12, 0x12, 0x12, 0x14, 0x12, 0x14, 0x11, 0x0b, 0x0b, 0x08, 0x0a,
+    0x0b, 0x07, 0x07, 0x0a, 0x14, 0x18, 0x13, 0x14, 0x14, 0x14, 0x16, 0x14,
+    0x11, 0x12, 0x0d, 0x0f, 0x0e, 0x03, 0x01, 0x02, 0x09, 0x0b, 0x05, 0x07,
+    0x06, 0x07, 0x09, 0x06, 0x05, 0x05, 0x01, 0x01, 0x00, 0xfa, 0xfa, 0xff,
+    0x07, 0x08, 0x03, 0x05, 0x02, 0x03, 0x03, 0xff, 0x01, 0x01, 0xff, 0x01,
+    0x00, 0xfe, 0x01, 0x08, 0x10, 0x10, 0x0e, 0x11, 0x10, 0x13, 0x14, 0x10,
+    0x12, 0x10, 0x10, 0x10, 0x0e, 0x0d, 0x10, 0x1b, 0x22, 0x21, 0x23, 0x25,
+    0x24, 0x27, 0x25, 0x21, 0x23, 0x1f, 0x21, 0x21, 0x1a, 0x17, 0x17, 0x1f,
+    0x21, 0x1d, 0x1d, 0x1b, 0x1b, 0x1c, 0x19, 0x17, 0x18, 0x13, 0x14, 0x12,
+    0x08, 0x06, 0x07, 0x0e, 0x10, 0x0c, 0x0e, 0x0c, 0x0b, 0x0c, 0x08, 0x08,
+    0x07, 0x04, 0x05, 0x06, 0x03, 0x05, 0x0c, 0x15, 0x17, 0x15, 0x18, 0x16,
+    0x18, 0x18, 0x14, 0x14, 0x13, 0x12, 0x13, 0x12, 0x0f, 0x10, 0x17, 0x1c,
+    0x1a, 0x19, 0x1c, 0x1b, 0x1e, 0x1d, 0x17, 0x17, 0x13, 0x12, 0x0f, 0x08,
+    0x03, 0x01, 0x07, 0x09, 0x06, 0x06, 0x05, 0x04, 0x05, 0x03, 0x00, 0x01,
+    0xfd, 0xfe, 0xfd, 0xf6, 0xf4, 0xf6, 0xfd, 0xfe, 0xf9, 0xfb, 0xf9, 0xfa,
+    0xfb, 0xf9, 0xf9, 0xf9, 0xf6, 0xf7, 0xf8, 0xf4, 0xf6, 0xfc, 0x06, 0x09,
+    0x07, 0x0c, 0x0a, 0x0b, 0x0c, 0x09, 0x0a, 0x0b, 0x08, 0x09, 0x09, 0x06,
+    0x09, 0x10, 0x18, 0x1a, 0x1a, 0x1f, 0x1f, 0x23, 0x24, 0x21, 0x22, 0x21,
+    0x21, 0x20, 0x1d, 0x19, 0x19, 0x1f, 0x23, 0x21, 0x1f, 0x1f, 0x1d, 0x1e,
+    0x1c, 0x19, 0x1b, 0x19, 0x19, 0x17, 0x0f, 0x0a, 0x09, 0x11, 0x13, 0x0f,
+    0x10, 0x0e, 0x0c, 0x0c, 0x09, 0x06, 0x05, 0x01, 0x02, 0x03, 0xfd, 0xff,
+    0x03, 0x0c, 0x0f, 0x0d, 0x10, 0x0e, 0x0f, 0x0f, 0x0c, 0x0c, 0x0b, 0x08,
+    0x09, 0x08, 0x03, 0x03, 0x08, 0x10, 0x11, 0x10, 0x14, 0x12, 0x13, 0x13,
+    0x0f, 0x0f, 0x0e, 0x0c, 0x0c, 0x09, 0x04, 0x03, 0x07, 0x0b, 0x09, 0x06,
+    0x07, 0x05, 0x07, 0x08, 0x05, 0x08, 0x07, 0x07, 0x05, 0x01, 0xfe, 0xff,
+    0x06, 0x0b, 0x09, 0x09, 0x0a, 0x08, 0x07, 0x05, 0x01, 0x02, 0x00, 0x02,
+    0x03, 0xff, 0xff, 0x03, 0x0b, 0x0e, 0x0b, 0x0d, 0x0e, 0x0e, 0x10, 0x0e,
+    0x0e, 0x0e, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x09, 0x11, 0x14, 0x14, 0x19,
+    0x18, 0x19, 0x19, 0x16, 0x17, 0x17, 0x14, 0x15, 0x14, 0x0f, 0x0e, 0x11,
+    0x14, 0x13, 0x0f, 0x10, 0x0d, 0x0f, 0x11, 0x0e, 0x10, 0x0f, 0x0d, 0x0c,
+    0x09, 0x04, 0x03, 0x08, 0x0c, 0x0c, 0x0b, 0x0c, 0x09, 0x0a, 0x09, 0x04,
+    0x04, 0x03, 0x04, 0x05, 0x03, 0x03, 0x06, 0x0f, 0x13, 0x12, 0x14, 0x15,
+    0x15, 0x16, 0x15, 0x13, 0x14, 0x11, 0x12, 0x11, 0x0b, 0x0b, 0x0f, 0x16,
+    0x18, 0x16, 0x17, 0x17, 0x17, 0x18, 0x16, 0x15, 0x14, 0x11, 0x10, 0x0e,
+    0x07, 0x05, 0x06, 0x09, 0x08, 0x05, 0x06, 0x04, 0x04, 0x04, 0x00, 0x02,
+    0x02, 0xff, 0xfe, 0xfd, 0xf9, 0xf9, 0xfd, 0x01, 0x00, 0xfe, 0xff, 0xfc,
+    0xfc, 0xfb, 0xf8, 0xfb, 0xfb, 0xfb, 0xfb, 0xf9, 0xf8, 0xfa, 0x01, 0x06,
+    0x06, 0x07, 0x0b, 0x0b, 0x0d, 0x0c, 0x09, 0x0a, 0x08, 0x08, 0x07, 0x04,
+    0x05, 0x08, 0x11, 0x15, 0x15, 0x17, 0x18, 0x18, 0x19, 0x19, 0x19, 0x1b,
+    0x1a, 0x1b, 0x1b, 0x15, 0x13, 0x13, 0x16, 0x16, 0x12, 0x14, 0x13, 0x15,
+    0x16, 0x14, 0x15, 0x13, 0x0f, 0x0e, 0x0c, 0x07, 0x06, 0x09, 0x0d, 0x0d,
+    0x0a, 0x0a, 0x07, 0x06, 0x05, 0x01, 0x02, 0x02, 0x01, 0x02, 0x01, 0xff,
+    0x01, 0x06, 0x0a, 0x0b, 0x0a, 0x0c, 0x0a, 0x0c, 0x0c, 0x09, 0x09, 0x07,
+    0x06, 0x05, 0x02, 0x01, 0x04, 0x0b, 0x0e, 0x0d, 0x0d, 0x0e, 0x0d, 0x0e,
+    0x0e, 0x0c, 0x0e, 0x0c, 0x0c, 0x0a, 0x05, 0x02, 0x02, 0x07, 0x08, 0x05,
+    0x06, 0x05, 0x05, 0x06, 0x05, 0x05, 0x06, 0x04, 0x05, 0x05, 0x00, 0x00,
+    0x03, 0x08, 0x09, 0x05, 0x06, 0x04, 0x03, 0x03, 0x00, 0x02, 0x03, 0x02,
+    0x03, 0x02, 0xff, 0x00, 0x04, 0x0a, 0x0b, 0x0b, 0x0d, 0x0c, 0x0d, 0x0c,
+    0x08, 0x08, 0x06, 0x05, 0x05, 0x04, 0x03, 0x06, 0x0c, 0x10, 0x0f, 0x0f,
+    0x10, 0x0f, 0x10, 0x10, 0x0e, 0x11, 0x10, 0x10, 0x0f, 0x0a, 0x08, 0x06,
+    0x0b, 0x0c, 0x0a, 0x0b, 0x0b, 0x0b, 0x0c, 0x0c, 0x0a, 0x0b, 0x09, 0x09,
+    0x09, 0x04, 0x03, 0x04, 0x09, 0x0a, 0x07, 0x07, 0x05, 0x05, 0x05, 0x04,
+    0x05, 0x06, 0x05, 0x07, 0x07, 0x04, 0x05, 0x09, 0x0f, 0x12, 0x10, 0x12,
+    0x11, 0x12, 0x12, 0x0f, 0x0f, 0x0f, 0x0d, 0x0e, 0x0d, 0x0a, 0x0c, 0x10,
+    0x13, 0x13, 0x12, 0x13, 0x12, 0x14, 0x14, 0x11, 0x11, 0x0f, 0x0d, 0x0b,
+    0x06, 0x02, 0x01, 0x05, 0x06, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x01,
+    0x03, 0x02, 0x02, 0x02, 0xff, 0xfc, 0xfc, 0x01, 0x01, 0xfe, 0xfd, 0xfb,
+    0xfa, 0xfb, 0xfb, 0xfc, 0xfd, 0xfc, 0xfd, 0xfd, 0xf9, 0xf9, 0xfd, 0x03,
+    0x06, 0x05, 0x08, 0x08, 0x07, 0x07, 0x04, 0x03, 0x03, 0x01, 0x03, 0x04,
+    0x03, 0x05, 0x0a, 0x0e, 0x0f, 0x0f, 0x11, 0x11, 0x13, 0x14, 0x13, 0x16,
+    0x15, 0x14, 0x13, 0x10, 0x0c, 0x0b, 0x0e, 0x11, 0x11, 0x11, 0x12, 0x10,
+    0x11, 0x11, 0x0f, 0x10, 0x0e, 0x0e, 0x0e, 0x0b, 0x09, 0x07, 0x0a, 0x0b,
+    0x08, 0x07, 0x06, 0x05, 0x06, 0x05, 0x04, 0x04, 0x02, 0x03, 0x03, 0x00,
+    0x00, 0x03, 0x0a, 0x0d, 0x0b, 0x0b, 0x0a, 0x09, 0x09, 0x07, 0x06, 0x06,
+    0x05, 0x06, 0x07, 0x03, 0x04, 0x06, 0x0a, 0x0b, 0x09, 0x0c, 0x0c, 0x0d,
+    0x0e, 0x0c, 0x0c, 0x0a, 0x07, 0x06, 0x04, 0x00, 0x00, 0x03, 0x06, 0x06,
+    0x04, 0x04, 0x02, 0x03, 0x03, 0x03, 0x05, 0x06, 0x06, 0x06, 0x04, 0x01,
+    0x00, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x00,
+    0x01, 0x01, 0xff, 0x00, 0x03, 0x09, 0x0c, 0x0a, 0x0a, 0x09, 0x07, 0x07,
+    0x06, 0x05, 0x05, 0x04, 0x06, 0x07, 0x03, 0x03, 0x05, 0x09, 0x0b, 0x0a,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x0e, 0x0d, 0x0c, 0x0a, 0x09, 0x08, 0x04, 0x04,
+    0x06, 0x0a, 0x0a, 0x08, 0x09, 0x06, 0x06, 0x07, 0x06, 0x09, 0x09, 0x08,
+    0x09, 0x07, 0x03, 0x02, 0x03, 0x04, 0x04, 0x03, 0x05, 0x04, 0x05, 0x06,
+    0x04, 0x04, 0x03, 0x03, 0x04, 0x03, 0x04, 0x06, 0x0b, 0x0f, 0x0f, 0x0e,
+    0x0e, 0x0d, 0x0d, 0x0d, 0x0b, 0x0c, 0x0b, 0x0c, 0x0c, 0x09, 0x07, 0x08,
+    0x0e, 0x10, 0x0f, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x0d, 0x0c, 0x09, 0x09,
+    0x08, 0x03, 0x02, 0x03, 0x05, 0x05, 0x02, 0x02, 0x01, 0x01, 0x02, 0x01,
+    0x03, 0x03, 0x02, 0x02, 0x00, 0xfc, 0xfb, 0xfc, 0xff, 0xff, 0xfe, 0xff,
+    0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfc, 0xfe, 0x02,
+    0x05, 0x05, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02,
+    0x00, 0xff, 0x01, 0x06, 0x09, 0x0a, 0x0b, 0x0d, 0x0d, 0x0e, 0x0e, 0x0c,
+    0x0c, 0x0a, 0x0b, 0x0b, 0x08, 0x08, 0x09, 0x0d, 0x0d, 0x0a, 0x0a, 0x09,
+    0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0b, 0x0b, 0x09, 0x05, 0x04, 0x04, 0x07,
+    0x08, 0x06, 0x07, 0x06, 0x05, 0x04, 0x02, 0x02, 0x01, 0x00, 0x02, 0x03,
+    0x02, 0x04, 0x06, 0x0a, 0x0a, 0x08, 0x08, 0x07, 0x08, 0x08, 0x06, 0x07,
+    0x05, 0x05, 0x05, 0x03, 0x01, 0x02, 0x07, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0a, 0x07, 0x07, 0x06, 0x06, 0x05, 0x03, 0x01, 0x01, 0x04, 0x04,
+    0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x03, 0x03, 0x03, 0xff,
+    0xff, 0x00, 0x04, 0x05, 0x04, 0x05, 0x03, 0x02, 0x02, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x02, 0x02, 0x04, 0x07, 0x07, 0x05, 0x06, 0x05, 0x06,
+    0x06, 0x05, 0x05, 0x03, 0x01, 0x01, 0x00, 0xff, 0x01, 0x05, 0x0a, 0x0b,
+    0x0a, 0x0b, 0x0a, 0x0a, 0x09, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x05,
+    0x05, 0x07, 0x07, 0x05, 0x05, 0x06, 0x06, 0x08, 0x09, 0x09, 0x0a, 0x08,
+    0x07, 0x05, 0x02, 0x01, 0x01, 0x05, 0x06, 0x05, 0x06, 0x05, 0x03, 0x03,
+    0x02, 0x02, 0x03, 0x03, 0x05, 0x06, 0x05, 0x06, 0x08, 0x0b, 0x0c, 0x0a,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0a, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x06, 0x07,
+    0x0b, 0x0e, 0x0f, 0x0e, 0x0f, 0x0e, 0x0e, 0x0d, 0x0b, 0x0b, 0x0a, 0x09,
+    0x08, 0x07, 0x04, 0x03, 0x04, 0x05, 0x03, 0x02, 0x04, 0x04, 0x05, 0x04,
+    0x03, 0x03, 0x02, 0x01, 0x00, 0xfe, 0xfd, 0xfd, 0x00, 0x01, 0x00, 0xff,
+    0xfe, 0xfc, 0xfb, 0xfb, 0xfb, 0xfd, 0xfd, 0xff, 0x00, 0xfe, 0xfd, 0xfe,
+    0x01, 0x03, 0x02, 0x03, 0x03, 0x04, 0x04, 0x03, 0x02, 0x01, 0xfe, 0xff,
+    0x00, 0xff, 0x02, 0x05, 0x0a, 0x0b, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x09,
+    0x0a, 0x0b, 0x0b, 0x0b, 0x09, 0x06, 0x06, 0x07, 0x09, 0x09, 0x09, 0x0a,
+    0x0a, 0x0b, 0x0b, 0x09, 0x09, 0x08, 0x07, 0x06, 0x05, 0x05, 0x05, 0x07,
+    0x08, 0x06, 0x04, 0x04, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x01, 0x00, 0x01, 0x05, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x05, 0x03,
+    0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x06, 0x09, 0x09, 0x07, 0x07, 0x07,
+    0x07, 0x08, 0x07, 0x07, 0x07, 0x04, 0x03, 0x01, 0xfe, 0xfd, 0xff, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x01, 0x01, 0x00, 0xff, 0x00, 0x04, 0x06, 0x07, 0x07, 0x07, 0x05,
+    0x04, 0x03, 0x01, 0x01, 0xff, 0x00, 0x01, 0x00, 0x01, 0x03, 0x06, 0x06,
+    0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x07, 0x04, 0x03, 0x02, 0xfe,
+    0xfe, 0xff, 0x03, 0x05, 0x04, 0x06, 0x05, 0x05, 0x05, 0x03, 0x03, 0x04,
+    0x04, 0x04, 0x04, 0x02, 0x02, 0x03, 0x00, 0x00};
+static const uint32_t cueBundleSize = 22148;
@@ -0,0 +1,80 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <stdint.h>
+
+// Layout of a cue bundle, generated by tools/asset_compiler.py: a header, the
+// index, then the samples of each cue at a CUE_BUNDLE_ALIGN aligned offset from
+// the start of the bundle (so render code can use word loads). Offsets and
+// lengths are in bytes, little endian.
+static const uint16_t CUE_BUNDLE_VERSION = 1;
+static const uint32_t CUE_BUNDLE_ALIGN = 4;
+
+enum CueFormat : uint8_t
+{
+    CueFormatS8 = 0,       // signed 8-bit mono PCM
+    CueFormatImaAdpcm = 1, // 4-bit IMA-ADPCM mono, in AdpcmSoundData blocks
+    CueFormatMp3 = 2,      // MPEG audio layer III stream, decoded on the device by Mp3Cache
+};
+
+typedef struct __attribute__((packed)) _CueBundleHeader
+{
+    char magic[4]; // "CUEB"
+    uint16_t version;
+    uint16_t count; // entries in the index following the header
+} CueBundleHeader;
+
+typedef struct __attribute__((packed)) _CueBundleEntry
+{
+    uint8_t id;     // I2cParam::Cue
+    uint8_t format; // CueFormat
+    uint16_t reserved;
+    uint32_t rate;   // sampling rate in Hz
+    uint32_t offset; // from the start of the bundle
+    uint32_t length; // in bytes
+} CueBundleEntry;
+
+static_assert(sizeof(CueBundleHeader) % CUE_BUNDLE_ALIGN == 0 && sizeof(CueBundleEntry) % CUE_BUNDLE_ALIGN == 0, "the index must keep the samples aligned");
+
+// every cue is stored for exactly one slot, checked against SoundBuffer and the decoders in SoundBuffer.h
+static const uint32_t CUE_SLOT_SAMPLES = 4410;       // SoundBuffer::SAMPLING_PER_SLOT
+static const uint32_t CUE_SAMPLE_RATE = 44100;       // SoundBuffer::SAMPLING_RATE
+static const uint32_t CUE_MIN_RATE = 8000;           // ResampledSoundData::MIN_RATE
+static const uint32_t CUE_RESAMPLER_MARGIN = 4;      // RESAMPLER_TAPS / 2, samples read past the slot
+static const uint32_t CUE_ADPCM_BLOCK_SAMPLES = 256; // AdpcmSoundData::BLOCK_SAMPLES
+static const uint32_t CUE_ADPCM_BLOCK_SIZE = 132;    // AdpcmSoundData::BLOCK_SIZE
+
+// bytes of a cue of format stored at rate, 0 if that is not a valid combination (or any length for MP3)
+static constexpr uint32_t cueSlotLength(uint8_t format, uint32_t rate)
+{
+    return (format == CueFormatS8 && rate == CUE_SAMPLE_RATE) ? CUE_SLOT_SAMPLES
+           : (format == CueFormatS8 && rate >= CUE_MIN_RATE && rate < CUE_SAMPLE_RATE)
+               ? (CUE_SLOT_SAMPLES * rate + CUE_SAMPLE_RATE - 1) / CUE_SAMPLE_RATE + CUE_RESAMPLER_MARGIN
+           : (format == CueFormatImaAdpcm && rate == CUE_SAMPLE_RATE)
+               ? (CUE_SLOT_SAMPLES + CUE_ADPCM_BLOCK_SAMPLES - 1) / CUE_ADPCM_BLOCK_SAMPLES * CUE_ADPCM_BLOCK_SIZE
+               : 0;
+}
+
+// true if the cue fills exactly one slot (an MP3 stream is cut to one slot when decoded)
+static constexpr bool cueFitsSlot(const CueBundleEntry &entry)
+{
+    return (entry.format == CueFormatMp3) ? (entry.rate == CUE_SAMPLE_RATE && entry.length > 0)
+                                          : (entry.length != 0 && entry.length == cueSlotLength(entry.format, entry.rate));
+}
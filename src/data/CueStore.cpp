@@ -0,0 +1,123 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "CueStore.h"
+#include "../ArduProf.h"
+
+#ifndef CUE_PARTITION_ONLY
+#include "./CueBundle.h"
+#endif
+
+const uint8_t *CueStore::_bundle = nullptr;
+uint32_t CueStore::_size = 0;
+spi_flash_mmap_handle_t CueStore::_mapHandle = 0;
+
+bool CueStore::begin(void)
+{
+    if (_bundle)
+    {
+        return true;
+    }
+
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, PARTITION_SUBTYPE, "cues");
+    if (partition)
+    {
+        const void *ptr = nullptr;
+        spi_flash_mmap_handle_t handle = 0;
+        esp_err_t err = esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &ptr, &handle);
+        if (err == ESP_OK && isValid((const uint8_t *)ptr, partition->size))
+        {
+            _bundle = (const uint8_t *)ptr;
+            _size = partition->size;
+            _mapHandle = handle;
+            LOG_TRACE("cue bundle mapped from partition at 0x", DebugLogBase::HEX, partition->address);
+            return true;
+        }
+        LOG_TRACE("no valid cue bundle in the partition, err=", err);
+        if (err == ESP_OK)
+        {
+            spi_flash_munmap(handle);
+        }
+    }
+
+#ifndef CUE_PARTITION_ONLY
+    configASSERT(isValid(cueBundleData, cueBundleSize));
+    _bundle = cueBundleData;
+    _size = cueBundleSize;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CueStore::end(void)
+{
+    if (_mapHandle)
+    {
+        spi_flash_munmap(_mapHandle);
+    }
+    _bundle = nullptr;
+    _size = 0;
+    _mapHandle = 0;
+}
+
+const CueBundleEntry *CueStore::find(uint8_t id)
+{
+    if (_bundle == nullptr)
+    {
+        return nullptr;
+    }
+
+    const CueBundleHeader *header = (const CueBundleHeader *)_bundle;
+    const CueBundleEntry *entry = (const CueBundleEntry *)(_bundle + sizeof(CueBundleHeader));
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        if (entry[i].id == id)
+        {
+            return &entry[i];
+        }
+    }
+    return nullptr;
+}
+
+// an erased or stale partition must not be played
+bool CueStore::isValid(const uint8_t *bundle, uint32_t size)
+{
+    const CueBundleHeader *header = (const CueBundleHeader *)bundle;
+    if (size < sizeof(CueBundleHeader) || memcmp(header->magic, "CUEB", sizeof(header->magic)) != 0 || header->version != CUE_BUNDLE_VERSION)
+    {
+        return false;
+    }
+
+    uint32_t indexEnd = sizeof(CueBundleHeader) + (uint32_t)header->count * sizeof(CueBundleEntry);
+    if (indexEnd > size)
+    {
+        return false;
+    }
+
+    const CueBundleEntry *entry = (const CueBundleEntry *)(bundle + sizeof(CueBundleHeader));
+    for (uint16_t i = 0; i < header->count; i++)
+    {
+        if (entry[i].offset % CUE_BUNDLE_ALIGN != 0 || entry[i].offset < indexEnd || entry[i].offset > size || entry[i].length > size - entry[i].offset)
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,59 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "./CueBundleDef.h"
+
+// Source of the built-in cues. The bundle made by tools/asset_compiler.py --bin
+// is read in place from the "cues" data partition (see partitions.csv), mapped
+// into the data address space, so cues can be reflashed without rebuilding the
+// firmware. Without a valid partition, the bundle linked from CueBundle.h is
+// used, unless CUE_PARTITION_ONLY is defined in LibDef.h.
+class CueStore
+{
+public:
+    static const esp_partition_subtype_t PARTITION_SUBTYPE = (esp_partition_subtype_t)0x40;
+
+    // maps the partition once, returns false if no bundle is available
+    static bool begin(void);
+    // unmaps the partition, the next begin() looks for it again; nothing read
+    // from a mapped bundle may be used afterwards
+    static void end(void);
+
+    // entry of cue id (I2cParam::Cue), nullptr if the bundle has none
+    static const CueBundleEntry *find(uint8_t id);
+    static const uint8_t *samples(const CueBundleEntry &entry)
+    {
+        return _bundle + entry.offset;
+    }
+
+    static bool isMapped(void)
+    {
+        return _mapHandle != 0;
+    }
+
+private:
+    static const uint8_t *_bundle;
+    static uint32_t _size;
+    static spi_flash_mmap_handle_t _mapHandle;
+
+    static bool isValid(const uint8_t *bundle, uint32_t size);
+};
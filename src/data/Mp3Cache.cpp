@@ -0,0 +1,266 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "Mp3Cache.h"
+#include "../ArduProf.h"
+
+#ifdef MP3_CUES
+#include <MP3DecoderHelix.h>
+using namespace libhelix;
+#endif
+
+Mp3Cache::SlabPool Mp3Cache::_slabPool;
+Mp3SoundData Mp3Cache::_cue[MAX_CUES];
+uint8_t Mp3Cache::_owner[SLAB_COUNT + 1];
+std::atomic<uint32_t> Mp3Cache::_pending(0);
+std::atomic<uint32_t> Mp3Cache::_failed(0);
+MessageQueue *Mp3Cache::_worker = nullptr;
+int16_t Mp3Cache::_event = 0;
+std::atomic<uint32_t> Mp3Cache::_prefetches(0);
+std::atomic<uint32_t> Mp3Cache::_hits(0);
+Mp3Cache::Stats Mp3Cache::_stats;
+
+int32_t Mp3SoundData::getData(int32_t pos, Frame &frame)
+{
+    const int8_t *data = Mp3Cache::slab(_handle.load(std::memory_order_acquire));
+    if (data == nullptr)
+    {
+        frame.channel1 = 0;
+        Mp3Cache::request(_id);
+    }
+    else if (pos >= 0 && pos < Mp3Cache::SLAB_SIZE)
+    {
+        frame.channel1 = SampleS8::toLevel(data[pos]);
+        _lastRead.store(xTaskGetTickCount(), std::memory_order_relaxed);
+    }
+    else
+    {
+        frame.channel1 = 0;
+    }
+    frame.channel2 = frame.channel1;
+    return 1;
+}
+
+bool Mp3Cache::setStream(uint8_t id, const uint8_t *stream, uint32_t size)
+{
+#ifdef MP3_CUES
+    if (id >= MAX_CUES || stream == nullptr || size == 0)
+    {
+        return false;
+    }
+    _cue[id]._stream = stream;
+    _cue[id]._size = size;
+    _cue[id]._id = id;
+    return true;
+#else
+    LOG_TRACE("no MP3 decoder, install arduino-libhelix");
+    return false;
+#endif
+}
+
+void Mp3Cache::prefetch(uint8_t id)
+{
+    if (id >= MAX_CUES || _cue[id]._stream == nullptr)
+    {
+        return;
+    }
+    _prefetches.fetch_add(1, std::memory_order_relaxed);
+    if (_cue[id]._handle.load(std::memory_order_relaxed) != SlabPool::InvalidHandle)
+    {
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        // not to be evicted before it is played
+        _cue[id]._lastRead.store(xTaskGetTickCount(), std::memory_order_relaxed);
+        return;
+    }
+    request(id);
+}
+
+void Mp3Cache::request(uint8_t id)
+{
+    uint32_t bit = 1UL << id;
+    if (_failed.load(std::memory_order_relaxed) & bit)
+    {
+        return;
+    }
+    // one message per cue until it is decoded
+    if ((_pending.fetch_or(bit, std::memory_order_release) & bit) == 0 && _worker)
+    {
+        _worker->postEvent(_event);
+    }
+}
+
+void Mp3Cache::decodePending(void)
+{
+    uint32_t pending;
+    while ((pending = _pending.load(std::memory_order_acquire)) != 0)
+    {
+        uint8_t id = __builtin_ctz(pending);
+        Mp3SoundData &cue = _cue[id];
+        if (cue._handle.load(std::memory_order_relaxed) == SlabPool::InvalidHandle)
+        {
+            SlabPool::Handle handle = allocSlab();
+            if (handle == SlabPool::InvalidHandle)
+            {
+                // every slab is being played, stays pending until the next call
+                return;
+            }
+
+            uint32_t frames = 0;
+            uint32_t startUs = micros();
+            bool isDecoded = decode(cue, reinterpret_cast<int8_t *>(_slabPool.data(handle)), frames);
+            uint32_t elapsedUs = micros() - startUs;
+            _stats.decodes++;
+            _stats.frames += frames;
+            _stats.decodeUs += elapsedUs;
+            _stats.maxCueUs = std::max(_stats.maxCueUs, elapsedUs);
+
+            if (isDecoded)
+            {
+                _owner[handle] = id;
+                cue._lastRead.store(xTaskGetTickCount(), std::memory_order_relaxed);
+                cue._handle.store(handle, std::memory_order_release);
+                LOG_TRACE("MP3 cue ", id, ": ", frames, " frames in ", elapsedUs, " us, ", _hits.load(std::memory_order_relaxed), "/", _prefetches.load(std::memory_order_relaxed), " hits");
+            }
+            else
+            {
+                _slabPool.release(handle);
+                _failed.fetch_or(1UL << id, std::memory_order_relaxed);
+                LOG_TRACE("cannot decode MP3 cue ", id);
+            }
+        }
+        _pending.fetch_and(~(1UL << id), std::memory_order_relaxed);
+    }
+}
+
+Mp3Cache::Stats Mp3Cache::stats(void)
+{
+    Stats stats = _stats;
+    stats.prefetches = _prefetches.load(std::memory_order_relaxed);
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// a free slab, or the slab of the least recently played cue if idle for EVICT_IDLE_MS
+Mp3Cache::SlabPool::Handle Mp3Cache::allocSlab(void)
+{
+    SlabPool::Handle handle = _slabPool.alloc();
+    if (handle != SlabPool::InvalidHandle)
+    {
+        return handle;
+    }
+
+    uint32_t now = xTaskGetTickCount();
+    uint32_t idle = pdMS_TO_TICKS(EVICT_IDLE_MS);
+    for (SlabPool::Handle h = 1; h <= SLAB_COUNT; h++)
+    {
+        uint32_t cueIdle = now - _cue[_owner[h]]._lastRead.load(std::memory_order_relaxed);
+        if (cueIdle >= idle)
+        {
+            idle = cueIdle;
+            handle = h;
+        }
+    }
+    if (handle != SlabPool::InvalidHandle)
+    {
+        _cue[_owner[handle]]._handle.store(SlabPool::InvalidHandle, std::memory_order_release);
+        _owner[handle] = I2cParam::CueNone;
+        _stats.evictions++;
+        vTaskDelay(pdMS_TO_TICKS(GRACE_MS));
+    }
+    return handle;
+}
+
+#ifdef MP3_CUES
+// cue being decoded, filled by onPcm()
+static struct
+{
+    int8_t *slab;
+    int32_t length;  // samples after the leading silence
+    int32_t peak;
+    uint32_t frames; // MP3 frames
+    bool isValid;    // 44.1kHz mono or stereo
+} decoding;
+
+static void onPcm(MP3FrameInfo &info, short *pcm, size_t len, void *ref)
+{
+    decoding.frames++;
+    if (info.samprate != (int)Mp3Cache::SAMPLE_RATE || info.nChans < 1 || info.nChans > 2)
+    {
+        decoding.isValid = false;
+        return;
+    }
+
+    for (size_t i = 0; i + info.nChans <= len; i += info.nChans)
+    {
+        int32_t value = (info.nChans == 2) ? (pcm[i] + pcm[i + 1]) >> 9 : pcm[i] >> 8;
+        if (decoding.length == 0 && abs(value) < Mp3Cache::TRIM_THRESHOLD)
+        {
+            continue;
+        }
+        if (decoding.length < Mp3Cache::SLAB_SIZE)
+        {
+            decoding.slab[decoding.length] = (int8_t)value;
+        }
+        decoding.length++;
+        decoding.peak = std::max(decoding.peak, abs(value));
+    }
+}
+
+static MP3DecoderHelix decoder(onPcm);
+#endif
+
+// the whole cue at once, into one slot of 8-bit PCM
+bool Mp3Cache::decode(const Mp3SoundData &cue, int8_t *slab, uint32_t &frames)
+{
+#ifdef MP3_CUES
+    decoding.slab = slab;
+    decoding.length = 0;
+    decoding.peak = 1;
+    decoding.frames = 0;
+    decoding.isValid = true;
+
+    // the decoder buffers are allocated for the decode only
+    decoder.begin();
+    decoder.write(cue._stream, cue._size);
+    decoder.end();
+    frames = decoding.frames;
+    if (!decoding.isValid || decoding.length == 0)
+    {
+        return false;
+    }
+
+    int32_t length = std::min<int32_t>(decoding.length, SLAB_SIZE);
+    for (int32_t i = 0; i < length; i++)
+    {
+        int32_t value = slab[i] * 127;
+        slab[i] = (int8_t)((value + (value < 0 ? -decoding.peak : decoding.peak) / 2) / decoding.peak);
+    }
+    if (decoding.length > SLAB_SIZE)
+    {
+        for (int32_t i = 0; i < FADE_LENGTH; i++)
+        {
+            slab[SLAB_SIZE - 1 - i] = slab[SLAB_SIZE - 1 - i] * i / FADE_LENGTH;
+        }
+    }
+    memset(slab + length, 0, SLAB_SIZE - length);
+    return true;
+#else
+    return false;
+#endif
+}
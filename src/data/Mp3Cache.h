@@ -0,0 +1,135 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+#include "../base/type/BlockPool.h"
+#include "./SampleFormat.h"
+#include "../peripheral/i2c/I2cParam.h"
+
+// the MP3 cues need the "arduino-libhelix" library (https://github.com/pschatzmann/arduino-libhelix)
+#if __has_include(<MP3DecoderHelix.h>)
+#define MP3_CUES
+#endif
+
+class MessageQueue;
+
+// Built-in cue stored as an MP3 stream (CueFormatMp3). It plays the PCM decoded
+// into a slab of Mp3Cache, or silence (and asks for it to be decoded) while it
+// is not cached. The slab handle is published in one word, like AssetSoundData.
+class Mp3SoundData : public OneChannel8BitSoundData
+{
+public:
+    Mp3SoundData() : OneChannel8BitSoundData(true), _stream(nullptr), _size(0), _id(0), _handle(0), _lastRead(0) {}
+
+    virtual int32_t getData(int32_t pos, Frame &frame);
+
+private:
+    friend class Mp3Cache;
+
+    const uint8_t *_stream; // in the cue bundle
+    uint32_t _size;
+    uint8_t _id;
+    std::atomic<uint8_t> _handle;    // slab of Mp3Cache, InvalidHandle while not cached
+    std::atomic<uint32_t> _lastRead; // tick of the last read, for the LRU eviction
+};
+
+// Decode-ahead cache of the MP3 cues. A cue is decoded as a whole (one slot,
+// a handful of MP3 frames) into a slab as soon as it is referenced, by the low
+// priority worker thread, and stays there until its slab is needed by another
+// cue. The slabs are a fixed budget smaller than all the cues: the least
+// recently played cue is evicted, provided it has not been played for
+// EVICT_IDLE_MS; with more cues in use than slabs, a cue stays silent until a
+// slab gets idle. The decoded PCM is trimmed, normalised and cut to one slot
+// as tools/asset_compiler.py does for the 8-bit cues.
+// setStream() is for init, decodePending() for the worker; the rest is lock-free.
+class Mp3Cache
+{
+public:
+    static const uint8_t MAX_CUES = I2cParam::CueCount;
+    static const uint8_t SLAB_COUNT = 3;
+    static const uint16_t SLAB_SIZE = 4410; // SoundBuffer::SAMPLING_PER_SLOT
+    static const uint32_t SAMPLE_RATE = 44100;
+    static const uint32_t EVICT_IDLE_MS = 200;
+    static const int32_t TRIM_THRESHOLD = 2; // leading samples below are dropped, as by tools/asset_compiler.py
+
+    typedef BlockPool<SLAB_SIZE, SLAB_COUNT> SlabPool;
+    static_assert(MAX_CUES <= 32, "one bit per cue in _pending");
+
+    typedef struct _Stats
+    {
+        uint32_t prefetches; // references of an MP3 cue
+        uint32_t hits;       // references of a cue already cached
+        uint32_t decodes;
+        uint32_t evictions;
+        uint32_t frames;   // MP3 frames decoded
+        uint32_t decodeUs; // total decode time
+        uint32_t maxCueUs; // longest decode of one cue
+    } Stats;
+
+    // worker (e.g. ThreadApp) to post event to when a cue is to be decoded
+    static void begin(MessageQueue *worker, int16_t event)
+    {
+        _worker = worker;
+        _event = event;
+    }
+
+    // false if MP3 is not supported by this build
+    static bool setStream(uint8_t id, const uint8_t *stream, uint32_t size);
+
+    // stable pointer, nullptr unless id has a stream
+    static OneChannel8BitSoundData *soundData(uint8_t id)
+    {
+        return (id < MAX_CUES && _cue[id]._stream) ? &_cue[id] : nullptr;
+    }
+
+    // decode ahead: called when cue id is referenced, ignored if it is not an MP3 cue
+    static void prefetch(uint8_t id);
+    // asks the worker to decode cue id
+    static void request(uint8_t id);
+    // decodes the requested cues, on the worker
+    static void decodePending(void);
+
+    static Stats stats(void);
+
+    static const int8_t *slab(uint8_t handle)
+    {
+        return reinterpret_cast<const int8_t *>(_slabPool.data(handle));
+    }
+
+private:
+    static const int32_t FADE_LENGTH = 88; // fade out of a cue cut to one slot, 2ms
+    static const uint32_t GRACE_MS = 10;     // for a read of an evicted slab to complete
+
+    static SlabPool _slabPool;
+    static Mp3SoundData _cue[MAX_CUES];
+    static uint8_t _owner[SLAB_COUNT + 1];  // cue in each slab (by handle), CueNone if free
+    static std::atomic<uint32_t> _pending; // bit per cue to decode
+    static std::atomic<uint32_t> _failed;  // bit per cue which could not be decoded
+    static MessageQueue *_worker;
+    static int16_t _event;
+    static std::atomic<uint32_t> _prefetches;
+    static std::atomic<uint32_t> _hits;
+    static Stats _stats; // decode part, worker only
+
+    static SlabPool::Handle allocSlab(void);
+    static bool decode(const Mp3SoundData &cue, int8_t *slab, uint32_t &frames);
+};
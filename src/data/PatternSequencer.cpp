@@ -0,0 +1,238 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "PatternSequencer.h"
+#include "../ArduProf.h"
+
+PatternSequencer::PatternSequencer(CueResolver resolve) : _playing(&_list[1]),
+                                                          _spare(0),
+                                                          _cursor(0),
+                                                          _offset(0),
+                                                          _position(0),
+                                                          _isMuted(false),
+                                                          _resolve(resolve)
+{
+    memset(_list, 0, sizeof(_list));
+    memset(_pattern, 0, sizeof(_pattern));
+}
+
+int32_t PatternSequencer::eventCount(const I2cParam::PatternStep *step, uint8_t stepCount)
+{
+    if (stepCount == 0 || stepCount > I2cParam::MAX_PATTERN_STEPS)
+    {
+        return 0;
+    }
+
+    int32_t count = 0;
+    bool isRest = false; // the last event is a rest, the next rest is merged into it
+    for (uint8_t i = 0; i < stepCount; i++)
+    {
+        const I2cParam::PatternStep &s = step[i];
+        if (!I2cParam::isCueValid(s.cue) || s.gain > I2cParam::MAX_GAIN || s.duration == 0 || s.repeat == 0)
+        {
+            return 0;
+        }
+
+        if (s.cue == I2cParam::CueNone)
+        {
+            count += isRest ? 0 : 1;
+            isRest = true;
+        }
+        else
+        {
+            bool hasRest = (s.duration * TICK_FRAMES > CUE_FRAMES);
+            count += s.repeat * (hasRest ? 2 : 1);
+            isRest = hasRest;
+        }
+    }
+    return (count <= MAX_EVENTS) ? count : 0;
+}
+
+bool PatternSequencer::define(const I2cParam::Pattern &pattern)
+{
+    if (pattern.id >= I2cParam::MAX_PATTERNS || eventCount(pattern.step, pattern.stepCount) == 0)
+    {
+        return false;
+    }
+    _pattern[pattern.id] = pattern;
+    return true;
+}
+
+bool PatternSequencer::compile(uint8_t id)
+{
+    if (id >= I2cParam::MAX_PATTERNS || _pattern[id].stepCount == 0)
+    {
+        LOG_TRACE("pattern ", id, " not defined");
+        return false;
+    }
+    return compile(_pattern[id].step, _pattern[id].stepCount);
+}
+
+bool PatternSequencer::compile(const I2cParam::PatternStep *step, uint8_t stepCount)
+{
+    if (eventCount(step, stepCount) == 0)
+    {
+        return false;
+    }
+
+    EventList &list = _list[_spare];
+    list.eventCount = 0;
+    list.length = 0;
+    for (uint8_t i = 0; i < stepCount; i++)
+    {
+        const I2cParam::PatternStep &s = step[i];
+        uint32_t duration = s.duration * TICK_FRAMES;
+        const int8_t *pcm = nullptr;
+        // a cue without sound data plays as a rest, like an empty slot
+        OneChannel8BitSoundData *data = (s.cue == I2cParam::CueNone) ? nullptr : _resolve(s.cue, &pcm);
+        for (uint8_t r = 0; r < s.repeat; r++)
+        {
+            uint32_t length = data ? std::min<uint32_t>(duration, CUE_FRAMES) : 0;
+            append(list, length, data, pcm, s.gain, i);
+            append(list, duration - length, nullptr, nullptr, 0, i);
+        }
+    }
+    return true;
+}
+
+void PatternSequencer::append(EventList &list, uint32_t length, OneChannel8BitSoundData *data, const int8_t *pcm, uint8_t gain, uint8_t step)
+{
+    if (length == 0)
+    {
+        return;
+    }
+
+    if (data == nullptr && list.eventCount > 0 && list.event[list.eventCount - 1].data == nullptr)
+    {
+        list.event[list.eventCount - 1].length += length;
+    }
+    else
+    {
+        configASSERT(list.eventCount < MAX_EVENTS); // bounded by eventCount()
+        Event &event = list.event[list.eventCount++];
+        event.start = list.length;
+        event.length = length;
+        event.data = data;
+        event.pcm = pcm;
+        event.gain = data ? gain : 0;
+        event.step = step;
+    }
+    list.length += length;
+}
+
+void PatternSequencer::commit(void)
+{
+    uint32_t position = _position;
+    _playing = &_list[_spare];
+    _spare ^= 1;
+    _isMuted = false;
+
+    _cursor = 0;
+    _offset = 0;
+    _position = 0;
+    seek(position); // stays at the start if the new cycle is shorter
+}
+
+bool PatternSequencer::seek(uint32_t frame)
+{
+    if (frame >= _playing->length)
+    {
+        return false;
+    }
+    if (frame == _position)
+    {
+        return true;
+    }
+
+    // last event starting at or before frame
+    int32_t low = 0;
+    int32_t high = _playing->eventCount - 1;
+    while (low < high)
+    {
+        int32_t mid = (low + high + 1) / 2;
+        if (_playing->event[mid].start <= frame)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1;
+        }
+    }
+    _cursor = low;
+    _offset = frame - _playing->event[low].start;
+    _position = frame;
+    return true;
+}
+
+int32_t PatternSequencer::render(SampleS16::Sample *mono, int32_t count)
+{
+    const Event &event = _playing->event[_cursor];
+    count = std::min<int32_t>(count, event.length - _offset);
+
+    if (event.data == nullptr || _isMuted)
+    {
+        memset(mono, 0, count * sizeof(*mono));
+    }
+    else if (event.pcm && event.gain == I2cParam::MAX_GAIN)
+    {
+        // the event lies within the slot of samples: no bounds check, no virtual call
+        const int8_t *pcm = event.pcm + _offset;
+        for (int32_t i = 0; i < count; i++)
+        {
+            mono[i] = SampleS8::toLevel(pcm[i]);
+        }
+    }
+    else if (event.pcm)
+    {
+        const int8_t *pcm = event.pcm + _offset;
+        for (int32_t i = 0; i < count; i++)
+        {
+            mono[i] = SampleS8::toLevel(pcm[i]) * event.gain / I2cParam::MAX_GAIN;
+        }
+    }
+    else
+    {
+        for (int32_t i = 0; i < count; i++)
+        {
+            Frame sample;
+            bool isRead = event.data->getData(_offset + i, sample);
+            configASSERT(isRead); // every cue fills one slot
+            int32_t level = SampleFrame::toLevel(sample);
+            if (event.gain != I2cParam::MAX_GAIN)
+            {
+                level = level * event.gain / I2cParam::MAX_GAIN;
+            }
+            mono[i] = level;
+        }
+    }
+
+    _offset += count;
+    _position += count;
+    if (_offset == event.length)
+    {
+        _offset = 0;
+        if (++_cursor == _playing->eventCount)
+        {
+            _cursor = 0;
+            _position = 0;
+        }
+    }
+    return count;
+}
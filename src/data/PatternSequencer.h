@@ -0,0 +1,126 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+#include "../peripheral/i2c/I2cParam.h"
+#include "./SampleFormat.h"
+
+// Plays a pattern of steps (cue, gain, duration, repeat, see I2cParam::PatternStep).
+// A pattern is compiled once, whenever it changes, into a flat list of events
+// sorted by their first frame in the cycle: repeats are unrolled, a cue is cut
+// to its step or followed by a rest, and adjacent rests are merged. The render
+// callback walks the list with a cursor which wraps at the end of the cycle, so
+// a cycle lasts exactly its length whatever the A2DP block size, and costs one
+// loop per event without any per-frame slot arithmetic.
+// Two lists are kept: compile() fills the spare one while the other one plays,
+// commit() swaps them. define()/compile()/commit() must be called from one task,
+// commit() and the render side (render()/mute()) under the caller's lock.
+class PatternSequencer
+{
+public:
+    static const int32_t SAMPLING_RATE = 44100;
+    static const int32_t CUE_FRAMES = 4410; // SoundBuffer::SAMPLING_PER_SLOT
+    static const int32_t TICK_FRAMES = SAMPLING_RATE * I2cParam::PATTERN_TICK / 1000;
+    static const int32_t MAX_EVENTS = 48;
+
+    typedef struct _Event
+    {
+        uint32_t start;                // first frame of the event in the cycle
+        uint32_t length;               // in frames, at most CUE_FRAMES unless data is nullptr
+        OneChannel8BitSoundData *data; // nullptr = rest
+        const int8_t *pcm;             // samples of data if it is one slot of 8-bit PCM, read without getData()
+        uint8_t gain;
+        uint8_t step; // of the pattern
+    } Event;
+
+    // sound data of a cue and, if it is one slot of 8-bit PCM, its samples
+    typedef OneChannel8BitSoundData *(*CueResolver)(uint8_t cue, const int8_t **pcm);
+
+    PatternSequencer(CueResolver resolve);
+
+    // number of events the steps compile to, 0 if a step is invalid or there are more than MAX_EVENTS
+    static int32_t eventCount(const I2cParam::PatternStep *step, uint8_t stepCount);
+
+    // stores pattern.id for compile(id); the playing pattern is not affected
+    bool define(const I2cParam::Pattern &pattern);
+
+    // compiles the steps (or the stored pattern id) into the spare list, returns false if invalid
+    bool compile(const I2cParam::PatternStep *step, uint8_t stepCount);
+    bool compile(uint8_t id);
+
+    // plays the compiled list, from the current position in the cycle if it is long enough
+    void commit(void);
+
+    // plays rests instead of the events until the next commit, keeping the cycle length
+    void mute(void)
+    {
+        _isMuted = true;
+    }
+
+    // frames in one cycle
+    uint32_t length(void) const
+    {
+        return _playing->length;
+    }
+
+    // position of the cursor in the cycle, 0 after the last event of the cycle
+    uint32_t position(void) const
+    {
+        return _position;
+    }
+
+    // step of the event at the cursor
+    uint8_t step(void) const
+    {
+        return _playing->event[_cursor].step;
+    }
+
+    // renders up to count frames of the event at the cursor into mono and moves the
+    // cursor on, back to the start of the cycle after the last event; returns the
+    // number of frames rendered (> 0)
+    int32_t render(SampleS16::Sample *mono, int32_t count);
+
+private:
+    typedef struct _EventList
+    {
+        Event event[MAX_EVENTS];
+        int32_t eventCount;
+        uint32_t length; // in frames
+    } EventList;
+
+    EventList _list[2];
+    EventList *_playing;
+    uint8_t _spare; // index of the list compile() fills
+
+    // cursor, only used by the render side
+    int32_t _cursor;    // event
+    uint32_t _offset;   // frame in the event
+    uint32_t _position; // frame in the cycle
+    bool _isMuted;
+
+    I2cParam::Pattern _pattern[I2cParam::MAX_PATTERNS]; // stepCount 0 = not defined
+    const CueResolver _resolve;
+
+    static void append(EventList &list, uint32_t length, OneChannel8BitSoundData *data, const int8_t *pcm, uint8_t gain, uint8_t step);
+
+    // moves the cursor to frame of the cycle, returns false if the cycle is shorter
+    bool seek(uint32_t frame);
+};
@@ -0,0 +1,71 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "ResampledSoundData.h"
+#include "./ResamplerTable.h"
+#include "./CueBundleDef.h"
+
+static_assert((RESAMPLER_PHASES & (RESAMPLER_PHASES - 1)) == 0, "RESAMPLER_PHASES must be a power of 2");
+static_assert(RESAMPLER_TAPS / 2 == CUE_RESAMPLER_MARGIN, "cueSlotLength() out of date");
+
+// number of fraction bits selecting the phase
+static const int32_t PHASE_BITS = __builtin_ctz(RESAMPLER_PHASES);
+
+void ResampledSoundData::setSamples(const int8_t *samples, int32_t length, uint32_t rate)
+{
+    configASSERT(isRateSupported(rate));
+    _samples = samples;
+    _length = length;
+    _step = ((uint64_t)rate << 32) / OUTPUT_RATE;
+}
+
+int32_t ResampledSoundData::getData(int32_t pos, Frame &frame)
+{
+    // rounded to the nearest phase, which may carry into the integer part
+    uint64_t x = (uint64_t)pos * _step + (1ULL << (31 - PHASE_BITS));
+    int32_t first = (int32_t)(x >> 32) - (RESAMPLER_TAPS / 2 - 1);
+    const int16_t *coef = resamplerTable[(uint32_t)x >> (32 - PHASE_BITS)];
+
+    int32_t acc = 0;
+    if (first >= 0 && first + RESAMPLER_TAPS <= _length)
+    {
+        const int8_t *sample = _samples + first;
+        for (int32_t k = 0; k < RESAMPLER_TAPS; k++)
+        {
+            acc += sample[k] * coef[k];
+        }
+    }
+    else
+    {
+        // edges of the cue: missing samples are silence
+        for (int32_t k = 0; k < RESAMPLER_TAPS; k++)
+        {
+            int32_t n = first + k;
+            if (n >= 0 && n < _length)
+            {
+                acc += _samples[n] * coef[k];
+            }
+        }
+    }
+
+    int32_t value = (acc * 127 + (1 << 14)) >> 15;
+    frame.channel1 = std::min<int32_t>(INT16_MAX, std::max<int32_t>(INT16_MIN, value));
+    frame.channel2 = frame.channel1;
+    return 1;
+}
@@ -0,0 +1,51 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+
+// 8-bit cue stored at a lower sampling rate (e.g. 8, 11.025, 16 or 22.05 kHz),
+// upsampled to OUTPUT_RATE on the fly with the polyphase Q15 filter of
+// ResamplerTable.h (tools/resampler_table.py). The input position of a frame is
+// computed from the frame position in 32.32 fixed point, so any frame can be
+// read without state, in any order. Same output scale as OneChannel8BitSoundData.
+class ResampledSoundData : public OneChannel8BitSoundData
+{
+public:
+    static const uint32_t OUTPUT_RATE = 44100;
+    static const uint32_t MIN_RATE = 8000;
+
+    ResampledSoundData() : OneChannel8BitSoundData(true), _samples(nullptr), _length(0), _step(0) {}
+
+    static bool isRateSupported(uint32_t rate)
+    {
+        return rate >= MIN_RATE && rate <= OUTPUT_RATE;
+    }
+
+    // samples at rate, silence outside of [0, length)
+    void setSamples(const int8_t *samples, int32_t length, uint32_t rate);
+
+    virtual int32_t getData(int32_t pos, Frame &frame);
+
+private:
+    const int8_t *_samples;
+    int32_t _length;
+    uint64_t _step; // input samples per output frame, 32.32 fixed point
+};
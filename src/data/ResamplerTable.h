@@ -0,0 +1,93 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <stdint.h>
+
+// generated by tools/resampler_table.py, do not edit
+// Blackman windowed sinc, cutoff 0.45 cycles per input sample, Q15
+
+static const int32_t RESAMPLER_PHASES = 64;
+static const int32_t RESAMPLER_TAPS = 8;
+
+static const int16_t resamplerTable[RESAMPLER_PHASES][RESAMPLER_TAPS] = {
+    {187, -1042, 2493, 29492, 2493, -1042, 187, 0},
+    {173, -953, 2102, 29480, 2898, -1133, 201, 0},
+    {160, -865, 1723, 29446, 3315, -1226, 215, 0},
+    {148, -780, 1358, 29389, 3745, -1321, 229, 0},
+    {135, -697, 1006, 29310, 4187, -1416, 244, -1},
+    {124, -616, 668, 29207, 4640, -1513, 259, -1},
+    {112, -538, 344, 29082, 5105, -1610, 274, -1},
+    {101, -463, 34, 28936, 5581, -1708, 289, -2},
+    {91, -390, -263, 28767, 6067, -1806, 304, -2},
+    {81, -320, -545, 28577, 6563, -1905, 320, -3},
+    {72, -252, -813, 28364, 7069, -2003, 335, -4},
+    {63, -188, -1067, 28132, 7583, -2101, 350, -4},
+    {55, -126, -1307, 27876, 8107, -2197, 365, -5},
+    {47, -68, -1534, 27604, 8638, -2293, 380, -6},
+    {39, -12, -1746, 27312, 9176, -2388, 394, -7},
+    {33, 41, -1945, 26998, 9721, -2480, 408, -8},
+    {26, 90, -2130, 26668, 10272, -2571, 422, -9},
+    {20, 137, -2302, 26319, 10828, -2659, 435, -10},
+    {15, 181, -2461, 25951, 11390, -2744, 447, -11},
+    {10, 222, -2606, 25567, 11955, -2827, 459, -12},
+    {5, 260, -2739, 25166, 12524, -2905, 470, -13},
+    {1, 295, -2859, 24750, 13095, -2980, 480, -14},
+    {-2, 327, -2967, 24318, 13668, -3051, 490, -15},
+    {-6, 356, -3063, 23874, 14242, -3117, 498, -16},
+    {-9, 383, -3147, 23414, 14817, -3178, 505, -17},
+    {-11, 407, -3220, 22942, 15391, -3233, 510, -18},
+    {-13, 429, -3281, 22455, 15964, -3283, 515, -18},
+    {-15, 448, -3332, 21959, 16535, -3326, 518, -19},
+    {-17, 464, -3372, 21454, 17103, -3363, 519, -20},
+    {-18, 478, -3403, 20937, 17668, -3393, 519, -20},
+    {-19, 490, -3423, 20410, 18228, -3415, 517, -20},
+    {-19, 500, -3434, 19874, 18784, -3430, 513, -20},
+    {-20, 508, -3436, 19333, 19331, -3436, 508, -20},
+    {-20, 513, -3430, 18784, 19874, -3434, 500, -19},
+    {-20, 517, -3415, 18228, 20410, -3423, 490, -19},
+    {-20, 519, -3393, 17668, 20937, -3403, 478, -18},
+    {-20, 519, -3363, 17103, 21454, -3372, 464, -17},
+    {-19, 518, -3326, 16535, 21959, -3332, 448, -15},
+    {-18, 515, -3283, 15964, 22455, -3281, 429, -13},
+    {-18, 510, -3233, 15391, 22942, -3220, 407, -11},
+    {-17, 505, -3178, 14817, 23414, -3147, 383, -9},
+    {-16, 498, -3117, 14242, 23874, -3063, 356, -6},
+    {-15, 490, -3051, 13668, 24318, -2967, 327, -2},
+    {-14, 480, -2980, 13095, 24750, -2859, 295, 1},
+    {-13, 470, -2905, 12524, 25166, -2739, 260, 5},
+    {-12, 459, -2827, 11955, 25567, -2606, 222, 10},
+    {-11, 447, -2744, 11390, 25951, -2461, 181, 15},
+    {-10, 435, -2659, 10828, 26319, -2302, 137, 20},
+    {-9, 422, -2571, 10272, 26668, -2130, 90, 26},
+    {-8, 408, -2480, 9721, 26998, -1945, 41, 33},
+    {-7, 394, -2388, 9176, 27312, -1746, -12, 39},
+    {-6, 380, -2293, 8638, 27604, -1534, -68, 47},
+    {-5, 365, -2197, 8107, 27876, -1307, -126, 55},
+    {-4, 350, -2101, 7583, 28132, -1067, -188, 63},
+    {-4, 335, -2003, 7069, 28364, -813, -252, 72},
+    {-3, 320, -1905, 6563, 28577, -545, -320, 81},
+    {-2, 304, -1806, 6067, 28767, -263, -390, 91},
+    {-2, 289, -1708, 5581, 28936, 34, -463, 101},
+    {-1, 274, -1610, 5105, 29082, 344, -538, 112},
+    {-1, 259, -1513, 4640, 29207, 668, -616, 124},
+    {-1, 244, -1416, 4187, 29310, 1006, -697, 135},
+    {0, 229, -1321, 3745, 29389, 1358, -780, 148},
+    {0, 215, -1226, 3315, 29446, 1723, -865, 160},
+    {0, 201, -1133, 2898, 29480, 2102, -953, 173}};
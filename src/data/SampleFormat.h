@@ -0,0 +1,102 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+
+// Sample formats of the render path. The cues are mono, so they are stored,
+// rendered and mixed on the narrowest format which holds them, and widened to
+// the stereo Frame of the A2DP buffer only once, at the end of the render.
+// Every format has the same traits:
+//   Sample       storage of one sample (all channels)
+//   CHANNELS     channels stored per sample
+//   toLevel()    mono level on the output scale (a channel of Frame)
+//   fromLevel()  sample of a level, saturating
+// convertSamples<From, To>() converts between any two of them.
+
+// signed 8-bit mono, storage of the cues; level = sample * 127 as OneChannel8BitSoundData
+struct SampleS8
+{
+    typedef int8_t Sample;
+    static const uint8_t CHANNELS = 1;
+
+    static int32_t toLevel(Sample sample)
+    {
+        return sample * 127;
+    }
+    static Sample fromLevel(int32_t level)
+    {
+        level = (level + (level < 0 ? -63 : 63)) / 127;
+        return (Sample)std::min<int32_t>(INT8_MAX, std::max<int32_t>(INT8_MIN, level));
+    }
+};
+
+// signed 16-bit mono, the render buffer of SoundBuffer
+struct SampleS16
+{
+    typedef int16_t Sample;
+    static const uint8_t CHANNELS = 1;
+
+    static int32_t toLevel(Sample sample)
+    {
+        return sample;
+    }
+    static Sample fromLevel(int32_t level)
+    {
+        return (Sample)std::min<int32_t>(INT16_MAX, std::max<int32_t>(INT16_MIN, level));
+    }
+};
+
+// Q15 mono, signals in [-1, 1) of the synthesised cues; full scale maps to the full output scale
+struct SampleQ15 : public SampleS16
+{
+    static const int32_t ONE = 32768;
+
+    static int32_t mul(int32_t a, int32_t b)
+    {
+        return (a * b) >> 15;
+    }
+};
+
+// signed 16-bit stereo, the A2DP buffer; the level is that of channel 1 as the cues are mono
+struct SampleFrame
+{
+    typedef Frame Sample;
+    static const uint8_t CHANNELS = 2;
+
+    static int32_t toLevel(const Sample &sample)
+    {
+        return sample.channel1;
+    }
+    static Sample fromLevel(int32_t level)
+    {
+        int16_t value = SampleS16::fromLevel(level);
+        return Frame(value, value);
+    }
+};
+
+template <typename From, typename To>
+inline void convertSamples(const typename From::Sample *from, typename To::Sample *to, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        to[i] = To::fromLevel(From::toLevel(from[i]));
+    }
+}
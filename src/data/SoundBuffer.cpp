@@ -19,12 +19,12 @@
  */
 #include "SoundBuffer.h"
 #include "../ArduProf.h"
+#include "../debug/TraceLog.h"
+#include "../peripheral/i2c/I2cResponse.h"
+#include "../peripheral/i2c/I2cStatus.h"
+#include "../debug/CueLatency.h"
 
-#include "./saturday-mono-i8.h"
-#include "./off-mono-i8.h"
-#include "./bright-mono-i8.h"
-#include "./beep-mono-i8.h"
-#include "./bell-mono-i8.h"
+#include "./CueStore.h"
 
 SoundBuffer *SoundBuffer::_instance = nullptr;
 
@@ -33,104 +33,295 @@ OneChannel8BitSoundData SoundBuffer::soundLaneMiddle;
 OneChannel8BitSoundData SoundBuffer::soundLaneRight;
 OneChannel8BitSoundData SoundBuffer::soundEdgePool;
 OneChannel8BitSoundData SoundBuffer::soundError;
+AdpcmSoundData SoundBuffer::adpcmCue[I2cParam::CueCount];
+ResampledSoundData SoundBuffer::resampledCue[I2cParam::CueCount];
+OneChannel8BitSoundData *SoundBuffer::cueData[I2cParam::CueCount] = {
+    nullptr, // CueNone
+    &soundEdgePool,
+    &soundLaneLeft,
+    &soundLaneMiddle,
+    &soundLaneRight,
+    &soundError,
+};
+const int8_t *SoundBuffer::slotPcm[I2cParam::CueCount];
+
+portMUX_TYPE SoundBuffer::_anchorLock = portMUX_INITIALIZER_UNLOCKED;
+uint32_t SoundBuffer::_anchorFrame = 0;
+uint32_t SoundBuffer::_anchorUs = 0;
+
+std::atomic<uint32_t> SoundBuffer::_urgentState(0);
+
+#define URGENT_VALID (1UL << 15)
+#define URGENT_PENDING_MASK 0x00ffffffUL // cue, gain and priority of the pending request
+#define LATENCY_VALID (1UL << 31)
+
+// cue played in its slot by each bit of I2cParam::Sound; the lanes share a slot, the first bit set wins
+typedef struct _SoundCue
+{
+    uint8_t bits; // of I2cParam::Sound
+    int16_t slot;
+    uint8_t cue;
+} SoundCue;
+
+static const SoundCue soundCues[] = {
+    {0x18, SoundBuffer::SLOT_EDGE_POOL, I2cParam::CueEdgePool}, // edgeTop, edgeBottom
+    {0x02, SoundBuffer::SLOT_LANE_MIDDLE, I2cParam::CueLaneMiddle},
+    {0x01, SoundBuffer::SLOT_LANE_LEFT, I2cParam::CueLaneLeft},
+    {0x04, SoundBuffer::SLOT_LANE_RIGHT, I2cParam::CueLaneRight},
+    {0x20, SoundBuffer::SLOT_ERROR, I2cParam::CueError}, // lostConnection
+};
 
 SoundBuffer::SoundBuffer() : OneChannel8BitSoundData(nullptr, (SAMPLING_RATE * BUFFER_DURATION / 1000), true),
-                             _mutex(xSemaphoreCreateMutex())
+                             _sequencer(resolveCue),
+                             _latencyTag(0),
+                             _streamFrame(0),
+                             _isTimelineActive(false),
+                             _timelineSequence(0),
+                             _repeatRemaining(0),
+                             _mutex(xSemaphoreCreateMutexStatic(&_mutexBuffer))
 {
+    _previousInstance = _instance;
     _instance = this;
-    memset(_dataSlot, 0, sizeof(_dataSlot));
+    memset(_voice, 0, sizeof(_voice));
+    memset(&_urgent, 0, sizeof(_urgent));
+    _urgentState.store(0, std::memory_order_relaxed);
+
+    // silence in the PlaySound layout until the first command
+    setSoundSteps(0);
+    _sequencer.compile(_soundStep, TOTAL_SLOTS);
+    _sequencer.commit();
 }
 
 SoundBuffer::~SoundBuffer()
 {
+    if (_instance == this)
+    {
+        _instance = _previousInstance;
+    }
+    vSemaphoreDelete(_mutex);
 }
 
 bool SoundBuffer::init(void)
 {
-    soundEdgePool.setData((int8_t *)off_mono_i8_raw, off_mono_i8_raw_len);
-    soundEdgePool.setLoop(true);
-
-    soundLaneLeft.setData((int8_t *)bright_mono_i8_raw, bright_mono_i8_raw_len);
-    soundLaneLeft.setLoop(true);
-    soundLaneMiddle.setData((int8_t *)beep_mono_i8_raw, beep_mono_i8_raw_len);
-    soundLaneMiddle.setLoop(true);
-    soundLaneRight.setData((int8_t *)bell_mono_i8_raw, bell_mono_i8_raw_len);
-    soundLaneRight.setLoop(true);
-
-    soundError.setData((int8_t *)saturday_mono_i8_raw, saturday_mono_i8_raw_len);
-    soundError.setLoop(true);
+    // the built-in cues are read in place from the bundle made by tools/asset_compiler.py
+    bool result = CueStore::begin();
+    ToneSoundData::begin();
+    for (uint8_t cue = I2cParam::CueNone + 1; cue < I2cParam::CueCount; cue++)
+    {
+        const CueBundleEntry *entry = CueStore::find(cue);
+        slotPcm[cue] = nullptr;
+        if (entry == nullptr)
+        {
+            LOG_TRACE("no cue ", cue, " in the cue bundle");
+            result = false;
+        }
+        else if (entry->rate != SAMPLING_RATE && !(entry->format == CueFormatS8 && ResampledSoundData::isRateSupported(entry->rate)))
+        {
+            LOG_TRACE("unsupported rate ", entry->rate, " of cue ", cue);
+            result = false;
+        }
+        else if (!cueFitsSlot(*entry))
+        {
+            LOG_TRACE("cue ", cue, " does not fill one slot: ", entry->length, " bytes");
+            result = false;
+        }
+        else if (entry->format == CueFormatImaAdpcm)
+        {
+            adpcmCue[cue].setBlocks(CueStore::samples(*entry), entry->length);
+            cueData[cue] = &adpcmCue[cue];
+        }
+        else if (entry->format == CueFormatMp3)
+        {
+            if (Mp3Cache::setStream(cue, CueStore::samples(*entry), entry->length))
+            {
+                cueData[cue] = Mp3Cache::soundData(cue);
+            }
+            else
+            {
+                result = false;
+            }
+        }
+        else if (entry->format == CueFormatS8 && entry->rate != SAMPLING_RATE)
+        {
+            resampledCue[cue].setSamples((const int8_t *)CueStore::samples(*entry), entry->length, entry->rate);
+            cueData[cue] = &resampledCue[cue];
+        }
+        else if (entry->format == CueFormatS8)
+        {
+            OneChannel8BitSoundData *soundData = getPcmCueData(cue);
+            soundData->setData((int8_t *)CueStore::samples(*entry), entry->length);
+            soundData->setLoop(true);
+            cueData[cue] = soundData;
+            slotPcm[cue] = (const int8_t *)CueStore::samples(*entry);
+        }
+        else
+        {
+            LOG_TRACE("unknown format ", entry->format, " of cue ", cue);
+            result = false;
+        }
+    }
 
-    return true;
+    return result;
 }
 
+// pos is not used: the pattern plays from its own cursor, which wraps at the end of
+// each cycle, so the block is always filled and a cycle lasts exactly its length
 int32_t SoundBuffer::get2ChannelData(int32_t pos, int32_t len, uint8_t *data)
 {
     int32_t result_len = 0;
     int32_t frame_count = len / 4;
-    int32_t frameNum = pos / 4;
-    int32_t soundLength = this->count();
 
-    if (len > 0 && frameNum < soundLength)
+    uint32_t blockFrame = _streamFrame;
+    uint32_t now = micros();
+    portENTER_CRITICAL(&_anchorLock);
+    _anchorFrame = blockFrame;
+    _anchorUs = now;
+    portEXIT_CRITICAL(&_anchorLock);
+
+    // a slab replaced by AssetPool::commit() stays allocated until the block is done
+    AssetPool::enterRender();
+    Frame *framePtr = (Frame *)data;
+    while (result_len < frame_count)
     {
-        Frame *framePtr = (Frame *)data;
-        int32_t slotNum;
-        while (result_len < frame_count)
-        {
-            slotNum = getSlotNumFromFrameNum(frameNum);
-            int32_t slotPos = frameNum % SAMPLING_PER_SLOT;
-            int32_t count = readSlotData(slotNum, slotPos, frame_count - result_len, framePtr);
-            result_len += count;
-            framePtr += count;
-            frameNum = (frameNum + count) % soundLength;
-        }
+        // mono until the final write into the A2DP buffer
+        int32_t chunk = std::min(frame_count - result_len, RENDER_CHUNK);
+        renderPattern(_mono, chunk);
+        mixVoices(blockFrame + result_len, _mono, chunk);
+        renderUrgent(blockFrame + result_len, _mono, chunk);
+        convertSamples<SampleS16, SampleFrame>(_mono, framePtr + result_len, chunk);
+        result_len += chunk;
     }
+    AssetPool::exitRender();
+    _streamFrame = blockFrame + result_len;
     return result_len * 4;
 }
 
-void SoundBuffer::updateSoundSignal(uint8_t soundData)
+uint32_t SoundBuffer::streamFrameAt(uint32_t us)
 {
-    I2cParam::Sound sound{
-        .byte{
-            .data = soundData}};
+    portENTER_CRITICAL_SAFE(&_anchorLock);
+    uint32_t frame = _anchorFrame;
+    uint32_t anchorUs = _anchorUs;
+    portEXIT_CRITICAL_SAFE(&_anchorLock);
+
+    int32_t elapsedUs = (int32_t)(us - anchorUs);
+    return frame + (int32_t)((int64_t)elapsedUs * SAMPLING_RATE / 1000000);
+}
 
-    if (sound.byte.data == 0)
+bool SoundBuffer::scheduleCue(uint32_t frame, uint8_t cue, uint8_t gain)
+{
+    OneChannel8BitSoundData *data = getCueData(cue);
+    if (data == nullptr)
     {
-        LOG_TRACE("sound.bit.data == 0");
-        clearAllSlots();
+        return false;
     }
-    else
+
+    if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE)
     {
-        if (sound.bit.edgeTop || sound.bit.edgeBottom)
-        {
-            LOG_TRACE("sound.bit.edgeTop/edgeBottom");
-            setSoundDataPtr(SLOT_EDGE_POOL, &soundEdgePool);
-        }
+        LOG_TRACE("xSemaphoreTake failed!");
+        return false;
+    }
 
-        if (sound.bit.laneMiddle)
+    bool result = false;
+    for (int i = 0; i < MAX_VOICES; i++)
+    {
+        Voice &voice = _voice[i];
+        if (!voice.isActive)
         {
-            LOG_TRACE("sound.bit.laneMiddle");
-            setSoundDataPtr(SLOT_LANE_MIDDLE, &soundLaneMiddle);
+            uint32_t current = _streamFrame;
+            voice.data = data;
+            voice.startFrame = ((int32_t)(frame - current) < 0) ? current : frame;
+            voice.gain = (gain < I2cParam::MAX_GAIN) ? gain : I2cParam::MAX_GAIN;
+            voice.isActive = true;
+            result = true;
+            TRACE(TraceScheduleCue, cue, frame, current);
+            break;
         }
-        else if (sound.bit.laneLeft)
+    }
+
+    if (xSemaphoreGive(_mutex) != pdTRUE)
+    {
+        LOG_TRACE("xSemaphoreGive failed!");
+    }
+
+    return result;
+}
+
+uint8_t SoundBuffer::requestUrgent(uint8_t cue, uint8_t gain, uint8_t priority)
+{
+    // the valid cues are below 128 and fit in 7 bits like the gain
+    if (getCueData(cue) == nullptr)
+    {
+        return I2cResponse::Fail;
+    }
+    if (gain > I2cParam::MAX_GAIN)
+    {
+        gain = I2cParam::MAX_GAIN;
+    }
+
+    uint32_t request = ((uint32_t)priority << 16) | URGENT_VALID | ((uint32_t)gain << 7) | cue;
+    uint32_t state = _urgentState.load(std::memory_order_relaxed);
+    do
+    {
+        bool isPendingHigher = (state & URGENT_VALID) && ((state >> 16) & 0xff) > priority;
+        if ((state >> 24) > priority || isPendingHigher)
         {
-            LOG_TRACE("sound.bit.laneLeft");
-            setSoundDataPtr(SLOT_LANE_LEFT, &soundLaneLeft);
+            return I2cResponse::ErrorBusy;
         }
-        else if (sound.bit.laneRight)
+    } while (!_urgentState.compare_exchange_weak(state, (state & ~URGENT_PENDING_MASK) | request,
+                                                 std::memory_order_release, std::memory_order_relaxed));
+    return I2cResponse::Success;
+}
+
+// replaces [frame, frame + count) with the urgent cue, a new request starts at frame
+void SoundBuffer::renderUrgent(uint32_t frame, SampleS16::Sample *mono, int32_t count)
+{
+    // picks up the pending request, its priority becomes the playing one; requestUrgent()
+    // has already checked it against the playing cue
+    uint32_t state = _urgentState.load(std::memory_order_acquire);
+    while ((state & URGENT_VALID) &&
+           !_urgentState.compare_exchange_weak(state, (state & 0x00ff0000UL) << 8, std::memory_order_acquire, std::memory_order_acquire))
+    {
+    }
+    if (state & URGENT_VALID)
+    {
+        _urgent.data = getCueData(state & 0x7f);
+        _urgent.startFrame = frame;
+        _urgent.gain = (state >> 7) & 0x7f;
+        _urgent.isActive = (_urgent.data != nullptr);
+        I2cStatus::markApplied();
+        if (!_urgent.isActive)
         {
-            LOG_TRACE("sound.bit.laneRight");
-            setSoundDataPtr(SLOT_LANE_RIGHT, &soundLaneRight);
+            _urgentState.fetch_and(URGENT_PENDING_MASK, std::memory_order_relaxed);
         }
+    }
+
+    if (!_urgent.isActive)
+    {
+        return;
+    }
 
-        if (sound.bit.lostConnection)
+    int32_t offset = (int32_t)(frame - _urgent.startFrame);
+    for (int32_t j = 0; j < count && offset + j < SAMPLING_PER_SLOT; j++)
+    {
+        Frame sample(mono[j]); // kept if the cue has no frame there
+        _urgent.data->getData(offset + j, sample);
+        int32_t level = SampleFrame::toLevel(sample);
+        if (_urgent.gain != I2cParam::MAX_GAIN)
         {
-            LOG_TRACE("sound.bit.lostConnection");
-            setSoundDataPtr(SLOT_ERROR, &soundError);
+            level = level * _urgent.gain / I2cParam::MAX_GAIN;
         }
+        mono[j] = level;
+    }
+
+    if (offset + count >= SAMPLING_PER_SLOT)
+    {
+        _urgent.isActive = false; // back to the pattern
+        _urgentState.fetch_and(URGENT_PENDING_MASK, std::memory_order_relaxed);
     }
 }
 
-void SoundBuffer::clearAllSlots(void)
+// adds the scheduled cues overlapping [frame, frame + count) to the rendered block
+void SoundBuffer::mixVoices(uint32_t frame, SampleS16::Sample *mono, int32_t count)
 {
     if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE)
     {
@@ -138,9 +329,33 @@ void SoundBuffer::clearAllSlots(void)
         return;
     }
 
-    for (int i = 0; i < DIM_DATA_SLOT; i++)
+    for (int i = 0; i < MAX_VOICES; i++)
     {
-        _dataSlot[i].data = nullptr;
+        Voice &voice = _voice[i];
+        if (!voice.isActive)
+        {
+            continue;
+        }
+
+        // position in the cue of the first frame of the block, negative if the cue starts later
+        int32_t offset = (int32_t)(frame - voice.startFrame);
+        if (offset >= SAMPLING_PER_SLOT)
+        {
+            voice.isActive = false; // every cue fits one slot
+            continue;
+        }
+
+        for (int32_t j = std::max<int32_t>(0, -offset); j < count && offset + j < SAMPLING_PER_SLOT; j++)
+        {
+            Frame sample;
+            voice.data->getData(offset + j, sample);
+            mono[j] = SampleS16::fromLevel(mono[j] + SampleFrame::toLevel(sample) * voice.gain / I2cParam::MAX_GAIN);
+        }
+
+        if (offset + count >= SAMPLING_PER_SLOT)
+        {
+            voice.isActive = false;
+        }
     }
 
     if (xSemaphoreGive(_mutex) != pdTRUE)
@@ -149,74 +364,237 @@ void SoundBuffer::clearAllSlots(void)
     }
 }
 
-OneChannel8BitSoundData *SoundBuffer::getSoundDataPtr(int32_t slot)
+void SoundBuffer::updateSoundSignal(uint8_t soundData, uint8_t sequence)
 {
-    configASSERT(slot >= 0 && slot < TOTAL_SLOTS);
+    TRACE(TraceSoundSignal, soundData);
+
+    uint32_t slotMask = setSoundSteps(soundData);
+    _sequencer.compile(_soundStep, TOTAL_SLOTS);
+    commitPattern(0); // back to the PlaySound layout if a timeline or a pattern is playing
+
+    if (slotMask)
+    {
+        uint32_t previous = _latencyTag.exchange(LATENCY_VALID | (slotMask << 8) | sequence, std::memory_order_relaxed);
+        if (previous & LATENCY_VALID)
+        {
+            CueLatency::countLost();
+        }
+    }
+}
+
+// sets the slots of the bits of soundData in the PlaySound steps, the other
+// slots keep their cue; 0 clears every slot. Returns the mask of the slots set.
+uint32_t SoundBuffer::setSoundSteps(uint8_t soundData)
+{
+    if (soundData == 0)
+    {
+        for (int32_t i = 0; i < TOTAL_SLOTS; i++)
+        {
+            _soundStep[i].cue = I2cParam::CueNone;
+            _soundStep[i].gain = I2cParam::MAX_GAIN;
+            _soundStep[i].duration = SLOT_DURATION / I2cParam::PATTERN_TICK;
+            _soundStep[i].repeat = 1;
+        }
+        return 0;
+    }
+
+    uint32_t slotMask = 0;
+    for (size_t i = 0; i < dim(soundCues); i++)
+    {
+        const SoundCue &soundCue = soundCues[i];
+        if ((soundData & soundCue.bits) && !(slotMask & (1UL << soundCue.slot)))
+        {
+            _soundStep[soundCue.slot].cue = soundCue.cue;
+            slotMask |= 1UL << soundCue.slot;
+        }
+    }
+    return slotMask;
+}
+
+// records the latency of the pending PlaySound on its first non-silent frame
+void SoundBuffer::checkLatency(uint8_t step, const SampleS16::Sample *mono, int32_t count)
+{
+    uint32_t tag = _latencyTag.load(std::memory_order_relaxed);
+    if (!(tag & LATENCY_VALID) || !(tag & (1UL << (step + 8))))
+    {
+        return;
+    }
+
+    for (int32_t j = 0; j < count; j++)
+    {
+        if (mono[j])
+        {
+            if (_latencyTag.compare_exchange_strong(tag, 0, std::memory_order_relaxed))
+            {
+                CueLatency::record(tag & 0xff, micros());
+            }
+            return;
+        }
+    }
+}
+
+OneChannel8BitSoundData *SoundBuffer::getCueData(uint8_t cue)
+{
+    if (cue < I2cParam::CueCount)
+    {
+        // decode ahead: an MP3 cue is decoded as soon as it is referenced
+        Mp3Cache::prefetch(cue);
+        return cueData[cue];
+    }
+    if (cue >= I2cParam::CueTone)
+    {
+        return ToneSoundData::soundData(cue - I2cParam::CueTone);
+    }
+    return (cue >= I2cParam::CueAsset) ? AssetPool::soundData(cue - I2cParam::CueAsset) : nullptr;
+}
+
+// 8-bit PCM sound data of a built-in cue
+OneChannel8BitSoundData *SoundBuffer::getPcmCueData(uint8_t cue)
+{
+    switch (cue)
+    {
+    case I2cParam::CueEdgePool:
+        return &soundEdgePool;
+    case I2cParam::CueLaneLeft:
+        return &soundLaneLeft;
+    case I2cParam::CueLaneMiddle:
+        return &soundLaneMiddle;
+    case I2cParam::CueLaneRight:
+        return &soundLaneRight;
+    case I2cParam::CueError:
+        return &soundError;
+    default:
+        return nullptr;
+    }
+}
+
+// samples of soundData if it is a built-in cue of exactly one slot of 8-bit PCM, else nullptr
+const int8_t *SoundBuffer::getSlotPcm(const OneChannel8BitSoundData *soundData)
+{
+    for (uint8_t cue = I2cParam::CueNone + 1; cue < I2cParam::CueCount; cue++)
+    {
+        if (cueData[cue] == soundData)
+        {
+            return slotPcm[cue];
+        }
+    }
+    return nullptr;
+}
+
+// sound data of a cue for the pattern sequencer, with its samples if it is one slot of 8-bit PCM
+OneChannel8BitSoundData *SoundBuffer::resolveCue(uint8_t cue, const int8_t **pcm)
+{
+    OneChannel8BitSoundData *soundData = getCueData(cue);
+    *pcm = getSlotPcm(soundData);
+    return soundData;
+}
+
+bool SoundBuffer::setTimeline(const I2cParam::Timeline &timeline)
+{
+    configASSERT(timeline.slotCount > 0 && timeline.slotCount <= I2cParam::MAX_TIMELINE_SLOTS);
+
+    // compile before taking the mutex, the audio callback waits on it
+    I2cParam::PatternStep step[I2cParam::MAX_TIMELINE_SLOTS];
+    for (int i = 0; i < timeline.slotCount; i++)
+    {
+        step[i].cue = timeline.slot[i].cue;
+        step[i].gain = (timeline.slot[i].gain < I2cParam::MAX_GAIN) ? timeline.slot[i].gain : I2cParam::MAX_GAIN;
+        step[i].duration = SLOT_DURATION / I2cParam::PATTERN_TICK;
+        step[i].repeat = 1;
+    }
+    if (!_sequencer.compile(step, timeline.slotCount))
+    {
+        return false;
+    }
 
     if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE)
     {
         LOG_TRACE("xSemaphoreTake failed!");
-        return nullptr;
+        return false;
     }
 
-    OneChannel8BitSoundData *dataPtr = _dataSlot[slot].data;
+    bool result = !(_isTimelineActive && _timelineSequence == timeline.sequence);
+    if (result)
+    {
+        _sequencer.commit();
+        _isTimelineActive = true;
+        _timelineSequence = timeline.sequence;
+        _repeatRemaining = timeline.repeat;
+    }
 
     if (xSemaphoreGive(_mutex) != pdTRUE)
     {
         LOG_TRACE("xSemaphoreGive failed!");
     }
 
-    return dataPtr;
+    return result;
 }
 
-bool SoundBuffer::setSoundDataPtr(int32_t slot, OneChannel8BitSoundData *soundData)
+bool SoundBuffer::playPattern(uint8_t id, uint8_t repeat)
 {
-    configASSERT(slot >= 0 && slot < TOTAL_SLOTS);
+    if (!_sequencer.compile(id))
+    {
+        return false;
+    }
+    commitPattern(repeat);
+    return true;
+}
 
+// plays the pattern compiled last for repeat cycles (0 = until replaced)
+void SoundBuffer::commitPattern(uint8_t repeat)
+{
     if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE)
     {
         LOG_TRACE("xSemaphoreTake failed!");
-        return false;
+        return;
     }
 
-    DataSlot *dataSlotPtr = &_dataSlot[slot];
-    dataSlotPtr->data = soundData;
+    _sequencer.commit();
+    _isTimelineActive = false;
+    _repeatRemaining = repeat;
 
     if (xSemaphoreGive(_mutex) != pdTRUE)
     {
         LOG_TRACE("xSemaphoreGive failed!");
     }
+}
 
-    return true;
+// called by the audio callback, with _mutex held, each time the last event of the pattern has been rendered
+void SoundBuffer::onCycleEnd(void)
+{
+    if (_repeatRemaining > 0 && --_repeatRemaining == 0)
+    {
+        // the pattern has been played "repeat" times: silence until the next command
+        _sequencer.mute();
+        _isTimelineActive = false;
+    }
 }
 
-int32_t SoundBuffer::readSlotData(int32_t slot, int32_t index, int32_t length, Frame *framePtr)
+// renders the next count frames of the pattern, wrapping at the end of the cycle
+void SoundBuffer::renderPattern(SampleS16::Sample *mono, int32_t count)
 {
-    int32_t result_len = 0;
-    OneChannel8BitSoundData *dataPtr = getSoundDataPtr(slot);
-    length = std::min(length, SAMPLING_PER_SLOT - index);
-    while (length-- > 0)
+    if (xSemaphoreTake(_mutex, portMAX_DELAY) != pdTRUE)
     {
-        if (dataPtr)
-        {
-            if (dataPtr->getData((index), *framePtr))
-            {
-                result_len++;
-            }
-            else
-            {
-                configASSERT(false);
-                break;
-            }
-        }
-        else
+        LOG_TRACE("xSemaphoreTake failed!");
+        memset(mono, 0, count * sizeof(*mono));
+        return;
+    }
+
+    int32_t rendered = 0;
+    while (rendered < count)
+    {
+        uint8_t step = _sequencer.step();
+        int32_t length = _sequencer.render(mono + rendered, count - rendered);
+        checkLatency(step, mono + rendered, length);
+        rendered += length;
+        if (_sequencer.position() == 0)
         {
-            framePtr->channel1 = 0;
-            framePtr->channel2 = 0;
-            result_len++;
+            onCycleEnd();
         }
-        index++;
-        framePtr++;
     }
-    return result_len;
+
+    if (xSemaphoreGive(_mutex) != pdTRUE)
+    {
+        LOG_TRACE("xSemaphoreGive failed!");
+    }
 }
@@ -18,17 +18,25 @@
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #pragma once
+#include <atomic>
 #include "../lib/ESP32-A2DP/src/BluetoothA2DPSource.h"
 #include "../lib/ESP32-A2DP/src/SoundData.h"
 
-#include "../base/peripheral/PeriodicTimer.h"
 #include "../peripheral/i2c/I2cParam.h"
 
-#include "./DataSlot.h"
+#include "./AssetPool.h"
+#include "./AdpcmSoundData.h"
+#include "./ResampledSoundData.h"
+#include "./ToneSoundData.h"
+#include "./Mp3Cache.h"
+#include "./CueBundleDef.h"
+#include "./SampleFormat.h"
+#include "./PatternSequencer.h"
 
 class SoundBuffer : public OneChannel8BitSoundData
 {
 public:
+    // pattern of PlaySound, each bit of I2cParam::Sound plays its cue in one slot
     // +------+------+------+------+------+
     // | slot | slot | slot | slot | slot |
     // | 0.1s | 0.1s | 0.1s | 0.1s | 0.1s |
@@ -50,37 +58,138 @@ public:
     static const int32_t SAMPLING_PER_SLOT = SAMPLING_RATE * SLOT_DURATION / 1000;
     static const int32_t TOTAL_SLOTS = (BUFFER_DURATION / SLOT_DURATION);
 
-    static const int32_t DIM_DATA_SLOT = 10; // max number of dataSlot
+    static const int32_t MAX_VOICES = 4;     // cues scheduled at a stream frame, mixed over the slots
+    static const int32_t RENDER_CHUNK = 256; // frames rendered in _mono at a time
+    static_assert(ResampledSoundData::OUTPUT_RATE == SAMPLING_RATE, "cues are resampled to SAMPLING_RATE");
+    static_assert(AssetPool::SLAB_SIZE == SAMPLING_PER_SLOT && AssetPool::SAMPLE_RATE == SAMPLING_RATE, "an asset must fill one slot");
+    static_assert(Mp3Cache::SLAB_SIZE == SAMPLING_PER_SLOT && Mp3Cache::SAMPLE_RATE == SAMPLING_RATE, "an MP3 cue is decoded to one slot");
+    static_assert(PatternSequencer::CUE_FRAMES == SAMPLING_PER_SLOT && PatternSequencer::SAMPLING_RATE == SAMPLING_RATE, "a pattern cue lasts one slot");
+    static_assert(SLOT_DURATION % I2cParam::PATTERN_TICK == 0 && TOTAL_SLOTS <= I2cParam::MAX_PATTERN_STEPS && I2cParam::MAX_TIMELINE_SLOTS <= I2cParam::MAX_PATTERN_STEPS,
+                  "PlaySound and PlayTimeline must fit a pattern");
+    static_assert(CUE_SLOT_SAMPLES == SAMPLING_PER_SLOT && CUE_SAMPLE_RATE == SAMPLING_RATE && CUE_MIN_RATE == ResampledSoundData::MIN_RATE, "cueSlotLength() out of date");
+    static_assert(CUE_ADPCM_BLOCK_SAMPLES == AdpcmSoundData::BLOCK_SAMPLES && CUE_ADPCM_BLOCK_SIZE == AdpcmSoundData::BLOCK_SIZE, "cueSlotLength() out of date");
 
     SoundBuffer();
     ~SoundBuffer();
 
     bool init(void);
     int32_t get2ChannelData(int32_t pos, int32_t len, uint8_t *data);
-    void updateSoundSignal(uint8_t soundData);
+    // every block is widened from mono (SampleS16), both channels are identical
+    virtual bool isMono(void)
+    {
+        return true;
+    }
+    // PlaySound: sets the slots of the bits of soundData, the other slots keep the
+    // cues of the previous PlaySound commands, 0 silences them all; sequence is the
+    // CueLatency sequence number of the command
+    void updateSoundSignal(uint8_t soundData, uint8_t sequence);
+    // replaces the pattern at once; returns false if the timeline is already playing
+    bool setTimeline(const I2cParam::Timeline &timeline);
+
+    // stores a pattern for playPattern(), returns false if it is invalid
+    bool definePattern(const I2cParam::Pattern &pattern)
+    {
+        return _sequencer.define(pattern);
+    }
+    // replaces the pattern by the stored pattern id for repeat cycles (0 = until replaced);
+    // returns false if id is not defined
+    bool playPattern(uint8_t id, uint8_t repeat);
+
+    // plays a cue from the given stream frame on, sample-accurately; a frame which
+    // has already been rendered plays from the next render block
+    bool scheduleCue(uint32_t frame, uint8_t cue, uint8_t gain);
+
+    // plays a cue instead of the slots from the next render block on, then returns
+    // to the pattern; lock-free, callable from any context. Returns I2cResponse::Success,
+    // ErrorBusy if the pending or playing urgent cue has a higher priority, or Fail
+    // if the cue has no data
+    static uint8_t requestUrgent(uint8_t cue, uint8_t gain, uint8_t priority);
+
+    // number of frames rendered since start (wraps after ~27h)
+    uint32_t streamFrame(void) const
+    {
+        return _streamFrame;
+    }
+    // stream frame rendered at local time us (micros()), extrapolated from the last render block
+    static uint32_t streamFrameAt(uint32_t us);
 
 private:
     static SoundBuffer *_instance;
+    // instance replaced by this one (e.g. by RenderCheck), restored by the destructor
+    SoundBuffer *_previousInstance;
 
-    DataSlot _dataSlot[DIM_DATA_SLOT];
+    // pattern of PlaySound, PlayTimeline or PlayPattern, guarded by _mutex once committed
+    PatternSequencer _sequencer;
+    // slots set by the PlaySound commands so far, a PlaySound only changes the slots of its bits
+    I2cParam::PatternStep _soundStep[TOTAL_SLOTS];
+
+    typedef struct _Voice
+    {
+        OneChannel8BitSoundData *data;
+        uint32_t startFrame;
+        uint8_t gain;
+        bool isActive;
+    } Voice;
+    Voice _voice[MAX_VOICES];
+
+    // urgent cue, only used by the render callback once picked up from _urgentState
+    typedef struct _UrgentVoice
+    {
+        OneChannel8BitSoundData *data;
+        uint32_t startFrame;
+        uint8_t gain;
+        bool isActive;
+    } UrgentVoice;
+    UrgentVoice _urgent;
+    // playing priority << 24 | pending priority << 16 | pending valid << 15 | gain << 7 | cue,
+    // one word so that requestUrgent() checks both priorities atomically; the playing
+    // priority is 0 when no urgent cue is playing
+    static std::atomic<uint32_t> _urgentState;
+
+    // PlaySound waiting for its first non-silent frame: valid << 31 | slot mask << 8 | sequence
+    std::atomic<uint32_t> _latencyTag;
+
+    // render buffer: a chunk of the block in SampleS16, widened to Frame at the end
+    SampleS16::Sample _mono[RENDER_CHUNK];
+
+    volatile uint32_t _streamFrame;
+    // stream frame and micros() at the start of the last render block
+    static portMUX_TYPE _anchorLock;
+    static uint32_t _anchorFrame;
+    static uint32_t _anchorUs;
+
+    bool _isTimelineActive;
+    uint8_t _timelineSequence;
+    uint8_t _repeatRemaining; // cycles left of the pattern, 0 = until replaced
 
     SemaphoreHandle_t _mutex;
+    StaticSemaphore_t _mutexBuffer;
 
     static OneChannel8BitSoundData soundLaneLeft;
     static OneChannel8BitSoundData soundLaneMiddle;
     static OneChannel8BitSoundData soundLaneRight;
     static OneChannel8BitSoundData soundEdgePool;
     static OneChannel8BitSoundData soundError;
-
-    void clearAllSlots(void);
-
-    OneChannel8BitSoundData *getSoundDataPtr(int32_t slot);
-    bool setSoundDataPtr(int32_t slot, OneChannel8BitSoundData *soundData);
-
-    inline int32_t getSlotNumFromFrameNum(int32_t frameNumber)
-    {
-        return (frameNumber / SAMPLING_PER_SLOT) % TOTAL_SLOTS;
-    }
-
-    int32_t readSlotData(int32_t slotNum, int32_t slotPos, int32_t length, Frame *framePtr);
+    // built-in cues stored as ADPCM in the cue bundle
+    static AdpcmSoundData adpcmCue[I2cParam::CueCount];
+    // built-in cues stored at a lower sampling rate in the cue bundle
+    static ResampledSoundData resampledCue[I2cParam::CueCount];
+    // sound data of each built-in cue, one of the above
+    static OneChannel8BitSoundData *cueData[I2cParam::CueCount];
+    // samples of the built-in cues stored as one slot of 8-bit PCM, rendered without getData()
+    static const int8_t *slotPcm[I2cParam::CueCount];
+
+    static OneChannel8BitSoundData *getCueData(uint8_t cue);
+    static OneChannel8BitSoundData *getPcmCueData(uint8_t cue);
+    static const int8_t *getSlotPcm(const OneChannel8BitSoundData *soundData);
+    static OneChannel8BitSoundData *resolveCue(uint8_t cue, const int8_t **pcm);
+
+    uint32_t setSoundSteps(uint8_t soundData);
+    void commitPattern(uint8_t repeat);
+    void onCycleEnd(void);
+
+    void renderPattern(SampleS16::Sample *mono, int32_t count);
+    void mixVoices(uint32_t frame, SampleS16::Sample *mono, int32_t count);
+    void renderUrgent(uint32_t frame, SampleS16::Sample *mono, int32_t count);
+    void checkLatency(uint8_t step, const SampleS16::Sample *mono, int32_t count);
 };
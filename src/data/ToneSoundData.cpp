@@ -0,0 +1,121 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "ToneSoundData.h"
+
+ToneSoundData ToneSoundData::_bank[MAX_TONES];
+int16_t ToneSoundData::_sine[(1 << TABLE_BITS) + 1];
+
+void ToneSoundData::begin(void)
+{
+    for (int32_t i = 0; i <= (1 << TABLE_BITS); i++)
+    {
+        _sine[i] = (int16_t)lroundf(32767.0f * sinf(2.0f * (float)M_PI * i / (1 << TABLE_BITS)));
+    }
+}
+
+bool ToneSoundData::set(uint8_t id, const I2cParam::ToneParam &param)
+{
+    if (id >= MAX_TONES ||
+        param.frequency < I2cParam::MIN_TONE_FREQUENCY || param.frequency > I2cParam::MAX_TONE_FREQUENCY ||
+        param.waveform >= I2cParam::WaveCount || param.gain > I2cParam::MAX_GAIN || param.sustain > 100 ||
+        param.attack + param.decay + param.release > (int32_t)(LENGTH * 1000 / SAMPLE_RATE) ||
+        param.fmFrequency > I2cParam::MAX_TONE_FREQUENCY)
+    {
+        return false;
+    }
+
+    ToneSoundData &data = _bank[id];
+    uint8_t next = data._active.load(std::memory_order_relaxed) ^ 1;
+    Tone &tone = data._tone[next];
+    tone.phaseStep = (uint32_t)(((uint64_t)param.frequency << 32) / SAMPLE_RATE);
+    tone.fmStep = (uint32_t)(((uint64_t)param.fmFrequency << 32) / SAMPLE_RATE);
+    tone.fmDeviation = (int32_t)(param.fmIndex * 65536.0f / (16.0f * 2.0f * (float)M_PI));
+    tone.attackEnd = param.attack * (int32_t)SAMPLE_RATE / 1000;
+    tone.decayEnd = tone.attackEnd + param.decay * (int32_t)SAMPLE_RATE / 1000;
+    tone.releaseStart = LENGTH - param.release * (int32_t)SAMPLE_RATE / 1000;
+    tone.sustain = param.sustain * SampleQ15::ONE / 100;
+    tone.amplitude = 127 * 127 * param.gain / I2cParam::MAX_GAIN;
+    tone.waveform = param.waveform;
+    data._active.store(next, std::memory_order_release);
+    return true;
+}
+
+int32_t ToneSoundData::getData(int32_t pos, Frame &frame)
+{
+    const Tone &tone = _tone[_active.load(std::memory_order_acquire)];
+    if (pos < 0 || pos >= LENGTH || tone.amplitude == 0)
+    {
+        frame.channel1 = 0;
+    }
+    else
+    {
+        uint32_t phase = (uint32_t)pos * tone.phaseStep;
+        if (tone.fmStep)
+        {
+            int32_t modulator = wave(I2cParam::WaveSine, (uint32_t)pos * tone.fmStep);
+            phase += (uint32_t)((tone.fmDeviation * modulator) >> 15) << 16;
+        }
+        int32_t value = SampleQ15::mul(wave(tone.waveform, phase), envelope(tone, pos));
+        frame.channel1 = (int16_t)SampleQ15::mul(value, tone.amplitude);
+    }
+    frame.channel2 = frame.channel1;
+    return 1;
+}
+
+// Q15 oscillator output at phase (2^32 per cycle)
+int32_t ToneSoundData::wave(uint8_t waveform, uint32_t phase)
+{
+    switch (waveform)
+    {
+    case I2cParam::WaveTriangle:
+    {
+        int32_t p = phase >> 16;
+        return (p < 32768) ? (2 * p - 32767) : (32767 - 2 * (p - 32768));
+    }
+    case I2cParam::WaveSquare:
+        return (phase < 0x80000000UL) ? 32767 : -32767;
+    case I2cParam::WaveSine:
+    default:
+    {
+        // linear interpolation between the table entries
+        uint32_t index = phase >> (32 - TABLE_BITS);
+        int32_t frac = (phase >> (16 - TABLE_BITS)) & 0xffff;
+        return _sine[index] + (((_sine[index + 1] - _sine[index]) * frac) >> 16);
+    }
+    }
+}
+
+// Q15 ADSR level at frame pos of the slot
+int32_t ToneSoundData::envelope(const Tone &tone, int32_t pos)
+{
+    if (pos < tone.attackEnd)
+    {
+        return pos * SampleQ15::ONE / tone.attackEnd;
+    }
+    if (pos < tone.decayEnd)
+    {
+        return SampleQ15::ONE - (SampleQ15::ONE - tone.sustain) * (pos - tone.attackEnd) / (tone.decayEnd - tone.attackEnd);
+    }
+    if (pos < tone.releaseStart)
+    {
+        return tone.sustain;
+    }
+    return tone.sustain * (LENGTH - pos) / (LENGTH - tone.releaseStart);
+}
@@ -0,0 +1,85 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "../lib/ESP32-A2DP/src/SoundData.h"
+#include "../peripheral/i2c/I2cParam.h"
+#include "./SampleFormat.h"
+
+// Synthesized cue (I2cParam::CueTone + id): a wavetable/DDS oscillator with an
+// ADSR envelope over one slot and optional FM, defined by I2cCommand::SetTone.
+// Every frame is computed from its position with fixed-point phase
+// accumulators (2^32 per cycle), so it costs a few bytes per tone and any
+// frame can be read in any order. The parameters are double buffered: set()
+// publishes a new set at once to the audio callback, without lock.
+class ToneSoundData : public OneChannel8BitSoundData
+{
+public:
+    static const uint8_t MAX_TONES = I2cParam::MAX_TONES;
+    static const uint32_t SAMPLE_RATE = 44100;
+    static const int32_t LENGTH = 4410; // SoundBuffer::SAMPLING_PER_SLOT
+
+    ToneSoundData() : OneChannel8BitSoundData(true), _active(0)
+    {
+        memset(_tone, 0, sizeof(_tone));
+    }
+
+    // fills the wavetable, call once before the audio callback starts
+    static void begin(void);
+
+    // validates and publishes the parameters of tone id; single writer
+    static bool set(uint8_t id, const I2cParam::ToneParam &param);
+
+    // stable pointer, plays silence until set()
+    static OneChannel8BitSoundData *soundData(uint8_t id)
+    {
+        return (id < MAX_TONES) ? &_bank[id] : nullptr;
+    }
+
+    // same output scale as OneChannel8BitSoundData; silence past LENGTH
+    virtual int32_t getData(int32_t pos, Frame &frame);
+
+private:
+    static const int32_t TABLE_BITS = 8;
+
+    // parameters in render units
+    typedef struct _Tone
+    {
+        uint32_t phaseStep;  // carrier phase per frame
+        uint32_t fmStep;     // modulator phase per frame, 0 = no FM
+        int32_t fmDeviation; // peak phase deviation, 2^16 per cycle
+        int32_t attackEnd;   // in frames
+        int32_t decayEnd;
+        int32_t releaseStart;
+        int32_t sustain;   // Q15
+        int32_t amplitude; // output at the peak of the envelope
+        uint8_t waveform;
+    } Tone;
+
+    Tone _tone[2];
+    std::atomic<uint8_t> _active; // index of the published _tone
+
+    static ToneSoundData _bank[MAX_TONES];
+    static int16_t _sine[(1 << TABLE_BITS) + 1]; // Q15, one cycle plus the first entry again
+
+    static int32_t wave(uint8_t waveform, uint32_t phase);
+    static int32_t envelope(const Tone &tone, int32_t pos);
+};
@@ -0,0 +1,75 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "CommandRecorder.h"
+
+portMUX_TYPE CommandRecorder::_lock = portMUX_INITIALIZER_UNLOCKED;
+CommandRecorder::CommandRecord CommandRecorder::_ring[RING_SIZE];
+uint32_t CommandRecorder::_total = 0;
+
+// every command is recorded whole, so that the dump can be replayed
+static_assert(sizeof(I2cParam::Timeline) <= CommandRecorder::MAX_PARAM && 1 + sizeof(I2cParam::ToneParam) <= CommandRecorder::MAX_PARAM,
+              "a command does not fit CommandRecord::param");
+
+void CommandRecorder::record(uint8_t event, uint8_t command, uint32_t streamFrame, const uint8_t *param, size_t len)
+{
+    uint32_t now = micros();
+    len = std::min<size_t>(len, MAX_PARAM);
+
+    portENTER_CRITICAL_SAFE(&_lock);
+    CommandRecord &record = _ring[_total % RING_SIZE];
+    record.streamFrame = streamFrame;
+    record.timeUs = now;
+    record.event = event;
+    record.command = command;
+    record.length = len;
+    record.reserved = 0;
+    memcpy(record.param, param, len);
+    memset(record.param + len, 0, MAX_PARAM - len);
+    _total++;
+    portEXIT_CRITICAL_SAFE(&_lock);
+}
+
+void CommandRecorder::write(Print &out)
+{
+    portENTER_CRITICAL(&_lock);
+    uint32_t total = _total;
+    portEXIT_CRITICAL(&_lock);
+    uint32_t count = std::min<uint32_t>(total, RING_SIZE);
+
+    CommandDumpHeader header = {
+        .magic = {'C', 'R'},
+        .version = VERSION,
+        .recordSize = sizeof(CommandRecord),
+        .count = (uint16_t)count,
+        .reserved = 0,
+        .total = total,
+    };
+    out.write((const uint8_t *)&header, sizeof(header));
+
+    // records written meanwhile may overwrite the oldest ones, the stream frames tell
+    for (uint32_t i = total - count; i != total; i++)
+    {
+        CommandRecord record;
+        portENTER_CRITICAL(&_lock);
+        record = _ring[i % RING_SIZE];
+        portEXIT_CRITICAL(&_lock);
+        out.write((const uint8_t *)&record, sizeof(record));
+    }
+}
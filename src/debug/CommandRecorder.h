@@ -0,0 +1,65 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include "../peripheral/i2c/I2cParam.h"
+
+// Records the commands applied to SoundBuffer together with the render cursor
+// (stream frame) at which they took effect, in a RAM ring of the latest
+// RING_SIZE records. The binary dump ('r' on Serial, see write()) can be
+// decoded with tools/command_decode.py to reproduce a field sequence.
+class CommandRecorder
+{
+public:
+    static const uint8_t VERSION = 2;
+    static const uint8_t MAX_PARAM = sizeof(I2cParam::Pattern); // DefinePattern, the largest command
+    static const uint8_t RING_SIZE = 64;
+
+    typedef struct __attribute__((packed)) _CommandRecord
+    {
+        uint32_t streamFrame; // SoundBuffer::streamFrame() when applied
+        uint32_t timeUs;      // micros() when applied
+        uint8_t event;        // AppEvent: EventI2c or EventA2dpConnectionState
+        uint8_t command;      // I2cCommand for EventI2c, esp_a2d_connection_state_t otherwise
+        uint8_t length;       // bytes used in param
+        uint8_t reserved;
+        uint8_t param[MAX_PARAM]; // command parameters as applied, little endian
+    } CommandRecord;
+
+    // header of the binary dump, followed by "count" CommandRecord, oldest first
+    typedef struct __attribute__((packed)) _CommandDumpHeader
+    {
+        char magic[2]; // "CR"
+        uint8_t version;
+        uint8_t recordSize;
+        uint16_t count;
+        uint16_t reserved;
+        uint32_t total; // records since start, total - count have been overwritten
+    } CommandDumpHeader;
+
+    static void record(uint8_t event, uint8_t command, uint32_t streamFrame, const uint8_t *param = nullptr, size_t len = 0);
+
+    static void write(Print &out);
+
+private:
+    static portMUX_TYPE _lock;
+    static CommandRecord _ring[RING_SIZE];
+    static uint32_t _total;
+};
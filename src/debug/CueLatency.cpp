@@ -0,0 +1,115 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "CueLatency.h"
+#include "../LibDef.h"
+
+// upper bounds of the histogram buckets, the last bucket is open
+static const uint32_t bucketUpper[CueLatency::BUCKET_COUNT - 1] = {
+    2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000};
+
+portMUX_TYPE CueLatency::_lock = portMUX_INITIALIZER_UNLOCKED;
+CueLatency::CueLatencyHistogram CueLatency::_histogram = {
+    .magic = {'C', 'L'},
+    .version = VERSION,
+    .bucketCount = BUCKET_COUNT,
+    .count = 0,
+    .lost = 0,
+    .lastUs = 0,
+    .minUs = UINT32_MAX,
+};
+uint8_t CueLatency::_sequence = 0;
+uint32_t CueLatency::_receiveUs[MAX_PENDING];
+
+static_assert((CueLatency::MAX_PENDING & (CueLatency::MAX_PENDING - 1)) == 0, "MAX_PENDING must be a power of 2");
+
+uint8_t CueLatency::markReceive(uint32_t receiveUs)
+{
+    portENTER_CRITICAL_SAFE(&_lock);
+    uint8_t sequence = ++_sequence;
+    _receiveUs[sequence & (MAX_PENDING - 1)] = receiveUs;
+    portEXIT_CRITICAL_SAFE(&_lock);
+    return sequence;
+}
+
+void CueLatency::record(uint8_t sequence, uint32_t renderUs)
+{
+    portENTER_CRITICAL_SAFE(&_lock);
+    uint32_t latency = renderUs - _receiveUs[sequence & (MAX_PENDING - 1)];
+
+    uint8_t i = 0;
+    while (i < dim(bucketUpper) && latency >= bucketUpper[i])
+    {
+        i++;
+    }
+    if (_histogram.bucket[i] < UINT16_MAX)
+    {
+        _histogram.bucket[i]++;
+    }
+    _histogram.count++;
+    _histogram.lastUs = latency;
+    _histogram.minUs = std::min(_histogram.minUs, latency);
+    _histogram.maxUs = std::max(_histogram.maxUs, latency);
+    portEXIT_CRITICAL_SAFE(&_lock);
+}
+
+void CueLatency::countLost(void)
+{
+    portENTER_CRITICAL_SAFE(&_lock);
+    _histogram.lost++;
+    portEXIT_CRITICAL_SAFE(&_lock);
+}
+
+void CueLatency::reset(void)
+{
+    portENTER_CRITICAL(&_lock);
+    _histogram.count = 0;
+    _histogram.lost = 0;
+    _histogram.lastUs = 0;
+    _histogram.minUs = UINT32_MAX;
+    _histogram.maxUs = 0;
+    memset(_histogram.bucket, 0, sizeof(_histogram.bucket));
+    portEXIT_CRITICAL(&_lock);
+}
+
+uint32_t CueLatency::bucketUpperUs(uint8_t i)
+{
+    return (i < dim(bucketUpper)) ? bucketUpper[i] : UINT32_MAX;
+}
+
+size_t CueLatency::read(size_t offset, uint8_t *buf, size_t len)
+{
+    if (offset >= sizeof(_histogram))
+    {
+        return 0;
+    }
+    len = std::min(len, sizeof(_histogram) - offset);
+
+    portENTER_CRITICAL_SAFE(&_lock);
+    memcpy(buf, (const uint8_t *)&_histogram + offset, len);
+    portEXIT_CRITICAL_SAFE(&_lock);
+    return len;
+}
+
+void CueLatency::write(Print &out)
+{
+    CueLatencyHistogram histogram;
+    read(0, (uint8_t *)&histogram, sizeof(histogram));
+    out.write((const uint8_t *)&histogram, sizeof(histogram));
+}
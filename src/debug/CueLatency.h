@@ -0,0 +1,73 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+
+// End-to-end latency of PlaySound: from the reception of the I2C frame to the
+// first non-silent frame rendered for it by SoundBuffer (i.e. handed to the
+// A2DP stack by the data callback). Each PlaySound gets a sequence number at
+// reception; the histogram is readable over I2C (I2cCommand::ReadLatency) or
+// written to Serial.
+class CueLatency
+{
+public:
+    static const uint8_t VERSION = 1;
+    static const uint8_t BUCKET_COUNT = 10;
+    static const uint8_t MAX_PENDING = 16; // receive timestamps kept, must be a power of 2
+
+    typedef struct __attribute__((packed)) _CueLatencyHistogram
+    {
+        char magic[2]; // "CL"
+        uint8_t version;
+        uint8_t bucketCount;
+        uint32_t count;               // measured cues
+        uint32_t lost;                // cues replaced before being rendered
+        uint32_t lastUs;
+        uint32_t minUs;
+        uint32_t maxUs;
+        uint16_t bucket[BUCKET_COUNT]; // saturating counts, upper bounds in bucketUpperUs()
+    } CueLatencyHistogram;
+
+    // called on I2C reception, returns the sequence number of the cue
+    static uint8_t markReceive(uint32_t receiveUs);
+    // called by the render callback on the first non-silent frame of cue "sequence"
+    static void record(uint8_t sequence, uint32_t renderUs);
+    static void countLost(void);
+    // clears the histogram, the pending sequence numbers are kept
+    static void reset(void);
+
+    // upper bound (exclusive) of bucket i in us, UINT32_MAX for the last one
+    static uint32_t bucketUpperUs(uint8_t i);
+
+    // copies up to len bytes of the histogram from offset, returns number of bytes copied
+    static size_t read(size_t offset, uint8_t *buf, size_t len);
+    static void write(Print &out);
+
+    static constexpr size_t size(void)
+    {
+        return sizeof(CueLatencyHistogram);
+    }
+
+private:
+    static portMUX_TYPE _lock;
+    static CueLatencyHistogram _histogram;
+    static uint8_t _sequence;
+    static uint32_t _receiveUs[MAX_PENDING];
+};
@@ -0,0 +1,141 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <new>
+#include "HeapMonitor.h"
+#include "../ArduProf.h"
+
+volatile bool HeapMonitor::_initDone = false;
+std::atomic<uint32_t> HeapMonitor::_allocCount(0);
+std::atomic<uint32_t> HeapMonitor::_freeCount(0);
+std::atomic<uint32_t> HeapMonitor::_allocCountAfterInit(0);
+std::atomic<uint32_t> HeapMonitor::_allocBytesAfterInit(0);
+uint32_t HeapMonitor::_reportedCountAfterInit = 0;
+uint32_t HeapMonitor::_minFreeHeapAtInit = 0;
+
+void HeapMonitor::markInitDone(void)
+{
+    _minFreeHeapAtInit = xPortGetMinimumEverFreeHeapSize();
+    _initDone = true;
+    LOG_DEBUG("allocCount=", allocCount(), ", freeCount=", freeCount(), ", minFreeHeap=", _minFreeHeapAtInit,
+              " (operator new only, malloc such as libhelix in Mp3Cache is not counted)");
+}
+
+void HeapMonitor::check(void)
+{
+    if (!_initDone)
+    {
+        return;
+    }
+
+    uint32_t count = _allocCountAfterInit;
+    if (count != _reportedCountAfterInit)
+    {
+        LOG_WARN("operator new after init: count=", count, ", bytes=", _allocBytesAfterInit.load());
+        _reportedCountAfterInit = count;
+    }
+
+    uint32_t minFreeHeap = xPortGetMinimumEverFreeHeapSize();
+    if (minFreeHeap < _minFreeHeapAtInit)
+    {
+        // also catches malloc, e.g. the libhelix buffers of an MP3 decode, but not a block reused below the minimum
+        LOG_WARN("heap used after init (malloc included): min free heap dropped by ", _minFreeHeapAtInit - minFreeHeap, " bytes");
+        _minFreeHeapAtInit = minFreeHeap;
+    }
+}
+
+void IRAM_ATTR HeapMonitor::onAlloc(size_t size)
+{
+    // no logging here: the logger itself may allocate
+    _allocCount++;
+    if (_initDone)
+    {
+        _allocCountAfterInit++;
+        _allocBytesAfterInit += size;
+#ifdef HEAP_MONITOR_ASSERT
+        configASSERT(false);
+#endif
+    }
+}
+
+void IRAM_ATTR HeapMonitor::onFree(void)
+{
+    _freeCount++;
+}
+
+#ifdef HEAP_MONITOR
+/////////////////////////////////////////////////////////////////////////////
+// replacement of the global operator new/delete
+/////////////////////////////////////////////////////////////////////////////
+void *operator new(size_t size)
+{
+    HeapMonitor::onAlloc(size);
+    void *ptr = malloc(size);
+    configASSERT(ptr);
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    HeapMonitor::onAlloc(size);
+    void *ptr = malloc(size);
+    configASSERT(ptr);
+    return ptr;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    HeapMonitor::onAlloc(size);
+    return malloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    HeapMonitor::onAlloc(size);
+    return malloc(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr)
+    {
+        HeapMonitor::onFree();
+        free(ptr);
+    }
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    if (ptr)
+    {
+        HeapMonitor::onFree();
+        free(ptr);
+    }
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    operator delete[](ptr);
+}
+#endif
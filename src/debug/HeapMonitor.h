@@ -0,0 +1,70 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "../LibDef.h"
+
+// Heap accounting for the "zero heap after init" rule, enabled by HEAP_MONITOR
+// in LibDef.h. Every operator new/delete is counted; once markInitDone() has
+// been called, any further operator new is reported by check(), or asserted
+// right away with HEAP_MONITOR_ASSERT. Plain malloc and heap_caps_malloc cannot
+// be hooked on this SDK (no heap hooks in the Arduino-ESP32 2.x build of
+// ESP-IDF 4.4): the libhelix buffers of Mp3Cache and the Bluetooth stack are
+// not counted, they only show as a drop of the minimum ever free heap, which
+// check() reports too. The counts are therefore a lower bound.
+class HeapMonitor
+{
+public:
+    static void markInitDone(void);
+    static bool isInitDone(void)
+    {
+        return _initDone;
+    }
+
+    // logs heap activity since init done, call periodically from a low priority thread
+    static void check(void);
+
+    static uint32_t allocCount(void)
+    {
+        return _allocCount;
+    }
+    static uint32_t freeCount(void)
+    {
+        return _freeCount;
+    }
+    static uint32_t allocCountAfterInit(void)
+    {
+        return _allocCountAfterInit;
+    }
+
+    // called by the operator new/delete hooks
+    static void onAlloc(size_t size);
+    static void onFree(void);
+
+private:
+    static volatile bool _initDone;
+    static std::atomic<uint32_t> _allocCount;
+    static std::atomic<uint32_t> _freeCount;
+    static std::atomic<uint32_t> _allocCountAfterInit;
+    static std::atomic<uint32_t> _allocBytesAfterInit;
+    static uint32_t _reportedCountAfterInit;
+    static uint32_t _minFreeHeapAtInit;
+};
@@ -0,0 +1,238 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "RenderCheck.h"
+#include "../LibDef.h"
+#include "../data/SoundBuffer.h"
+#include "../debug/CueLatency.h"
+#include "./RenderCheckGolden.h"
+#include <new>
+
+uint32_t RenderCheck::fnv1a(uint32_t hash, const uint8_t *data, size_t len)
+{
+    while (len-- > 0)
+    {
+        hash = (hash ^ *data++) * 16777619UL;
+    }
+    return hash;
+}
+
+#ifdef RENDER_CHECK
+
+typedef struct _Scenario
+{
+    const char *name;
+    uint8_t sound;  // PlaySound pattern, see I2cParam::Sound
+    uint8_t volume; // PlaySound volume
+    uint8_t cue;    // PlayAt cue at frame, CueNone for none
+    uint32_t frame;
+    const I2cParam::Timeline *timeline; // PlayTimeline instead of the pattern, nullptr for none
+    const I2cParam::Pattern *pattern;   // DefinePattern and PlayPattern instead of the pattern, nullptr for none
+    uint8_t repeat;                     // PlayPattern repeat
+    uint8_t nextSound;                  // second PlaySound, half way through the render, 0 for none
+} Scenario;
+
+static const I2cParam::Timeline timeline = {
+    .sequence = 1,
+    .repeat = 2,
+    .slotCount = 3,
+    .slot = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100},
+        {.cue = I2cParam::CueEdgePool, .gain = 50},
+        {.cue = I2cParam::CueError, .gain = 100},
+    },
+};
+
+// the timeline above as a pattern, must render the same PCM
+static const I2cParam::Pattern timelinePattern = {
+    .id = 0,
+    .stepCount = 3,
+    .step = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100, .duration = 10, .repeat = 1},
+        {.cue = I2cParam::CueEdgePool, .gain = 50, .duration = 10, .repeat = 1},
+        {.cue = I2cParam::CueError, .gain = 100, .duration = 10, .repeat = 1},
+    },
+};
+
+// patterns of increasing complexity: 1 event, 5 events, 29 events
+static const I2cParam::Pattern pattern1 = {
+    .id = 1,
+    .stepCount = 1,
+    .step = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100, .duration = 10, .repeat = 1},
+    },
+};
+
+static const I2cParam::Pattern pattern4 = {
+    .id = 2,
+    .stepCount = 4,
+    .step = {
+        {.cue = I2cParam::CueLaneLeft, .gain = 100, .duration = 5, .repeat = 1},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 7, .repeat = 1},
+        {.cue = I2cParam::CueEdgePool, .gain = 60, .duration = 15, .repeat = 1},
+        {.cue = I2cParam::CueError, .gain = 100, .duration = 10, .repeat = 1},
+    },
+};
+
+static const I2cParam::Pattern pattern16 = {
+    .id = 3,
+    .stepCount = 16,
+    .step = {
+        {.cue = I2cParam::CueEdgePool, .gain = 100, .duration = 3, .repeat = 4},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 2, .repeat = 1},
+        {.cue = I2cParam::CueLaneLeft, .gain = 80, .duration = 10, .repeat = 1},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 5, .repeat = 1},
+        {.cue = I2cParam::CueLaneMiddle, .gain = 100, .duration = 12, .repeat = 1},
+        {.cue = I2cParam::CueLaneRight, .gain = 50, .duration = 4, .repeat = 2},
+        {.cue = I2cParam::CueError, .gain = 100, .duration = 2, .repeat = 1},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 1, .repeat = 1},
+        {.cue = I2cParam::CueEdgePool, .gain = 30, .duration = 2, .repeat = 3},
+        {.cue = I2cParam::CueLaneLeft, .gain = 100, .duration = 6, .repeat = 1},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 1, .repeat = 2},
+        {.cue = I2cParam::CueLaneMiddle, .gain = 70, .duration = 1, .repeat = 2},
+        {.cue = I2cParam::CueLaneRight, .gain = 100, .duration = 2, .repeat = 5},
+        {.cue = I2cParam::CueError, .gain = 90, .duration = 11, .repeat = 1},
+        {.cue = I2cParam::CueEdgePool, .gain = 100, .duration = 1, .repeat = 1},
+        {.cue = I2cParam::CueNone, .gain = 100, .duration = 3, .repeat = 1},
+    },
+};
+
+static const Scenario scenarios[] = {
+    {"silence", 0x00, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"laneLeft", 0x01, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"laneMiddle", 0x02, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"laneRight", 0x04, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"edgeTop", 0x08, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"edgeBottom", 0x10, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"lostConnection", 0x20, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"left+edge", 0x09, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"left+middle+error", 0x23, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"all", 0x3f, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"volume 0", 0x02, 0, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"volume 25", 0x02, 25, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"volume 50", 0x02, 50, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"volume 100", 0x02, 100, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"volume 127", 0x02, 127, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0},
+    {"playAt", 0x01, 80, I2cParam::CueLaneRight, 10000, nullptr, nullptr, 0, 0},
+    {"timeline", 0x00, 80, I2cParam::CueNone, 0, &timeline, nullptr, 0, 0},
+    {"timelinePattern", 0x00, 80, I2cParam::CueNone, 0, nullptr, &timelinePattern, 2, 0},
+    {"pattern 1 step", 0x00, 80, I2cParam::CueNone, 0, nullptr, &pattern1, 0, 0},
+    {"pattern 4 steps", 0x00, 80, I2cParam::CueNone, 0, nullptr, &pattern4, 0, 0},
+    {"pattern 16 steps", 0x00, 80, I2cParam::CueNone, 0, nullptr, &pattern16, 0, 0},
+    {"left then error", 0x01, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0x20},
+    {"edge+mid then left", 0x0a, 80, I2cParam::CueNone, 0, nullptr, nullptr, 0, 0x01},
+};
+
+// the scenarios must not share state: each one gets a new SoundBuffer in this storage
+alignas(SoundBuffer) static uint8_t soundBufferStorage[sizeof(SoundBuffer)];
+static uint8_t block[RenderCheck::BLOCK_SIZE];
+
+size_t RenderCheck::scenarioCount(void)
+{
+    return dim(scenarios);
+}
+
+const char *RenderCheck::scenarioName(size_t index)
+{
+    return (index < dim(scenarios)) ? scenarios[index].name : nullptr;
+}
+
+uint32_t RenderCheck::golden(size_t index)
+{
+    return (index < dim(renderCheckGolden)) ? renderCheckGolden[index] : 0;
+}
+
+RenderCheck::Result RenderCheck::render(size_t index, Print *pcm)
+{
+    configASSERT(index < dim(scenarios));
+    const Scenario &scenario = scenarios[index];
+
+    SoundBuffer *soundBuffer = new (soundBufferStorage) SoundBuffer();
+    soundBuffer->init();
+    if (scenario.timeline)
+    {
+        soundBuffer->setTimeline(*scenario.timeline);
+    }
+    else if (scenario.pattern)
+    {
+        soundBuffer->definePattern(*scenario.pattern);
+        soundBuffer->playPattern(scenario.pattern->id, scenario.repeat);
+    }
+    else
+    {
+        soundBuffer->updateSoundSignal(scenario.sound, 0);
+    }
+    if (scenario.cue != I2cParam::CueNone)
+    {
+        soundBuffer->scheduleCue(scenario.frame, scenario.cue, I2cParam::MAX_GAIN);
+    }
+
+    // the volume control the A2DP source uses by default, through its interface like the source does
+    A2DPDefaultVolumeControl defaultVolumeControl;
+    A2DPVolumeControl &volumeControl = defaultVolumeControl;
+    volumeControl.set_volume(scenario.volume);
+    volumeControl.set_enabled(true);
+
+    // same position handling as BluetoothA2DPSource::get_data_default()
+    Result result = {.hash = FNV_OFFSET_BASIS, .frames = 0, .renderUs = 0};
+    uint32_t pos = 0;
+    for (int32_t n = 0; n < BLOCK_COUNT; n++)
+    {
+        if (n == BLOCK_COUNT / 2 && scenario.nextSound)
+        {
+            soundBuffer->updateSoundSignal(scenario.nextSound, 1);
+        }
+        uint32_t startUs = micros();
+        int32_t len = soundBuffer->read2ChannelData(pos, BLOCK_SIZE, block);
+        volumeControl.update_audio_data((Frame *)block, len / 4, soundBuffer->isMono());
+        result.renderUs += micros() - startUs;
+
+        result.hash = fnv1a(result.hash, block, len);
+        result.frames += len / sizeof(Frame);
+        if (pcm)
+        {
+            pcm->write(block, len);
+        }
+    }
+    soundBuffer->~SoundBuffer();
+
+    return result;
+}
+
+bool RenderCheck::run(Print &out)
+{
+    uint32_t passed = 0;
+    for (size_t i = 0; i < dim(scenarios); i++)
+    {
+        Result result = render(i);
+        uint32_t expected = golden(i);
+        bool isPassed = (expected == 0 || result.hash == expected);
+        passed += isPassed ? 1 : 0;
+        out.printf("render check: %-18s hash=0x%08x %s, %u frames in %u us (x%u real time)\n",
+                   scenarios[i].name, result.hash, (expected == 0) ? "--" : (isPassed ? "OK" : "FAIL"), result.frames, result.renderUs,
+                   result.renderUs ? (uint32_t)((uint64_t)result.frames * 1000000 / SoundBuffer::SAMPLING_RATE / result.renderUs) : 0);
+    }
+    out.printf("render check: %u/%u passed\n", passed, (uint32_t)dim(scenarios));
+
+    // the scenarios went through the PlaySound latency tracking
+    CueLatency::reset();
+
+    return passed == dim(scenarios);
+}
+#endif
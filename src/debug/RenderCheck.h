@@ -0,0 +1,60 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+
+// Golden-PCM check of the render pipeline, enabled by RENDER_CHECK in LibDef.h.
+// Each scenario is rendered off-air through a private SoundBuffer and the
+// default A2DP volume control, in the block size and with the position
+// handling of BluetoothA2DPSource, and the FNV-1a hash of the PCM is compared
+// with the golden one. The render time of each scenario is reported too, so
+// the output doubles as the throughput baseline of the render path.
+//
+// The golden hashes ("./RenderCheckGolden.h") are written by the host build of
+// this check, see "../../host/tools/render_check.cpp".
+class RenderCheck
+{
+public:
+    static const int32_t BLOCK_SIZE = 512; // bytes per data callback, as requested by the A2DP stack
+    static const int32_t BLOCK_COUNT = 420; // ~1.2s, crosses the 0.5s cycle boundary twice
+
+    // renders all scenarios and writes one line per scenario, returns true if all hashes match;
+    // must run before the A2DP source is started and before any I2C command is received
+    static bool run(Print &out);
+
+    static size_t scenarioCount(void);
+    static const char *scenarioName(size_t index);
+    // golden hash of the scenario, 0 if it has none yet
+    static uint32_t golden(size_t index);
+
+    typedef struct _Result
+    {
+        uint32_t hash;     // FNV-1a of the PCM
+        uint32_t frames;   // frames rendered
+        uint32_t renderUs; // time spent in the data callbacks
+    } Result;
+
+    // renders one scenario, the PCM is written to pcm unless it is nullptr
+    static Result render(size_t index, Print *pcm = nullptr);
+
+    static uint32_t fnv1a(uint32_t hash, const uint8_t *data, size_t len);
+
+    static const uint32_t FNV_OFFSET_BASIS = 2166136261UL;
+};
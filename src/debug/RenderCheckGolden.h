@@ -0,0 +1,30 @@
+// generated by host/tools/render_check.cpp (render_check --golden), do not edit
+#pragma once
+#include <Arduino.h>
+
+// FNV-1a hash of the PCM of each RenderCheck scenario, in the order of the scenario table
+static const uint32_t renderCheckGolden[] = {
+    0x40ef3dc5, // silence
+    0x7aeb5bd5, // laneLeft
+    0xbd2aef25, // laneMiddle
+    0xe3b3fe6d, // laneRight
+    0xcbfff575, // edgeTop
+    0xcbfff575, // edgeBottom
+    0x007d0c75, // lostConnection
+    0xe1789225, // left+edge
+    0xe58421d5, // left+middle+error
+    0xf5ca5565, // all
+    0x40ef3dc5, // volume 0
+    0x0acc1789, // volume 25
+    0x09b0a63d, // volume 50
+    0xa9ebd0d5, // volume 100
+    0x2a502729, // volume 127
+    0xf33735b1, // playAt
+    0x4915a985, // timeline
+    0x4915a985, // timelinePattern
+    0x9f4b20fd, // pattern 1 step
+    0xf0163e65, // pattern 4 steps
+    0xd290adb1, // pattern 16 steps
+    0x6bfa4ead, // left then error
+    0x37bf42cd, // edge+mid then left
+};
@@ -0,0 +1,53 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "SerialLock.h"
+#include "../LibLog.h"
+
+StaticSemaphore_t SerialLock::_mutexBuffer;
+SemaphoreHandle_t SerialLock::_mutex = nullptr;
+
+void SerialLock::init(void)
+{
+    _mutex = xSemaphoreCreateMutexStatic(&_mutexBuffer);
+    configASSERT(_mutex);
+}
+
+void SerialLock::beginDump(void)
+{
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    // a LOG_xxx already past its level check may still finish its line before the dump
+    LOG_SET_LEVEL(DebugLogLevel::LVL_NONE);
+}
+
+void SerialLock::endDump(void)
+{
+    LOG_SET_LEVEL(DefaultLogLevel);
+    xSemaphoreGive(_mutex);
+}
+
+bool SerialLock::tryLock(void)
+{
+    return xSemaphoreTake(_mutex, 0) == pdTRUE;
+}
+
+void SerialLock::unlock(void)
+{
+    xSemaphoreGive(_mutex);
+}
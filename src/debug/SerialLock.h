@@ -0,0 +1,45 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+
+// Serialises the binary dumps written by loop() with the text written to the
+// same serial port by other tasks. While a dump is written TraceLog::drain()
+// is skipped and DebugLog output (LOG_xxx) is turned off, so that no text is
+// interleaved with the binary records.
+class SerialLock
+{
+public:
+    // must be called once before the tasks are created
+    static void init(void);
+
+    // held by loop() for a whole binary dump, waits for a drain in progress
+    static void beginDump(void);
+    static void endDump(void);
+
+    // held around TraceLog::drain(), returns false while a dump is written:
+    // the drain is skipped then, the records stay in the ring
+    static bool tryLock(void);
+    static void unlock(void);
+
+private:
+    static StaticSemaphore_t _mutexBuffer;
+    static SemaphoreHandle_t _mutex;
+};
@@ -0,0 +1,191 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "TaskProfiler.h"
+
+#define MAX_SYSTEM_TASKS 24 // size of the uxTaskGetSystemState() buffer
+
+#define PROFILE_RUN_TIME_STATS ((configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1))
+
+StaticSemaphore_t TaskProfiler::_mutexBuffer;
+SemaphoreHandle_t TaskProfiler::_mutex = xSemaphoreCreateMutexStatic(&TaskProfiler::_mutexBuffer);
+portMUX_TYPE TaskProfiler::_lock = portMUX_INITIALIZER_UNLOCKED;
+TaskProfiler::Task TaskProfiler::_task[MAX_TASKS];
+TaskProfiler::TaskProfileSnapshot TaskProfiler::_snapshot = {
+    .magic = {'T', 'P'},
+    .version = VERSION,
+};
+
+#if PROFILE_RUN_TIME_STATS
+static TaskStatus_t systemState[MAX_SYSTEM_TASKS];
+static uint32_t lastTotalRunTime;
+static uint32_t lastIdleRunTime[2];
+#endif
+
+static uint16_t toPermille(uint32_t part, uint32_t total)
+{
+    return total ? (uint16_t)std::min<uint64_t>(1000, (uint64_t)part * 1000 / total) : 0;
+}
+
+int TaskProfiler::find(TaskHandle_t handle)
+{
+    for (int i = 0; i < _snapshot.taskCount; i++)
+    {
+        if (_task[i].handle == handle)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool TaskProfiler::add(TaskHandle_t handle, uint32_t stackSize)
+{
+    if (handle == nullptr)
+    {
+        return false;
+    }
+
+    bool result = false;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    if (find(handle) < 0 && _snapshot.taskCount < MAX_TASKS)
+    {
+        int index = _snapshot.taskCount;
+        _task[index].handle = handle;
+        _task[index].lastRunTime = 0;
+
+        TaskProfileEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        strncpy(entry.name, pcTaskGetTaskName(handle), sizeof(entry.name));
+        entry.stackSize = stackSize;
+        entry.alive = 1;
+
+        // the entry is complete before the count makes it visible
+        portENTER_CRITICAL(&_lock);
+        _snapshot.task[index] = entry;
+        _snapshot.taskCount = index + 1;
+        portEXIT_CRITICAL(&_lock);
+        result = true;
+    }
+    xSemaphoreGive(_mutex);
+    return result;
+}
+
+void TaskProfiler::remove(TaskHandle_t handle)
+{
+    uint32_t stackFree = uxTaskGetStackHighWaterMark(handle);
+
+    // waits for a sample() in progress, which may still be using the handle
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    int index = find(handle);
+    if (index >= 0)
+    {
+        _task[index].handle = nullptr;
+        portENTER_CRITICAL(&_lock);
+        _snapshot.task[index].stackFree = stackFree;
+        _snapshot.task[index].cpuPermille = 0;
+        _snapshot.task[index].alive = 0;
+        portEXIT_CRITICAL(&_lock);
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void TaskProfiler::sample(void)
+{
+    TaskProfileSnapshot snapshot;
+
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&_lock);
+    snapshot = _snapshot;
+    portEXIT_CRITICAL(&_lock);
+
+    // FreeRTOS calls below must run outside the critical section, _mutex keeps the handles valid
+    snapshot.sequence++;
+    snapshot.uptimeMs = millis();
+    snapshot.freeHeap = xPortGetFreeHeapSize();
+    snapshot.minFreeHeap = xPortGetMinimumEverFreeHeapSize();
+
+    for (int i = 0; i < snapshot.taskCount; i++)
+    {
+        if (_task[i].handle)
+        {
+            snapshot.task[i].stackFree = uxTaskGetStackHighWaterMark(_task[i].handle);
+            snapshot.task[i].priority = uxTaskPriorityGet(_task[i].handle);
+        }
+    }
+
+#if PROFILE_RUN_TIME_STATS
+    uint32_t totalRunTime = 0;
+    UBaseType_t count = uxTaskGetSystemState(systemState, MAX_SYSTEM_TASKS, &totalRunTime);
+    uint32_t deltaTotal = totalRunTime - lastTotalRunTime;
+    lastTotalRunTime = totalRunTime;
+
+    for (UBaseType_t n = 0; n < count; n++)
+    {
+        const TaskStatus_t &status = systemState[n];
+        for (int i = 0; i < snapshot.taskCount; i++)
+        {
+            if (_task[i].handle == status.xHandle)
+            {
+                snapshot.task[i].cpuPermille = toPermille(status.ulRunTimeCounter - _task[i].lastRunTime, deltaTotal);
+                _task[i].lastRunTime = status.ulRunTimeCounter;
+            }
+        }
+        for (int core = 0; core < portNUM_PROCESSORS && core < 2; core++)
+        {
+            if (status.xHandle == xTaskGetIdleTaskHandleForCPU(core))
+            {
+                snapshot.idlePermille[core] = toPermille(status.ulRunTimeCounter - lastIdleRunTime[core], deltaTotal);
+                lastIdleRunTime[core] = status.ulRunTimeCounter;
+            }
+        }
+    }
+#endif
+
+    portENTER_CRITICAL(&_lock);
+    memcpy(_snapshot.task, snapshot.task, sizeof(_snapshot.task));
+    _snapshot.sequence = snapshot.sequence;
+    _snapshot.uptimeMs = snapshot.uptimeMs;
+    _snapshot.freeHeap = snapshot.freeHeap;
+    _snapshot.minFreeHeap = snapshot.minFreeHeap;
+    memcpy(_snapshot.idlePermille, snapshot.idlePermille, sizeof(_snapshot.idlePermille));
+    portEXIT_CRITICAL(&_lock);
+    xSemaphoreGive(_mutex);
+}
+
+size_t TaskProfiler::read(size_t offset, uint8_t *buf, size_t len)
+{
+    if (offset >= sizeof(_snapshot))
+    {
+        return 0;
+    }
+    len = std::min(len, sizeof(_snapshot) - offset);
+
+    portENTER_CRITICAL(&_lock);
+    memcpy(buf, (const uint8_t *)&_snapshot + offset, len);
+    portEXIT_CRITICAL(&_lock);
+    return len;
+}
+
+void TaskProfiler::write(Print &out)
+{
+    TaskProfileSnapshot snapshot;
+    read(0, (uint8_t *)&snapshot, sizeof(snapshot));
+    out.write((const uint8_t *)&snapshot, sizeof(snapshot));
+}
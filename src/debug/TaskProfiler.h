@@ -0,0 +1,91 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+
+// Samples stack high-water marks, CPU share and heap of the project tasks.
+// The result is a packed binary snapshot (TaskProfileSnapshot) which can be
+// read over I2C (I2cCommand::ReadProfile) or written to Serial.
+class TaskProfiler
+{
+public:
+    static const uint8_t VERSION = 1;
+    static const uint8_t MAX_TASKS = 6;
+    static const uint8_t TASK_NAME_LEN = 12;
+
+    typedef struct __attribute__((packed)) _TaskProfileEntry
+    {
+        char name[TASK_NAME_LEN]; // zero padded, not necessarily zero terminated
+        uint32_t stackSize;       // in bytes, as passed to xTaskCreate
+        uint32_t stackFree;       // stack high-water mark in bytes (smallest ever free)
+        uint16_t cpuPermille;     // share of one core since the previous sample, 0 if unavailable
+        uint8_t priority;
+        uint8_t alive; // 0 once the task has deleted itself, the entry keeps its last values
+    } TaskProfileEntry;
+
+    typedef struct __attribute__((packed)) _TaskProfileSnapshot
+    {
+        char magic[2]; // "TP"
+        uint8_t version;
+        uint8_t taskCount;
+        uint16_t sequence; // incremented on every sample
+        uint16_t reserved;
+        uint32_t uptimeMs;
+        uint32_t freeHeap;
+        uint32_t minFreeHeap;
+        uint16_t idlePermille[2]; // per core idle share since the previous sample
+        TaskProfileEntry task[MAX_TASKS];
+    } TaskProfileSnapshot;
+
+    // registers a task; call from the task creating it
+    static bool add(TaskHandle_t handle, uint32_t stackSize);
+    // records the final high-water mark of a task about to delete itself
+    static void remove(TaskHandle_t handle);
+
+    // refreshes the snapshot; call periodically from a low priority thread
+    static void sample(void);
+
+    // copies up to len bytes of the snapshot from offset, returns number of bytes copied
+    static size_t read(size_t offset, uint8_t *buf, size_t len);
+    static void write(Print &out);
+
+    static constexpr size_t size(void)
+    {
+        return sizeof(TaskProfileSnapshot);
+    }
+
+private:
+    typedef struct _Task
+    {
+        TaskHandle_t handle;
+        uint32_t lastRunTime;
+    } Task;
+
+    // _mutex guards _task and is held by sample() across the FreeRTOS calls on the
+    // handles, so that a task cannot be removed and deleted meanwhile; _lock guards
+    // _snapshot, which is also read from the I2C callback
+    static StaticSemaphore_t _mutexBuffer;
+    static SemaphoreHandle_t _mutex;
+    static portMUX_TYPE _lock;
+    static Task _task[MAX_TASKS];
+    static TaskProfileSnapshot _snapshot;
+
+    static int find(TaskHandle_t handle);
+};
@@ -0,0 +1,139 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "TraceLog.h"
+#include "../LibDef.h"
+
+#define RING_MASK (TraceLog::RING_SIZE - 1)
+
+#define TRACE_FORMAT_STRING(id, format) format,
+static const char *const traceFormat[] = {TRACE_FORMAT_LIST(TRACE_FORMAT_STRING)};
+#undef TRACE_FORMAT_STRING
+
+static_assert((TraceLog::RING_SIZE & RING_MASK) == 0, "RING_SIZE must be a power of 2");
+static_assert(sizeof(TraceLog::TraceRecord) == 24, "TraceRecord layout is shared with tools/trace_decode.py");
+static_assert(dim(traceFormat) == TraceIdCount, "one format string per TraceId");
+
+TraceLog::TraceRecord TraceLog::_ring[RING_SIZE];
+std::atomic<uint32_t> TraceLog::_head(0);
+uint32_t TraceLog::_tail = 0;
+uint32_t TraceLog::_dropped = 0;
+
+void IRAM_ATTR TraceLog::log(uint16_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2)
+{
+    uint32_t position = _head.fetch_add(1, std::memory_order_relaxed);
+    TraceRecord &record = _ring[position & RING_MASK];
+
+    // sequence 0 tells the reader that the record is being written
+    __atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    record.timestamp = micros();
+    record.id = id;
+    record.arg[0] = arg0;
+    record.arg[1] = arg1;
+    record.arg[2] = arg2;
+
+    __atomic_store_n(&record.sequence, position + 1, __ATOMIC_RELEASE);
+}
+
+TraceLog::Slot TraceLog::copy(uint32_t position, TraceRecord &record)
+{
+    const TraceRecord &slot = _ring[position & RING_MASK];
+    uint32_t sequence = __atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE);
+    if (sequence != position + 1)
+    {
+        // an older sequence means the writer of this position has not finished yet
+        return (sequence == 0 || (int32_t)(sequence - (position + 1)) < 0) ? SlotPending : SlotLost;
+    }
+
+    record = slot;
+
+    // a writer may have lapped the ring while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (__atomic_load_n(&slot.sequence, __ATOMIC_RELAXED) == sequence) ? SlotReady : SlotLost;
+}
+
+size_t TraceLog::drain(Print &out, size_t maxRecords)
+{
+    size_t count = 0;
+    uint32_t head = _head.load(std::memory_order_acquire);
+    if (head - _tail > RING_SIZE)
+    {
+        _dropped += head - _tail - RING_SIZE;
+        _tail = head - RING_SIZE;
+    }
+
+    while (_tail != head && count < maxRecords)
+    {
+        TraceRecord record;
+        Slot slot = copy(_tail, record);
+        if (slot == SlotPending)
+        {
+            break; // retry on the next drain
+        }
+
+        if (slot == SlotLost)
+        {
+            _dropped++;
+        }
+        else
+        {
+            out.printf("[T %u.%06u] ", (unsigned)(record.timestamp / 1000000), (unsigned)(record.timestamp % 1000000));
+            if (record.id < TraceIdCount)
+            {
+                out.printf(traceFormat[record.id], (unsigned)record.arg[0], (unsigned)record.arg[1], (unsigned)record.arg[2]);
+            }
+            else
+            {
+                out.printf("unknown id=%u", (unsigned)record.id);
+            }
+            out.println();
+            count++;
+        }
+        _tail++;
+    }
+    return count;
+}
+
+void TraceLog::write(Print &out)
+{
+    uint32_t head = _head.load(std::memory_order_acquire);
+    uint32_t count = std::min<uint32_t>(head, RING_SIZE);
+
+    TraceDumpHeader header = {
+        .magic = {'T', 'L'},
+        .version = VERSION,
+        .recordSize = sizeof(TraceRecord),
+        .count = (uint16_t)count,
+        .reserved = 0,
+        .dropped = _dropped,
+    };
+    out.write((const uint8_t *)&header, sizeof(header));
+
+    for (uint32_t position = head - count; position != head; position++)
+    {
+        TraceRecord record;
+        if (copy(position, record) != SlotReady)
+        {
+            memset(&record, 0, sizeof(record));
+        }
+        out.write((const uint8_t *)&record, sizeof(record));
+    }
+}
@@ -0,0 +1,113 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include "../LibLog.h"
+
+// Format strings of the trace records, the record id is the position in this
+// list. tools/trace_decode.py parses it to decode dumps: keep one X() per line.
+#define TRACE_FORMAT_LIST(X)                                                                    \
+    X(TraceNull, "")                                                                            \
+    X(TraceI2cIsA2dpConnected, "I2cCommand::IsA2dpConnected: reply=%u")                         \
+    X(TraceI2cPlaySound, "I2cCommand::PlaySound: paramVolume=%u, paramSound=(hex)%x, reply=%u") \
+    X(TraceI2cError, "I2C error: command=%u, len=%u, reply=%u")                                 \
+    X(TraceSoundSignal, "updateSoundSignal: sound=(hex)%x")                                     \
+    X(TracePlayTimeline, "I2cCommand::PlayTimeline: reply=%u")                                  \
+    X(TraceScheduleCue, "scheduleCue: cue=%u, frame=%u, streamFrame=%u")
+
+#define TRACE_FORMAT_ID(id, format) id,
+enum TraceId : uint16_t
+{
+    TRACE_FORMAT_LIST(TRACE_FORMAT_ID)
+        TraceIdCount,
+};
+#undef TRACE_FORMAT_ID
+
+// Deferred binary logging for latency-sensitive paths (Wire callbacks, audio).
+// TraceLog::log() only stores {timestamp, format id, args} into a lock-free
+// ring and is safe to call from any task or ISR on either core. The records are
+// formatted later by drain(), called periodically from a low priority thread.
+// When the ring overflows the oldest records are overwritten and counted as
+// dropped.
+class TraceLog
+{
+public:
+    static const uint8_t VERSION = 1;
+    static const uint8_t MAX_ARGS = 3;
+    static const uint16_t RING_SIZE = 128; // must be a power of 2
+
+    // naturally aligned (24 bytes, no padding) so that sequence can be accessed atomically
+    typedef struct _TraceRecord
+    {
+        uint32_t sequence;  // position in the log + 1, 0 while being written
+        uint32_t timestamp; // micros()
+        uint16_t id;        // TraceId
+        uint16_t reserved;
+        uint32_t arg[MAX_ARGS];
+    } TraceRecord;
+
+    // header of the binary dump, followed by "count" TraceRecord in log order;
+    // records with sequence 0 were being written or overwritten and must be skipped
+    typedef struct __attribute__((packed)) _TraceDumpHeader
+    {
+        char magic[2]; // "TL"
+        uint8_t version;
+        uint8_t recordSize;
+        uint16_t count;
+        uint16_t reserved;
+        uint32_t dropped;
+    } TraceDumpHeader;
+
+    static void IRAM_ATTR log(uint16_t id, uint32_t arg0 = 0, uint32_t arg1 = 0, uint32_t arg2 = 0);
+
+    // formats up to maxRecords pending records to out, returns number of records printed.
+    // Single consumer: call from one thread only
+    static size_t drain(Print &out, size_t maxRecords = RING_SIZE);
+
+    // writes the records still in the ring as a binary dump, does not consume them
+    static void write(Print &out);
+
+    static uint32_t dropped(void)
+    {
+        return _dropped;
+    }
+
+private:
+    typedef enum _Slot
+    {
+        SlotReady,
+        SlotPending, // not written yet, or a writer is still busy on it
+        SlotLost,    // overwritten by a newer record
+    } Slot;
+
+    static TraceRecord _ring[RING_SIZE];
+    static std::atomic<uint32_t> _head; // next position to be written
+    static uint32_t _tail;              // next position to be drained
+    static uint32_t _dropped;
+
+    static Slot copy(uint32_t position, TraceRecord &record);
+};
+
+#ifdef DEBUGLOG_DISABLE_LOG
+#define TRACE(id, ...)
+#else
+#define TRACE(id, ...) TraceLog::log(id, ##__VA_ARGS__)
+#endif
@@ -59,6 +59,23 @@ class A2DPVolumeControl {
             }
         }
 
+        // isMono: both channels of every frame are identical (a mono source), so
+        // only the first one is processed and copied to the second one; the
+        // downmix of identical channels is a no-op
+        virtual void update_audio_data(Frame* data, uint16_t frameCount, bool isMono) {
+            if (!isMono) {
+                update_audio_data(data, frameCount);
+                return;
+            }
+            if (data!=nullptr && frameCount>0 && is_volume_used) {
+                for (int i=0;i<frameCount;i++){
+                    int16_t pcm = (int32_t)data[i].channel1 * volumeFactor / volumeFactorMax;
+                    data[i].channel1 = pcm;
+                    data[i].channel2 = pcm;
+                }
+            }
+        }
+
         // provides a factor in the range of 0 to 4096
         int32_t get_volume_factor() {
             return volumeFactor;
@@ -140,6 +157,8 @@ class A2DPNoVolumeControl : public A2DPVolumeControl {
     public:
         virtual void update_audio_data(Frame* data, uint16_t frameCount) override {
         }
+        virtual void update_audio_data(Frame* data, uint16_t frameCount, bool isMono) override {
+        }
         virtual void set_volume(uint8_t volume) override {
         }
 };
\ No newline at end of file
@@ -14,12 +14,14 @@
 // Copyright 2015-2016 Espressif Systems (Shanghai) PTE LTD
 
 #include "BluetoothA2DPSource.h"
+#include "../../../base/type/BlockPool.h"
 
 #define BT_APP_SIG_WORK_DISPATCH            (0x01)
 #define BT_APP_SIG_WORK_DISPATCH            (0x01)
 
 #define APP_RC_CT_TL_RN_VOLUME_CHANGE       (1)
 #define BT_APP_HEART_BEAT_EVT               (0xff00)
+#define BT_APP_HEART_BEAT_PERIOD_MS         (10000)
 
 /* event for handler "bt_av_hdl_stack_up */
 enum {
@@ -48,6 +50,22 @@ enum {
 
 BluetoothA2DPSource *self_BluetoothA2DPSource;
 
+// static storage for the parameters of bt_app_work_dispatch()
+#define BT_APP_PARAM_SIZE (sizeof(esp_a2d_cb_param_t) > sizeof(esp_avrc_ct_cb_param_t) ? sizeof(esp_a2d_cb_param_t) : sizeof(esp_avrc_ct_cb_param_t))
+#define BT_APP_PARAM_COUNT 16
+typedef BlockPool<BT_APP_PARAM_SIZE, BT_APP_PARAM_COUNT> BtAppParamPool;
+static BtAppParamPool bt_app_param_pool;
+
+// returns a parameter copy of bt_app_work_dispatch() to the pool or to the heap
+static void bt_app_free_param(void *param) {
+    BtAppParamPool::Handle handle = bt_app_param_pool.handleOf(param);
+    if (bt_app_param_pool.isValid(handle)) {
+        bt_app_param_pool.release(handle);
+    } else {
+        free(param);
+    }
+}
+
 extern "C" void ccall_bt_av_hdl_stack_evt(uint16_t event, void *p_param){
     if (self_BluetoothA2DPSource) self_BluetoothA2DPSource->bt_av_hdl_stack_evt(event,p_param);
 }
@@ -64,10 +82,6 @@ extern "C" void ccall_bt_app_rc_ct_cb(esp_avrc_ct_cb_event_t event, esp_avrc_ct_
     if (self_BluetoothA2DPSource) self_BluetoothA2DPSource->bt_app_rc_ct_cb(event, param);
 }
 
-extern "C" void ccall_a2d_app_heart_beat(void *arg) {
-    if(self_BluetoothA2DPSource) self_BluetoothA2DPSource->a2d_app_heart_beat(arg);
-}
-
 extern "C" void ccall_bt_app_a2d_cb(esp_a2d_cb_event_t event, esp_a2d_cb_param_t *param){
     if (self_BluetoothA2DPSource) self_BluetoothA2DPSource->bt_app_a2d_cb(event, param);
 }
@@ -86,9 +100,14 @@ extern "C" int32_t ccall_bt_app_a2d_data_cb(uint8_t *data, int32_t len){
         return 0;
     }
     int32_t result = (*(self_BluetoothA2DPSource->data_stream_callback))(data, len);
+    if (result < len) {
+        // the source ran dry: get_data_default() fills the block while looped data plays.
+        // Only written by the A2DP data callback, readers tolerate a stale value
+        self_BluetoothA2DPSource->underrun_count = self_BluetoothA2DPSource->underrun_count + 1;
+    }
     // adapt volume
     if (result > 0 && self_BluetoothA2DPSource->is_volume_used){
-        self_BluetoothA2DPSource->volume_control()->update_audio_data((Frame*)data, result/4);
+        self_BluetoothA2DPSource->volume_control()->update_audio_data((Frame*)data, result/4, self_BluetoothA2DPSource->is_data_mono);
     }
     return result;
 }
@@ -145,32 +164,45 @@ void BluetoothA2DPSource::set_pin_code(const char *pin_code, esp_bt_pin_type_t p
 }
 
 void BluetoothA2DPSource::start(const char* name, music_data_channels_cb_t callback) {
-    std::vector<const char*> names = {name};
-    start(names, callback);
+    start(&name, 1, callback);
+}
+
+void BluetoothA2DPSource::start(const std::vector<const char*> &names, music_data_channels_cb_t callback) {
+    start(names.data(), names.size(), callback);
 }
 
-void BluetoothA2DPSource::start(std::vector<const char*> names, music_data_channels_cb_t callback) {
+void BluetoothA2DPSource::start(const char* const* names, int count, music_data_channels_cb_t callback) {
     ESP_LOGD(BT_APP_TAG, "%s, ", __func__);
     if (callback!=NULL){
         // we use the indicated callback
         this->data_stream_channels_callback = callback;
-        start_raw(names, ccall_get_channel_data_wrapper);
+        start_raw(names, count, ccall_get_channel_data_wrapper);
     } else {
         // we use the callback which supports write_data
-        start_raw(names, ccall_get_data_default);
+        start_raw(names, count, ccall_get_data_default);
     }
 }
 
 void BluetoothA2DPSource::start_raw(const char* name, music_data_cb_t callback) {
-    std::vector<const char*> names = {name};
-    start_raw(names, callback);
+    start_raw(&name, 1, callback);
 }
 
+void BluetoothA2DPSource::start_raw(const std::vector<const char*> &names, music_data_cb_t callback) {
+    start_raw(names.data(), names.size(), callback);
+}
 
-void BluetoothA2DPSource::start_raw(std::vector<const char*> names, music_data_cb_t callback) {
+void BluetoothA2DPSource::start_raw(const char* const* names, int count, music_data_cb_t callback) {
     ESP_LOGD(BT_APP_TAG, "%s, ", __func__);
-    this->bt_names = names;
+    if (count > MAX_BT_NAMES) {
+        ESP_LOGW(BT_APP_TAG, "%s only the first %d names are used", __func__, MAX_BT_NAMES);
+        count = MAX_BT_NAMES;
+    }
+    for (int j=0; j<count; j++) {
+        this->bt_names[j] = names[j];
+    }
+    this->bt_names_count = count;
     this->data_stream_callback = callback;
+    this->is_data_mono = false; // only known for get_data_default()
     is_autoreconnect_allowed = true;
     
     // get last connection if not available
@@ -259,13 +291,22 @@ bool BluetoothA2DPSource::bt_app_work_dispatch(bt_app_cb_t p_cback, uint16_t eve
     if (param_len == 0) {
         return bt_app_send_msg(&msg);
     } else if (p_params && param_len > 0) {
-        if ((msg.param = malloc(param_len)) != NULL) {
+        // parameters are copied into the static pool, the heap is only a fallback
+        msg.param = param_len <= BT_APP_PARAM_SIZE ? bt_app_param_pool.data(bt_app_param_pool.alloc()) : NULL;
+        if (msg.param == NULL) {
+            ESP_LOGW(BT_APP_TAG, "%s param pool exhausted, using heap", __func__);
+            msg.param = malloc(param_len);
+        }
+        if (msg.param != NULL) {
             memcpy(msg.param, p_params, param_len);
             /* check if caller has provided a copy callback to do the deep copy */
             if (p_copy_cback) {
                 p_copy_cback(&msg, msg.param, p_params);
             }
-            return bt_app_send_msg(&msg);
+            if (bt_app_send_msg(&msg)) {
+                return true;
+            }
+            bt_app_free_param(msg.param);
         }
     }
 
@@ -297,7 +338,12 @@ void BluetoothA2DPSource::bt_app_task_handler(void *arg)
     app_msg_t msg;
     for (;;) {
         if (s_bt_app_task_queue){
-            if (pdTRUE == xQueueReceive(s_bt_app_task_queue, &msg, (portTickType)portMAX_DELAY)) {
+            TickType_t ticks_to_wait = portMAX_DELAY;
+            if (s_heart_beat_active) {
+                int32_t remaining = (int32_t)(s_heart_beat_expiry - xTaskGetTickCount());
+                ticks_to_wait = remaining > 0 ? remaining : 0;
+            }
+            if (pdTRUE == xQueueReceive(s_bt_app_task_queue, &msg, ticks_to_wait)) {
                 ESP_LOGD(BT_APP_TAG, "%s, sig 0x%x, 0x%x", __func__, msg.sig, msg.event);
                 switch (msg.sig) {
                     case BT_APP_SIG_WORK_DISPATCH:
@@ -309,9 +355,18 @@ void BluetoothA2DPSource::bt_app_task_handler(void *arg)
                 } 
 
                 if (msg.param) {
-                    free(msg.param);
+                    bt_app_free_param(msg.param);
                 }
             }
+            // heart beat expired: we are already on the app task, so no need to dispatch
+            if (s_heart_beat_active && (int32_t)(xTaskGetTickCount() - s_heart_beat_expiry) >= 0) {
+                s_heart_beat_expiry += pdMS_TO_TICKS(BT_APP_HEART_BEAT_PERIOD_MS);
+                // after a stall longer than a period, re-arm from now instead of catching up in a burst
+                if ((int32_t)(xTaskGetTickCount() - s_heart_beat_expiry) >= 0) {
+                    s_heart_beat_expiry = xTaskGetTickCount() + pdMS_TO_TICKS(BT_APP_HEART_BEAT_PERIOD_MS);
+                }
+                bt_app_av_sm_hdlr(BT_APP_HEART_BEAT_EVT, NULL);
+            }
         } else {
             ESP_LOGE(BT_APP_TAG, "%s xQueue not available", __func__);
             delay(100);
@@ -419,7 +474,8 @@ void BluetoothA2DPSource::filter_inquiry_scan_result(esp_bt_gap_cb_param_t *para
                 found = ssid_callback((const char*)s_peer_bdname, param->disc_res.bda, rssi);
             } else {
                 // if no callback we use the list
-                for (const char* name : bt_names){
+                for (int j=0; j<bt_names_count; j++){
+                    const char* name = bt_names[j];
                     int len = strlen(name);
                     ESP_LOGI(BT_AV_TAG, "--Checking match: %s", name);
                     if (strncmp((char *)s_peer_bdname, name, len) == 0) {
@@ -570,10 +626,9 @@ void BluetoothA2DPSource::bt_av_hdl_stack_evt(uint16_t event, void *p_param)
                 esp_bt_gap_start_discovery(ESP_BT_INQ_MODE_GENERAL_INQUIRY, 10, 0);
             }
 
-            // create and start heart beat timer 
-            int tmr_id = 0;
-            s_tmr = xTimerCreate("connTmr", (10000 / portTICK_RATE_MS), pdTRUE, (void *)tmr_id, ccall_a2d_app_heart_beat);
-            xTimerStart(s_tmr, portMAX_DELAY);
+            // start heart beat: served by bt_app_task_handler()
+            s_heart_beat_expiry = xTaskGetTickCount() + pdMS_TO_TICKS(BT_APP_HEART_BEAT_PERIOD_MS);
+            s_heart_beat_active = true;
             
             break;
         }
@@ -590,12 +645,6 @@ void BluetoothA2DPSource::bt_app_a2d_cb(esp_a2d_cb_event_t event, esp_a2d_cb_par
 }
 
 
-void BluetoothA2DPSource::a2d_app_heart_beat(void *arg)
-{
-    bt_app_work_dispatch(ccall_bt_app_av_sm_hdlr, BT_APP_HEART_BEAT_EVT, NULL, 0, NULL);
-}
-
-
 void BluetoothA2DPSource::process_user_state_callbacks(uint16_t event, void *param){
     ESP_LOGD(BT_AV_TAG, "%s", __func__);
 
@@ -955,27 +1004,20 @@ bool BluetoothA2DPSource::write_data(SoundData *data){
 }
 
 int32_t BluetoothA2DPSource::get_data_default(uint8_t *data, int32_t len) {
-    uint32_t result_len;
+    int32_t result_len;
     if (has_sound_data()) {
-        result_len = sound_data->get2ChannelData(sound_data_current_pos, len, data);
-        if (result_len!=512) {
-            ESP_LOGD(BT_APP_TAG, "=> len: %d / result_len: %d", len, result_len);
-        }
-        // calculate next position
-        sound_data_current_pos+=result_len;
-        if (result_len<=0){
-            if (sound_data->doLoop()){
-                ESP_LOGD(BT_APP_TAG, "%s - end of data: restarting", __func__);
-                sound_data_current_pos = 0;            
-            } else {
-                ESP_LOGD(BT_APP_TAG, "%s - end of data: stopping", __func__);
-                has_sound_data_flag = false;
-            }
+        // looped data restarts within the block: a short block means the data ran out
+        result_len = sound_data->read2ChannelData(sound_data_current_pos, len, data);
+        is_data_mono = sound_data->isMono();
+        if (result_len < len && !sound_data->doLoop()) {
+            ESP_LOGD(BT_APP_TAG, "%s - end of data: stopping", __func__);
+            has_sound_data_flag = false;
         }
     } else {
         // return silence 
         memset(data,0,len);
         result_len = len;
+        is_data_mono = true;
     }
 
     return result_len;
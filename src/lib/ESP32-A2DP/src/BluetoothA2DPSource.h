@@ -30,7 +30,6 @@ extern "C" void ccall_bt_av_hdl_stack_evt(uint16_t event, void *p_param);
 extern "C" void ccall_bt_app_task_handler(void *arg);
 extern "C" void ccall_bt_app_gap_callback(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param);
 extern "C" void ccall_bt_app_rc_ct_cb(esp_avrc_ct_cb_event_t event, esp_avrc_ct_cb_param_t *param);
-extern "C" void ccall_a2d_app_heart_beat(void *arg) ;
 extern "C" void ccall_bt_app_a2d_cb(esp_a2d_cb_event_t event, esp_a2d_cb_param_t *param);
 extern "C" void ccall_bt_app_av_sm_hdlr(uint16_t event, void *param);
 extern "C" void ccall_bt_av_hdl_avrc_ct_evt(uint16_t event, void *param) ;
@@ -51,7 +50,6 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
   friend void ccall_bt_app_task_handler(void *arg);
   friend void ccall_bt_app_gap_callback(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param);
   friend void ccall_bt_app_rc_ct_cb(esp_avrc_ct_cb_event_t event, esp_avrc_ct_cb_param_t *param);
-  friend void ccall_a2d_app_heart_beat(void *arg) ;
   friend void ccall_bt_app_a2d_cb(esp_a2d_cb_event_t event, esp_a2d_cb_param_t *param);
   friend void ccall_bt_app_av_sm_hdlr(uint16_t event, void *param);
   friend void ccall_bt_av_hdl_avrc_ct_evt(uint16_t event, void *param) ;
@@ -97,12 +95,14 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
 
     /// Starts w/o indicating the name. Connections will be managed via set_ssid_callback()
     virtual void start(music_data_channels_cb_t callback = NULL) {
-        std::vector<const char*> names; // empty vector
-        start(names, callback);
+        start((const char* const*)nullptr, 0, callback);
     }
 
     /// starts the bluetooth source. Supports multiple alternative names
-    virtual void start(std::vector<const char*> names, music_data_channels_cb_t callback = NULL);
+    virtual void start(const std::vector<const char*> &names, music_data_channels_cb_t callback = NULL);
+
+    /// starts the bluetooth source. Supports up to MAX_BT_NAMES alternative names, no heap is used
+    virtual void start(const char* const* names, int count, music_data_channels_cb_t callback = NULL);
 
     /**
      * @brief starts the bluetooth source 
@@ -117,12 +117,14 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
 
     /// Starts w/o indicating the name. Connections will be managed via set_ssid_callback()
     virtual void start_raw(music_data_cb_t callback = NULL) {
-        std::vector<const char*> names; // empty vector
-        start_raw(names, callback);
+        start_raw((const char* const*)nullptr, 0, callback);
     }
 
     /// start_raw which supports multiple alternative names
-    virtual void start_raw(std::vector<const char*> names, music_data_cb_t callback = NULL);
+    virtual void start_raw(const std::vector<const char*> &names, music_data_cb_t callback = NULL);
+
+    /// start_raw which supports up to MAX_BT_NAMES alternative names, no heap is used
+    virtual void start_raw(const char* const* names, int count, music_data_cb_t callback = NULL);
 
 
     /// Defines the pin code. If nothing is defined we use "1234"
@@ -156,6 +158,16 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
     /// callback for data
     virtual int32_t get_data_default(uint8_t *data, int32_t len);
 
+    /// Provides the handle of the application task ("BtAppT"), nullptr before start()
+    xTaskHandle get_app_task_handle() {
+      return s_bt_app_task_handle;
+    }
+
+    /// Number of data callbacks which could not be filled completely because the data ran out (audio underruns)
+    uint32_t get_underrun_count() {
+      return underrun_count;
+    }
+
     /// Define callback to be notified about the found ssids
     void set_ssid_callback(bool(*callback)(const char*ssid, esp_bd_addr_t address, int rrsi)){
       ssid_callback = callback;
@@ -169,7 +181,9 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
     bool ssp_enabled=false;
     bool is_connecting = false;
     const char* bt_name = {0};
-    std::vector<const char*> bt_names;
+    static const int MAX_BT_NAMES = 4;
+    const char* bt_names[MAX_BT_NAMES] = {0};
+    int bt_names_count = 0;
 
     esp_bt_pin_type_t pin_type;
     esp_bt_pin_code_t pin_code;
@@ -181,13 +195,18 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
     int s_intv_cnt=0;
     int s_connecting_heatbeat_count;
     uint32_t s_pkt_cnt;
-    TimerHandle_t s_tmr;
+    // heart beat is driven by the timeout of the app task queue (no FreeRTOS timer)
+    bool s_heart_beat_active = false;
+    TickType_t s_heart_beat_expiry = 0;
     xQueueHandle s_bt_app_task_queue = nullptr;
     xTaskHandle s_bt_app_task_handle = nullptr;
+    volatile uint32_t underrun_count = 0;
     // support for raw data
     SoundData *sound_data = nullptr;
-    int32_t sound_data_current_pos = 0;
+    uint32_t sound_data_current_pos = 0;
     bool has_sound_data_flag = false;
+    // the last block of get_data_default() has identical channels
+    bool is_data_mono = false;
 
     // initialization
     bool nvs_init = true;
@@ -234,7 +253,6 @@ class BluetoothA2DPSource : public BluetoothA2DPCommon {
     virtual void bt_app_gap_callback(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param);
     /// callback function for AVRCP controller
     virtual void bt_app_rc_ct_cb(esp_avrc_ct_cb_event_t event, esp_avrc_ct_cb_param_t *param);
-    virtual void a2d_app_heart_beat(void *arg);
     /// callback function for A2DP source
     virtual void bt_app_a2d_cb(esp_a2d_cb_event_t event, esp_a2d_cb_param_t *param);
     /// A2DP application state machine
@@ -18,6 +18,38 @@
 
 //*****************************************************************************************
 
+// the base class has no data, the subclasses provide it
+int32_t SoundData::get2ChannelData(int32_t pos, int32_t len, uint8_t *data) {
+    return 0;
+}
+
+int32_t SoundData::getData(int32_t pos, Frame &channels) {
+    return 0;
+}
+
+void SoundData::setDataRaw(uint8_t *data, int32_t len) {
+}
+
+int32_t SoundData::read2ChannelData(uint32_t &pos, int32_t len, uint8_t *data) {
+    int32_t result_len = 0;
+    bool is_restarted = false;
+    while (result_len < len) {
+        int32_t n = get2ChannelData(pos, len - result_len, data + result_len);
+        if (n > 0) {
+            pos += n;
+            result_len += n;
+            is_restarted = false;
+        } else if (doLoop() && !is_restarted) {
+            // end of data: restart in the same block, once, in case the data is empty
+            pos = 0;
+            is_restarted = true;
+        } else {
+            break;
+        }
+    }
+    return result_len;
+}
+
 bool SoundData::doLoop() {
     return automatic_loop;
 }
@@ -77,6 +77,17 @@ public:
   virtual int32_t get2ChannelData(int32_t pos, int32_t len, uint8_t *data);
   virtual int32_t getData(int32_t pos, Frame &channels);
   virtual void setDataRaw(uint8_t *data, int32_t len);
+  /**
+   * Reads len bytes of 2 channel data from pos on and moves pos on. Looped data
+   * continues from its start within the same block, so less than len is only
+   * returned when the data has run out
+   */
+  int32_t read2ChannelData(uint32_t &pos, int32_t len, uint8_t *data);
+  /**
+   * True if get2ChannelData() provides frames with identical channels, so the
+   * volume control can process one channel only
+   */
+  virtual bool isMono() { return false; }
   /**
    * Automatic restart playing on end
    */
@@ -20,11 +20,21 @@
 #include "./I2cA2dp.h"
 #include "./I2cCommand.h"
 #include "./I2cResponse.h"
+#include "./I2cParam.h"
+#include "./I2cStatus.h"
+#include "../../data/AssetPool.h"
+#include "../../data/SoundBuffer.h"
 #include "../../ArduProf.h"
+#include "../../debug/TaskProfiler.h"
+#include "../../debug/TraceLog.h"
+#include "../../debug/CueLatency.h"
+#include "../../debug/CommandRecorder.h"
 
 #define isVolumeValid(volumne) (volumne >= 0 && volumne <= 100)
 #define isSoundValid(param) true
 
+#define PROFILE_CHUNK_SIZE 32 // max number of bytes replied to a ReadProfile/ReadLatency command
+
 /*
     coral                                 esp32
       |                                     |
@@ -55,13 +65,22 @@
 */
 
 I2cA2dp *I2cA2dp::_instance = nullptr;
+I2cA2dp::ParamPool I2cA2dp::_paramPool;
+
+static_assert(sizeof(I2cParam::Timeline) <= I2cA2dp::ParamPool::blockSize(), "I2cParam::Timeline does not fit a ParamPool block");
+static_assert(sizeof(I2cParam::Pattern) <= I2cA2dp::ParamPool::blockSize(), "I2cParam::Pattern does not fit a ParamPool block");
+static_assert(sizeof(I2cA2dp::CommandMessage) <= sizeof(Message), "a command takes more queue storage than a Message");
+static_assert(sizeof(I2cParam::Pattern) + 2 <= I2cA2dp::MAX_FRAME_SIZE, "DefinePattern does not fit MAX_FRAME_SIZE");
+static_assert(I2cStatus::size() <= I2cA2dp::MAX_REPLY_SIZE && PROFILE_CHUNK_SIZE <= I2cA2dp::MAX_REPLY_SIZE && sizeof(I2cParam::TimeSync) <= I2cA2dp::MAX_REPLY_SIZE,
+              "reply does not fit MAX_REPLY_SIZE");
+static_assert(I2cCommand::MAX_ASSET_CHUNK + 5 <= I2cA2dp::MAX_FRAME_SIZE, "AssetChunk does not fit MAX_FRAME_SIZE");
 
-I2cA2dp::I2cA2dp(ThreadBase *thread, int16_t eventValue) : _isA2dpConnected(false),
-                                                           thread(thread),
-                                                           eventValue(eventValue),
-                                                           command(I2cCommand::Null),
-                                                           param(0),
-                                                           reply(I2cResponse::Fail)
+I2cA2dp::I2cA2dp(CommandQueue *queue, int16_t eventValue) : _isA2dpConnected(false),
+                                                            queue(queue),
+                                                            eventValue(eventValue),
+                                                            command(I2cCommand::Null),
+                                                            param(0),
+                                                            reply(I2cResponse::Fail)
 {
     _instance = this;
 
@@ -88,62 +107,355 @@ void I2cA2dp::setA2dpConnectionStatus(bool status)
     _isA2dpConnected = status;
 }
 
+void I2cA2dp::setQueue(CommandQueue *queue)
+{
+    this->queue = queue;
+}
+
 void I2cA2dp::onWireReceive(int numBytes)
 {
-    int sizeAvailable = Wire.available();
-    if (sizeAvailable >= (sizeof(command)))
+    uint8_t frame[MAX_FRAME_SIZE];
+    size_t len = 0;
+    while (Wire.available())
     {
-        command = Wire.read();
-        switch (command)
-        {
-        case I2cCommand::Null:
-            reply = I2cResponse::Success;
-            break;
-        case I2cCommand::IsA2dpConnected:
-            reply = _isA2dpConnected ? I2cResponse::A2dpConnected : I2cResponse::A2dpDisconnected;
-            LOG_TRACE("I2cCommand::IsA2dpConnected: reply=", reply);
-            break;
-        case I2cCommand::PlaySound:
+        uint8_t data = Wire.read();
+        if (len < sizeof(frame))
         {
-            uint8_t paramVolume = Wire.read();
-            uint8_t paramSound = Wire.read();
+            frame[len++] = data;
+        }
+    }
+    receive(frame, len);
+}
 
-            if (!_isA2dpConnected)
-            {
-                reply = I2cResponse::ErrorDisconnected;
-            }
-            else if (isVolumeValid(paramVolume) && isSoundValid(paramSound))
-            {
-                reply = I2cResponse::Success;
+void I2cA2dp::onWireRequest(void)
+{
+    uint8_t buf[MAX_REPLY_SIZE];
+    size_t len = request(buf, sizeof(buf));
+    Wire.write(buf, len);
+}
 
-                if (thread)
-                {
-                    thread->postEvent(eventValue, command, paramVolume, paramSound);
-                }
-            }
-            else
+void I2cA2dp::receive(const uint8_t *frame, size_t len)
+{
+    uint32_t receiveUs = micros();
+    if (len < sizeof(command))
+    {
+        return;
+    }
+
+    command = frame[0];
+    const uint8_t *data = frame + 1;
+    len--;
+    switch (command)
+    {
+    case I2cCommand::Null:
+        reply = I2cResponse::Success;
+        break;
+    case I2cCommand::IsA2dpConnected:
+        reply = _isA2dpConnected ? I2cResponse::A2dpConnected : I2cResponse::A2dpDisconnected;
+        TRACE(TraceI2cIsA2dpConnected, reply);
+        break;
+    case I2cCommand::PlaySound:
+    {
+        I2cStatus::markReceive();
+        if (len < 2)
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+            break;
+        }
+        uint8_t paramVolume = data[0];
+        uint8_t paramSound = data[1];
+
+        if (!_isA2dpConnected)
+        {
+            reply = I2cResponse::ErrorDisconnected;
+        }
+        else if (isVolumeValid(paramVolume) && isSoundValid(paramSound))
+        {
+            uint8_t param[] = {paramVolume, paramSound, CueLatency::markReceive(receiveUs)};
+            reply = post(param, sizeof(param)) ? I2cResponse::Success : I2cResponse::Fail;
+        }
+        else
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+        }
+        TRACE(TraceI2cPlaySound, paramVolume, paramSound, reply);
+        break;
+    }
+    case I2cCommand::ReadProfile:
+    case I2cCommand::ReadLatency:
+        param = (len >= 1) ? data[0] : 0;
+        reply = I2cResponse::Success;
+        break;
+    case I2cCommand::PlayTimeline:
+        I2cStatus::markReceive();
+        reply = onPlayTimeline(data, len);
+        TRACE(TracePlayTimeline, reply);
+        break;
+    case I2cCommand::ReadStatus:
+        reply = I2cResponse::Success;
+        break;
+    case I2cCommand::AssetBegin:
+    case I2cCommand::AssetChunk:
+    case I2cCommand::AssetCommit:
+        reply = onAsset(command, data, len);
+        break;
+    case I2cCommand::TimeSync:
+        if (len == sizeof(timeSync.masterTime))
+        {
+            memcpy(&timeSync.masterTime, data, sizeof(timeSync.masterTime));
+            timeSync.receiveUs = receiveUs;
+            timeSync.streamFrame = SoundBuffer::streamFrameAt(receiveUs);
+            reply = I2cResponse::Success;
+        }
+        else
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+        }
+        break;
+    case I2cCommand::PlayAt:
+        I2cStatus::markReceive();
+        if (len != 6 || !I2cParam::isCueValid(data[4]) || data[4] == I2cParam::CueNone || data[5] > I2cParam::MAX_GAIN)
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+        }
+        else if (!_isA2dpConnected)
+        {
+            reply = I2cResponse::ErrorDisconnected;
+        }
+        else
+        {
+            reply = post(data, len) ? I2cResponse::Success : I2cResponse::Fail;
+        }
+        break;
+    case I2cCommand::PlayUrgent:
+        // straight to the render callback, skipping the ThreadAudio queue
+        I2cStatus::markReceive();
+        if (len != 3 || !I2cParam::isCueValid(data[0]) || data[0] == I2cParam::CueNone || data[1] > I2cParam::MAX_GAIN)
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+        }
+        else if (!_isA2dpConnected)
+        {
+            reply = I2cResponse::ErrorDisconnected;
+        }
+        else
+        {
+            reply = SoundBuffer::requestUrgent(data[0], data[1], data[2]);
+            if (reply == I2cResponse::Success)
             {
-                reply = I2cResponse::ErrorInvalidParam;
+                CommandRecorder::record(eventValue, command, SoundBuffer::streamFrameAt(receiveUs), data, len);
             }
-            LOG_TRACE("I2cCommand::PlaySound: paramVolume=", paramVolume, ", paramSound=(hex)", DebugLogBase::HEX, paramSound, ", reply=", DebugLogBase::DEC, reply);
-            break;
         }
-        default:
-            reply = I2cResponse::Fail;
+        break;
+    case I2cCommand::SetTone:
+    {
+        // published to the render callback at once, like PlayUrgent
+        I2cParam::ToneParam tone;
+        if (len != 1 + sizeof(tone))
+        {
+            reply = I2cResponse::ErrorInvalidParam;
             break;
         }
-
-        while (Wire.available())
+        memcpy(&tone, data + 1, sizeof(tone));
+        reply = ToneSoundData::set(data[0], tone) ? I2cResponse::Success : I2cResponse::ErrorInvalidParam;
+        if (reply == I2cResponse::Success)
         {
-            uint8_t dummy = Wire.read();
-            LOG_TRACE("ignore I2C data=(hex)", DebugLogBase::HEX, dummy);
+            CommandRecorder::record(eventValue, command, SoundBuffer::streamFrameAt(receiveUs), data, len);
         }
+        break;
     }
+    case I2cCommand::DefinePattern:
+        reply = onDefinePattern(data, len);
+        break;
+    case I2cCommand::PlayPattern:
+        I2cStatus::markReceive();
+        if (len != 2 || data[0] >= I2cParam::MAX_PATTERNS)
+        {
+            reply = I2cResponse::ErrorInvalidParam;
+        }
+        else if (!_isA2dpConnected)
+        {
+            reply = I2cResponse::ErrorDisconnected;
+        }
+        else
+        {
+            reply = post(data, len) ? I2cResponse::Success : I2cResponse::Fail;
+        }
+        break;
+    default:
+        reply = I2cResponse::ErrorInvalidCommand;
+        break;
+    }
+
+    bool isError = (reply == I2cResponse::Fail || reply == I2cResponse::ErrorInvalidCommand || reply == I2cResponse::ErrorInvalidParam);
+    if (isError)
+    {
+        TRACE(TraceI2cError, command, len, reply);
+    }
+    I2cStatus::countFrame(isError);
 }
 
-void I2cA2dp::onWireRequest(void)
+size_t I2cA2dp::request(uint8_t *buf, size_t size)
 {
-    Wire.write((const uint8_t *)&reply, sizeof(reply));
+    size_t len = 0;
+    if (command == I2cCommand::ReadProfile)
+    {
+        len = TaskProfiler::read(param, buf, std::min<size_t>(size, PROFILE_CHUNK_SIZE));
+    }
+    else if (command == I2cCommand::ReadLatency)
+    {
+        len = CueLatency::read(param, buf, std::min<size_t>(size, PROFILE_CHUNK_SIZE));
+    }
+    else if (command == I2cCommand::TimeSync && reply == I2cResponse::Success && size >= sizeof(timeSync))
+    {
+        timeSync.replyUs = micros();
+        memcpy(buf, &timeSync, sizeof(timeSync));
+        len = sizeof(timeSync);
+    }
+    else if (command == I2cCommand::ReadStatus && size >= I2cStatus::size())
+    {
+        I2cStatus::StatusRegister status;
+        I2cStatus::read(status);
+        memcpy(buf, &status, sizeof(status));
+        len = sizeof(status);
+    }
+    else if (size >= sizeof(reply))
+    {
+        buf[0] = reply;
+        len = sizeof(reply);
+    }
     command = I2cCommand::Null;
     reply = I2cResponse::Fail;
+    return len;
+}
+
+// validates an I2cParam::Timeline followed by its crc8
+uint8_t I2cA2dp::onPlayTimeline(const uint8_t *data, size_t len)
+{
+    if (len <= I2cParam::TIMELINE_HEADER_SIZE)
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+
+    const I2cParam::Timeline *timeline = reinterpret_cast<const I2cParam::Timeline *>(data);
+    if (timeline->slotCount == 0 || timeline->slotCount > I2cParam::MAX_TIMELINE_SLOTS)
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+    size_t size = I2cParam::TIMELINE_HEADER_SIZE + timeline->slotCount * sizeof(I2cParam::TimelineSlot);
+    if (len != size + 1 || I2cParam::crc8(data, size) != data[size])
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+    for (int i = 0; i < timeline->slotCount; i++)
+    {
+        if (!I2cParam::isCueValid(timeline->slot[i].cue) || timeline->slot[i].gain > I2cParam::MAX_GAIN)
+        {
+            return I2cResponse::ErrorInvalidParam;
+        }
+    }
+
+    if (!_isA2dpConnected)
+    {
+        return I2cResponse::ErrorDisconnected;
+    }
+    return postBlock(data, size) ? I2cResponse::Success : I2cResponse::Fail;
+}
+
+// validates an I2cParam::Pattern followed by its crc8; the pattern is stored by ThreadAudio
+uint8_t I2cA2dp::onDefinePattern(const uint8_t *data, size_t len)
+{
+    if (len <= I2cParam::PATTERN_HEADER_SIZE)
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+
+    const I2cParam::Pattern *pattern = reinterpret_cast<const I2cParam::Pattern *>(data);
+    if (pattern->id >= I2cParam::MAX_PATTERNS || pattern->stepCount == 0 || pattern->stepCount > I2cParam::MAX_PATTERN_STEPS)
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+    size_t size = I2cParam::PATTERN_HEADER_SIZE + pattern->stepCount * sizeof(I2cParam::PatternStep);
+    if (len != size + 1 || I2cParam::crc8(data, size) != data[size])
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+    if (PatternSequencer::eventCount(pattern->step, pattern->stepCount) == 0)
+    {
+        return I2cResponse::ErrorInvalidParam;
+    }
+
+    return postBlock(data, size) ? I2cResponse::Success : I2cResponse::Fail;
+}
+
+// AssetPool is only used from this callback, no need to hop to a thread
+uint8_t I2cA2dp::onAsset(uint8_t command, const uint8_t *data, size_t len)
+{
+    bool result = false;
+    switch (command)
+    {
+    case I2cCommand::AssetBegin:
+        if (len == 5)
+        {
+            result = AssetPool::begin(data[0], data[1] | (data[2] << 8), data[3] | (data[4] << 8));
+        }
+        break;
+    case I2cCommand::AssetChunk:
+        if (len >= 5 && len <= I2cCommand::MAX_ASSET_CHUNK + 4 && I2cParam::crc8(data, len - 1) == data[len - 1])
+        {
+            result = AssetPool::write(data[0], data[1] | (data[2] << 8), &data[3], len - 4);
+        }
+        break;
+    case I2cCommand::AssetCommit:
+        if (len == 2)
+        {
+            result = AssetPool::commit(data[0], data[1]);
+        }
+        break;
+    default:
+        break;
+    }
+    return result ? I2cResponse::Success : I2cResponse::ErrorInvalidParam;
+}
+
+bool I2cA2dp::post(const CommandMessage &msg)
+{
+    if (!queue || !queue->post(msg))
+    {
+        I2cStatus::countDrop();
+        return false;
+    }
+    return true;
+}
+
+bool I2cA2dp::post(const uint8_t *param, size_t len)
+{
+    Frame frame;
+    configASSERT(len <= sizeof(frame.param));
+    frame.length = (uint8_t)len;
+    memcpy(frame.param, param, len);
+    return post(CommandMessage(command, frame));
+}
+
+bool I2cA2dp::postBlock(const uint8_t *data, size_t len)
+{
+    if (len > ParamPool::blockSize())
+    {
+        return false;
+    }
+
+    ParamPool::Handle handle = _paramPool.alloc();
+    if (handle == ParamPool::InvalidHandle)
+    {
+        I2cStatus::countDrop();
+        return false;
+    }
+    memcpy(_paramPool.data(handle), data, len);
+    PoolBlock block = {.handle = handle, .length = (uint16_t)len};
+    if (!post(CommandMessage(command, block)))
+    {
+        _paramPool.release(handle);
+        return false;
+    }
+    return true;
 }
@@ -20,6 +20,10 @@
 #pragma once
 #include <Wire.h>
 #include "../../ArduProf.h"
+#include "../../base/os/freertos/TypedMessageQueue.h"
+#include "../../base/type/BlockPool.h"
+#include "../../base/type/MessageVariant.h"
+#include "./I2cParam.h"
 
 #define I2C_DEV_ADDR ((uint8_t)0x55) // device address
 
@@ -27,22 +31,62 @@ class I2cA2dp
 {
 public:
   ///////////////////////////////////////////////////////////////////////
-  I2cA2dp(ThreadBase *thread, int16_t event);
+  // parameters of a short command, as validated by receive(); PlaySound
+  // carries {volume, sound, CueLatency sequence}
+  static const size_t MAX_INLINE_PARAM = 6; // PlayAt
+  typedef struct _Frame
+  {
+    uint8_t length;
+    uint8_t param[MAX_INLINE_PARAM];
+  } Frame;
+
+  // a command posted to the audio thread, event = I2cCommand: its parameters
+  // inline, or the ParamPool block holding them, which the receiver releases
+  typedef MessageVariant<Frame, PoolBlock> CommandMessage;
+  typedef TypedMessageQueue<CommandMessage> CommandQueue;
+
+  I2cA2dp(CommandQueue *queue, int16_t event);
   bool begin(uint8_t deviceAddr);
 
   void setA2dpConnectionStatus(bool status);
+  void setQueue(CommandQueue *queue);
+
+  static const size_t MAX_FRAME_SIZE = 128; // Wire receive buffer
+  static const size_t MAX_REPLY_SIZE = 32;
+
+  // protocol entry points, independent of Wire: a received frame (command byte
+  // included) and the reply to the following read, returns the reply length
+  void receive(const uint8_t *frame, size_t len);
+  size_t request(uint8_t *buf, size_t size);
+
+  // parameters which do not fit a Frame (PlayTimeline, DefinePattern) are
+  // copied into a block of this pool and posted as a PoolBlock
+  typedef BlockPool<68, 4> ParamPool;
+  static ParamPool &paramPool(void)
+  {
+    return _paramPool;
+  }
 
 protected:
   static I2cA2dp *_instance;
+  static ParamPool _paramPool;
 
   bool _isA2dpConnected;
-  ThreadBase *thread;
-  const int16_t eventValue;
+  CommandQueue *queue;
+  const int16_t eventValue; // of the CommandRecorder records
 
   uint8_t command;
   uint8_t param;
   uint8_t reply;
+  I2cParam::TimeSync timeSync;
 
   void onWireReceive(int numBytes);
   void onWireRequest(void);
+
+  uint8_t onPlayTimeline(const uint8_t *data, size_t len);
+  uint8_t onDefinePattern(const uint8_t *data, size_t len);
+  uint8_t onAsset(uint8_t command, const uint8_t *data, size_t len);
+  bool post(const CommandMessage &msg);
+  bool post(const uint8_t *param, size_t len);
+  bool postBlock(const uint8_t *data, size_t len);
 };
\ No newline at end of file
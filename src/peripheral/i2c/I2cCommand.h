@@ -47,4 +47,165 @@ public:
     // slave to master  |       0        |        0       |       0        |     result     |
     //                  +----------------+----------------+----------------+----------------+
     static const uint8_t PlaySound = 3;
+
+    // command: ReadProfile (TaskProfiler::TaskProfileSnapshot, read in chunks of up to 32 bytes)
+    //                  +----------------+----------------+
+    //                  |     byte 0     |     byte 1     |
+    //                  +----------------+----------------+
+    // master to slave  |  ReadProfile   |     offset     |
+    //                  +----------------+----------------+----------------+
+    // slave to master  |snapshot[offset]|      ...       |snapshot[off+n] |
+    //                  +----------------+----------------+----------------+
+    static const uint8_t ReadProfile = 4;
+
+    // command: PlayTimeline (I2cParam::Timeline, n = slotCount, crc = I2cParam::crc8 of bytes 1..2n+3)
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |
+    //                  +----------------+----------------+----------------+----------------+
+    // master to slave  |  PlayTimeline  |    sequence    |     repeat     |       n        |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 4     |     byte 5     |      ...       |   byte 2n+4    |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     cue 0      |     gain 0     |      ...       |      crc       |
+    //                  +----------------+----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t PlayTimeline = 5;
+
+    // command: ReadStatus (I2cStatus::StatusRegister, 24 bytes)
+    //                  +----------------+
+    //                  |     byte 0     |
+    //                  +----------------+
+    // master to slave  |   ReadStatus   |
+    //                  +----------------+----------------+----------------+
+    // slave to master  |   status[0]    |      ...       |   status[23]   |
+    //                  +----------------+----------------+----------------+
+    static const uint8_t ReadStatus = 6;
+
+    // asset upload (AssetPool): AssetBegin, n x AssetChunk, AssetCommit; values are little endian
+    // the asset is selectable as cue I2cParam::CueAsset + id once committed
+    //
+    // command: AssetBegin (rate must be 44100, length <= 4410 samples of signed 8-bit mono PCM)
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |     byte 4     |     byte 5     |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    // master to slave  |   AssetBegin   |       id       |    rate lo     |    rate hi     |   length lo    |   length hi    |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t AssetBegin = 7;
+
+    // command: AssetChunk (n <= MAX_ASSET_CHUNK, crc = I2cParam::crc8 of bytes 1..n+3)
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |  byte 4..n+3   |    byte n+4    |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    // master to slave  |   AssetChunk   |       id       |   offset lo    |   offset hi    |    n samples   |      crc       |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t AssetChunk = 8;
+    static const uint8_t MAX_ASSET_CHUNK = 120; // Wire receive buffer is 128 bytes
+
+    // command: AssetCommit (crc = I2cParam::crc8 of all samples)
+    //                  +----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |
+    //                  +----------------+----------------+----------------+
+    // master to slave  |  AssetCommit   |       id       |      crc       |
+    //                  +----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t AssetCommit = 9;
+
+    // command: TimeSync (I2cParam::TimeSync, maps the master clock to the local clock and the audio stream)
+    //                  +----------------+----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |     byte 4     |
+    //                  +----------------+----------------+----------------+----------------+----------------+
+    // master to slave  |    TimeSync    |                    master time (little endian)                    |
+    //                  +----------------+----------------+----------------+----------------+----------------+
+    // slave to master  |  timeSync[0]   |      ...       |  timeSync[15]  |
+    //                  +----------------+----------------+----------------+
+    static const uint8_t TimeSync = 10;
+
+    // command: PlayAt (plays a cue from an absolute stream frame on, mixed over the slots)
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |     byte 4     |     byte 5     |     byte 6     |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+----------------+
+    // master to slave  |     PlayAt     |                   stream frame (little endian)                    |      cue       |      gain      |
+    //                  +----------------+----------------+----------------+----------------+----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t PlayAt = 11;
+
+    // command: PlayUrgent (plays a cue instead of the pattern from the next audio packet on, then returns to the pattern;
+    //                      a cue with a lower priority than the urgent cue being played is rejected)
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |
+    //                  +----------------+----------------+----------------+----------------+
+    // master to slave  |   PlayUrgent   |      cue       |      gain      |    priority    |
+    //                  +----------------+----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t PlayUrgent = 12;
+
+    // command: ReadLatency (CueLatency::CueLatencyHistogram, read in chunks of up to 32 bytes)
+    //                  +----------------+----------------+
+    //                  |     byte 0     |     byte 1     |
+    //                  +----------------+----------------+
+    // master to slave  |  ReadLatency   |     offset     |
+    //                  +----------------+----------------+----------------+
+    // slave to master  |histogram[off]  |      ...       |histogram[off+n]|
+    //                  +----------------+----------------+----------------+
+    static const uint8_t ReadLatency = 13;
+
+    // command: SetTone (defines the synthesized cue I2cParam::CueTone + id, played like any cue;
+    //                   the new parameters apply from the next audio frame on)
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |     byte 3     |
+    //                  +----------------+----------------+----------------+----------------+
+    // master to slave  |    SetTone     |       id       |        frequency (LE)           |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 4     |     byte 5     |     byte 6     |     byte 7     |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |    waveform    |      gain      |     attack     |     decay      |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 8     |     byte 9     |    byte 10     |    byte 11     |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |    sustain     |    release     |      fmFrequency (LE)           |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |    byte 12     |
+    //                  +----------------+
+    //                  |    fmIndex     |
+    //                  +----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t SetTone = 14;
+
+    // command: DefinePattern (I2cParam::Pattern, n = stepCount, crc = I2cParam::crc8 of bytes 1..4n+2;
+    //                         stores pattern id, the playing pattern is not affected)
+    //                  +----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |
+    //                  +----------------+----------------+----------------+
+    // master to slave  | DefinePattern  |       id       |       n        |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     byte 3     |     byte 4     |     byte 5     |     byte 6     |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |     cue 0      |     gain 0     |   duration 0   |    repeat 0    |
+    //                  +----------------+----------------+----------------+----------------+
+    //                  |      ...       |   byte 4n+3    |
+    //                  +----------------+----------------+
+    //                  |      ...       |      crc       |
+    //                  +----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t DefinePattern = 15;
+
+    // command: PlayPattern (plays the pattern stored by DefinePattern instead of the current one)
+    //                  +----------------+----------------+----------------+
+    //                  |     byte 0     |     byte 1     |     byte 2     |
+    //                  +----------------+----------------+----------------+
+    // master to slave  |  PlayPattern   |       id       |     repeat     |
+    //                  +----------------+----------------+----------------+
+    // slave to master  |     result     |
+    //                  +----------------+
+    static const uint8_t PlayPattern = 16;
 };
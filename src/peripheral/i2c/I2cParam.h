@@ -41,4 +41,121 @@ public:
             uint8_t data;
         } byte;
     } Sound;
+
+    // sound clips selectable per timeline slot
+    enum Cue : uint8_t
+    {
+        CueNone = 0, // silence
+        CueEdgePool,
+        CueLaneLeft,
+        CueLaneMiddle,
+        CueLaneRight,
+        CueError,
+        CueCount,
+
+        CueAsset = 16, // CueAsset + n: asset n uploaded by AssetBegin/AssetChunk/AssetCommit
+        CueTone = 32,  // CueTone + n: tone n defined by SetTone
+    };
+
+    static const uint8_t MAX_ASSETS = 4;
+    static const uint8_t MAX_TONES = 4;
+
+    static bool isCueValid(uint8_t cue)
+    {
+        return cue < CueCount || (cue >= CueAsset && cue < CueAsset + MAX_ASSETS) || (cue >= CueTone && cue < CueTone + MAX_TONES);
+    }
+
+    enum Waveform : uint8_t
+    {
+        WaveSine = 0,
+        WaveTriangle,
+        WaveSquare,
+        WaveCount,
+    };
+
+    static const uint16_t MIN_TONE_FREQUENCY = 20;   // in Hz
+    static const uint16_t MAX_TONE_FREQUENCY = 8000; // in Hz
+
+    // payload of I2cCommand::SetTone after the tone id; the envelope spans one slot
+    typedef struct __attribute__((packed)) _ToneParam
+    {
+        uint16_t frequency;   // in Hz, MIN_TONE_FREQUENCY..MAX_TONE_FREQUENCY
+        uint8_t waveform;     // Waveform
+        uint8_t gain;         // 0..MAX_GAIN
+        uint8_t attack;       // in ms
+        uint8_t decay;        // in ms, from the peak down to sustain
+        uint8_t sustain;      // level in percent of the peak
+        uint8_t release;      // in ms, ends with the slot; attack + decay + release <= 100
+        uint16_t fmFrequency; // modulator in Hz, 0 = no FM
+        uint8_t fmIndex;      // modulation index in 1/16
+    } ToneParam;
+
+    static const uint8_t MAX_TIMELINE_SLOTS = 10; // <= MAX_PATTERN_STEPS, played as a pattern
+    static const uint8_t MAX_GAIN = 100;          // gain is in percent, like the volume
+
+    typedef struct _TimelineSlot
+    {
+        uint8_t cue; // Cue
+        uint8_t gain;
+    } TimelineSlot;
+
+    // payload of I2cCommand::PlayTimeline, without the trailing crc
+    typedef struct _Timeline
+    {
+        uint8_t sequence;  // chosen by the master, a timeline with the active sequence is ignored
+        uint8_t repeat;    // number of cycles to play, 0 = until replaced
+        uint8_t slotCount; // 1..MAX_TIMELINE_SLOTS, each slot lasts SoundBuffer::SLOT_DURATION
+        TimelineSlot slot[MAX_TIMELINE_SLOTS];
+    } Timeline;
+
+    static const uint8_t TIMELINE_HEADER_SIZE = offsetof(Timeline, slot);
+
+    static const uint8_t MAX_PATTERNS = 4;       // patterns stored by DefinePattern
+    static const uint8_t MAX_PATTERN_STEPS = 16;
+    static const uint8_t PATTERN_TICK = 10;      // unit of PatternStep::duration, in ms
+
+    // a cue lasts one slot: a shorter step cuts it, a longer one is padded with silence
+    typedef struct _PatternStep
+    {
+        uint8_t cue;      // Cue, CueNone = rest
+        uint8_t gain;     // 0..MAX_GAIN
+        uint8_t duration; // 1..255 PATTERN_TICK
+        uint8_t repeat;   // 1..255 times in a row
+    } PatternStep;
+
+    // payload of I2cCommand::DefinePattern, without the trailing crc
+    typedef struct _Pattern
+    {
+        uint8_t id;        // 0..MAX_PATTERNS - 1, selected by I2cCommand::PlayPattern
+        uint8_t stepCount; // 1..MAX_PATTERN_STEPS
+        PatternStep step[MAX_PATTERN_STEPS];
+    } Pattern;
+
+    static const uint8_t PATTERN_HEADER_SIZE = offsetof(Pattern, step);
+
+    // reply to I2cCommand::TimeSync; with t0 = masterTime and t3 = the master's time
+    // when the reply is received, the clock offset (local - master) is
+    // ((receiveUs - t0) + (replyUs - t3)) / 2
+    typedef struct __attribute__((packed)) _TimeSync
+    {
+        uint32_t masterTime;  // echoed from the command
+        uint32_t receiveUs;   // local micros() when the command was received
+        uint32_t replyUs;     // local micros() when the reply was requested
+        uint32_t streamFrame; // audio frame (44100Hz) rendered at receiveUs
+    } TimeSync;
+
+    // CRC-8, polynomial 0x07, init 0 (CRC-8/SMBUS)
+    static uint8_t crc8(const uint8_t *data, size_t len)
+    {
+        uint8_t crc = 0;
+        while (len--)
+        {
+            crc ^= *data++;
+            for (int i = 0; i < 8; i++)
+            {
+                crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+            }
+        }
+        return crc;
+    }
 };
@@ -31,4 +31,5 @@ public:
     static const uint8_t ErrorInvalidCommand = -2;
     static const uint8_t ErrorInvalidParam = -3;
     static const uint8_t ErrorDisconnected = -4;
+    static const uint8_t ErrorBusy = -5; // PlayUrgent: an urgent cue of higher priority is pending or playing
 };
@@ -0,0 +1,84 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "I2cStatus.h"
+
+portMUX_TYPE I2cStatus::_lock = portMUX_INITIALIZER_UNLOCKED;
+I2cStatus::StatusRegister I2cStatus::_status = {
+    .version = VERSION,
+};
+volatile uint32_t I2cStatus::_receiveUs = 0;
+
+// the _SAFE variants work from a task and from an ISR, like read()
+#define UPDATE_STATUS(statement)         \
+    do                                   \
+    {                                    \
+        portENTER_CRITICAL_SAFE(&_lock); \
+        statement;                       \
+        _status.updateCount++;           \
+        portEXIT_CRITICAL_SAFE(&_lock);  \
+    } while (0)
+
+void I2cStatus::setConnectionState(uint8_t state)
+{
+    UPDATE_STATUS(_status.connectionState = state);
+}
+
+void I2cStatus::setAudioState(uint8_t state)
+{
+    UPDATE_STATUS(_status.audioState = state);
+}
+
+void I2cStatus::setPattern(uint8_t pattern)
+{
+    UPDATE_STATUS(_status.pattern = pattern);
+}
+
+void I2cStatus::setTimelineSequence(uint8_t sequence)
+{
+    UPDATE_STATUS(_status.timelineSequence = sequence);
+}
+
+void I2cStatus::setCounters(uint8_t queueDepth, uint32_t underrunCount)
+{
+    UPDATE_STATUS(_status.queueDepth = queueDepth; _status.underrunCount = underrunCount);
+}
+
+void I2cStatus::countFrame(bool isError)
+{
+    UPDATE_STATUS(_status.frameCount++; _status.errorCount += isError ? 1 : 0);
+}
+
+void I2cStatus::countDrop(void)
+{
+    UPDATE_STATUS(_status.dropCount++);
+}
+
+void I2cStatus::markApplied(void)
+{
+    uint32_t latency = micros() - _receiveUs;
+    UPDATE_STATUS(_status.cueLatencyUs = latency);
+}
+
+void I2cStatus::read(StatusRegister &status)
+{
+    portENTER_CRITICAL_SAFE(&_lock);
+    status = _status;
+    portEXIT_CRITICAL_SAFE(&_lock);
+}
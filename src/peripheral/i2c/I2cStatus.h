@@ -0,0 +1,81 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include <Arduino.h>
+
+// Register block which the master reads in one transaction (I2cCommand::ReadStatus)
+// instead of polling a single reply byte per question. Each field has one
+// writer; updates and reads go through a spinlock so that a read never sees a
+// half written block. Every function takes it with portENTER_CRITICAL_SAFE, so
+// any of them may be called from a task or an ISR; none of them blocks.
+class I2cStatus
+{
+public:
+    static const uint8_t VERSION = 2;
+
+    typedef struct __attribute__((packed)) _StatusRegister
+    {
+        uint8_t version;
+        uint8_t connectionState;  // esp_a2d_connection_state_t, written by ThreadApp
+        uint8_t audioState;       // esp_a2d_audio_state_t, written by ThreadApp
+        uint8_t pattern;          // I2cParam::Sound of the last PlaySound, written by ThreadAudio
+        uint8_t timelineSequence; // sequence of the last PlayTimeline applied, written by ThreadAudio
+        uint8_t queueDepth;       // messages waiting for ThreadAudio, sampled by ThreadApp
+        uint16_t updateCount;     // incremented on every update
+        uint32_t underrunCount;   // BluetoothA2DPSource::get_underrun_count(), sampled by ThreadApp
+        uint32_t cueLatencyUs;    // I2C receive to SoundBuffer update of the last command, written by ThreadAudio
+        uint32_t frameCount;      // I2C frames received, written by I2cA2dp
+        uint16_t errorCount;      // frames replied with Fail/ErrorInvalidCommand/ErrorInvalidParam, written by I2cA2dp
+        uint16_t dropCount;       // commands lost because the ThreadAudio queue or the param pool was full, written by I2cA2dp
+    } StatusRegister;
+
+    // ThreadApp, on the A2DP connection and audio state events
+    static void setConnectionState(uint8_t state);
+    static void setAudioState(uint8_t state);
+    // ThreadAudio, once a PlaySound or PlayTimeline is applied
+    static void setPattern(uint8_t pattern);
+    static void setTimelineSequence(uint8_t sequence);
+    // ThreadApp, every STATUS_INTERVAL_MS
+    static void setCounters(uint8_t queueDepth, uint32_t underrunCount);
+    // I2cA2dp, in the Wire receive callback
+    static void countFrame(bool isError);
+    static void countDrop(void);
+
+    // called by I2cA2dp when a command is received, the time is the base of cueLatencyUs
+    static void markReceive(void)
+    {
+        _receiveUs = micros();
+    }
+    // called by ThreadAudio, or by the A2DP data callback for PlayUrgent, once the command has been applied
+    static void markApplied(void);
+
+    // I2cA2dp, in the Wire request callback
+    static void read(StatusRegister &status);
+
+    static constexpr size_t size(void)
+    {
+        return sizeof(StatusRegister);
+    }
+
+private:
+    static portMUX_TYPE _lock;
+    static StatusRegister _status;
+    static volatile uint32_t _receiveUs;
+};
@@ -20,10 +20,17 @@
 #include <string.h>
 
 #include "../peripheral/i2c/I2cCommand.h"
+#include "../peripheral/i2c/I2cStatus.h"
+#include "../data/Mp3Cache.h"
+#include "../debug/TaskProfiler.h"
+#include "../debug/HeapMonitor.h"
+#include "../debug/RenderCheck.h"
+#include "../debug/SerialLock.h"
+#include "../debug/TraceLog.h"
+#include "../../AppContext.h"
 #include "../../AppEvent.h"
 #include "ThreadApp.h"
-
-static int8_t *soundBuf = nullptr;
+#include "ThreadAudio.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 // #define I2C_DEV_ADDR ((uint8_t)0x55)
@@ -39,65 +46,140 @@ ThreadApp *ThreadApp::_instance = nullptr;
 ////////////////////////////////////////////////////////////////////////////////////////////
 // Thread
 ////////////////////////////////////////////////////////////////////////////////////////////
-// #define RUNNING_CORE 0 // dedicate core 0 for Thread
-// #define RUNNING_CORE 1 // dedicate core 1 for Thread
-#define RUNNING_CORE ARDUINO_RUNNING_CORE
-
+// core affinity and priority are configured by AppContext::threadAppConfig
 #define TASK_NAME "ThreadApp"
+#ifdef MP3_CUES
+#define TASK_STACK_SIZE 6144 // room for the MP3 decoder of Mp3Cache
+#else
 #define TASK_STACK_SIZE 4096
-#define TASK_PRIORITY 3
+#endif
 #define TASK_QUEUE_SIZE 128 // message queue size for app task
 
 #define TASK_INIT_NAME "taskDelayInit"
 #define TASK_INIT_STACK_SIZE 4096
 #define TASK_INIT_PRIORITY 0
 
+#define BT_APP_TASK_STACK_SIZE 3072 // stack size of "BtAppT" created by BluetoothA2DPSource
+
+#define PROFILE_INTERVAL_MS 5000   // interval of TaskProfiler::sample()
+#define TRACE_DRAIN_INTERVAL_MS 100 // interval of TraceLog::drain()
+#define STATUS_INTERVAL_MS 100      // interval of the I2cStatus counters update
+
 static uint8_t ucQueueStorageArea[TASK_QUEUE_SIZE * sizeof(Message)];
 static StaticQueue_t xStaticQueue;
 
 static StackType_t xStack[TASK_STACK_SIZE];
 static StaticTask_t xTaskBuffer;
 
+// static even though the task is deleted after init: avoids a hole in the heap
+static StackType_t xInitStack[TASK_INIT_STACK_SIZE];
+static StaticTask_t xInitTaskBuffer;
+
+////////////////////////////////////////////////////////////////////////////////////////////
+const ThreadApp::HandlerMap ThreadApp::handlerMap[] = {
+    __EVENT_MAP(ThreadApp, EventA2dpConnectionState),
+    __EVENT_MAP(ThreadApp, EventA2dpAudioState),
+    __EVENT_MAP(ThreadApp, EventProfile),
+    __EVENT_MAP(ThreadApp, EventTraceDrain),
+    __EVENT_MAP(ThreadApp, EventStatus),
+    __EVENT_MAP(ThreadApp, EventCueDecode),
+    __EVENT_MAP(ThreadApp, EventNull), // {EventNull, &ThreadApp::handlerEventNull},
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////
 ThreadApp::ThreadApp() : ThreadBase(TASK_QUEUE_SIZE, ucQueueStorageArea, &xStaticQueue),
-                         isA2dpConnected(false),
                          a2dpSource(),
-                         soundBuffer(),
-                         i2cA2dp(this, EventI2c),
-                         handlerMap()
+                         i2cA2dp(nullptr, EventI2c)
 {
     _instance = this;
-    handlerMap = {
-        __EVENT_MAP(ThreadApp, EventI2c),
-        __EVENT_MAP(ThreadApp, EventNull), // {EventNull, &ThreadApp::handlerEventNull},
-    };
 }
 
 ///////////////////////////////////////////////////////////////////////|
-__EVENT_FUNC_DEFINITION(ThreadApp, EventI2c, msg) // void ThreadApp::handlerEventI2c(const Message &msg)
+__EVENT_FUNC_DEFINITION(ThreadApp, EventA2dpConnectionState, msg) // void ThreadApp::handlerEventA2dpConnectionState(const Message &msg)
 {
-    // LOG_TRACE("EventI2c(", msg.event, "), iParam = ", msg.iParam, ", uParam = ", msg.uParam, ", lParam = ", msg.lParam);
-    int16_t command = msg.iParam;
-    switch (command)
-    {
-    case I2cCommand::PlaySound:
+    esp_a2d_connection_state_t state = (esp_a2d_connection_state_t)msg.iParam;
+    I2cStatus::setConnectionState(state);
+    switch (state)
     {
-        if (isA2dpConnected)
-        {
-            uint8_t paramVolume = (uint8_t)msg.uParam;
-            uint8_t paramSound = (uint8_t)msg.lParam;
-            a2dpSource.set_volume(paramVolume);
-            soundBuffer.updateSoundSignal(paramSound);
-        }
+    case ESP_A2D_CONNECTION_STATE_DISCONNECTED: // connection released
+        LOG_TRACE("ESP_A2D_CONNECTION_STATE_DISCONNECTED");
+        i2cA2dp.setA2dpConnectionStatus(false);
+        break;
+    case ESP_A2D_CONNECTION_STATE_CONNECTING: // connecting remote device
+        LOG_TRACE("ESP_A2D_CONNECTION_STATE_CONNECTING");
+        break;
+    case ESP_A2D_CONNECTION_STATE_CONNECTED: // connection established
+        LOG_TRACE("ESP_A2D_CONNECTION_STATE_CONNECTED");
+        i2cA2dp.setA2dpConnectionStatus(true);
+        break;
+    case ESP_A2D_CONNECTION_STATE_DISCONNECTING: //!< disconnecting remote device
+        LOG_TRACE("ESP_A2D_CONNECTION_STATE_DISCONNECTING");
+        break;
+    default:
+        LOG_TRACE("unknown state=", state);
         break;
     }
 
+    ThreadBase *threadAudio = static_cast<AppContext *>(context())->threadAudio;
+    if (threadAudio)
+    {
+        threadAudio->postEvent(msg);
+    }
+}
+
+__EVENT_FUNC_DEFINITION(ThreadApp, EventA2dpAudioState, msg) // void ThreadApp::handlerEventA2dpAudioState(const Message &msg)
+{
+    esp_a2d_audio_state_t state = (esp_a2d_audio_state_t)msg.iParam;
+    I2cStatus::setAudioState(state);
+    switch (state)
+    {
+    case ESP_A2D_AUDIO_STATE_REMOTE_SUSPEND: // audio stream datapath suspended by remote device
+        LOG_TRACE("ESP_A2D_AUDIO_STATE_REMOTE_SUSPEND");
+        break;
+    case ESP_A2D_AUDIO_STATE_STOPPED: // audio stream datapath stopped
+        LOG_TRACE("ESP_A2D_AUDIO_STATE_STOPPED");
+        break;
+    case ESP_A2D_AUDIO_STATE_STARTED: // audio stream datapath started
+        LOG_TRACE("ESP_A2D_AUDIO_STATE_STARTED");
+        break;
     default:
-        LOG_TRACE("unsupported i2c command=", command);
+        LOG_TRACE("unknown state=", state);
         break;
     }
 }
 
+__EVENT_FUNC_DEFINITION(ThreadApp, EventProfile, msg) // void ThreadApp::handlerEventProfile(const Message &msg)
+{
+    TaskProfiler::sample();
+#ifdef HEAP_MONITOR
+    HeapMonitor::check();
+#endif
+}
+
+__EVENT_FUNC_DEFINITION(ThreadApp, EventTraceDrain, msg) // void ThreadApp::handlerEventTraceDrain(const Message &msg)
+{
+    // skipped while loop() writes a binary dump, the records are drained next time
+    if (SerialLock::tryLock())
+    {
+        TraceLog::drain(Serial);
+        SerialLock::unlock();
+    }
+}
+
+__EVENT_FUNC_DEFINITION(ThreadApp, EventStatus, msg) // void ThreadApp::handlerEventStatus(const Message &msg)
+{
+    ThreadBase *threadAudio = static_cast<AppContext *>(context())->threadAudio;
+    UBaseType_t queueDepth = threadAudio ? uxQueueMessagesWaiting(threadAudio->queue()) : 0;
+    I2cStatus::setCounters((uint8_t)std::min<UBaseType_t>(queueDepth, UINT8_MAX), a2dpSource.get_underrun_count());
+    // retries the MP3 cues which were waiting for a slab
+    Mp3Cache::decodePending();
+}
+
+__EVENT_FUNC_DEFINITION(ThreadApp, EventCueDecode, msg) // void ThreadApp::handlerEventCueDecode(const Message &msg)
+{
+    Mp3Cache::decodePending();
+}
+
 __EVENT_FUNC_DEFINITION(ThreadApp, EventNull, msg) // void ThreadApp::handlerEventNull(const Message &msg)
 {
     LOG_TRACE("EventNull(", msg.event, "), iParam = ", msg.iParam, ", uParam = ", msg.uParam, ", lParam = ", msg.lParam);
@@ -107,7 +189,16 @@ __EVENT_FUNC_DEFINITION(ThreadApp, EventNull, msg) // void ThreadApp::handlerEve
 void ThreadApp::onMessage(const Message &msg)
 {
     // LOG_TRACE("event=", msg.event, ", iParam=", msg.iParam, ", uParam=", msg.uParam, ", lParam=", msg.lParam);
-    auto func = handlerMap[msg.event];
+    handlerFunc func = nullptr;
+    for (size_t i = 0; i < dim(handlerMap); i++)
+    {
+        if (handlerMap[i].event == msg.event)
+        {
+            func = handlerMap[i].func;
+            break;
+        }
+    }
+
     if (func)
     {
         (this->*func)(msg);
@@ -124,16 +215,23 @@ void ThreadApp::start(void *ctx)
     configASSERT(ctx);
     _context = ctx;
 
+    // PlaySound commands are time-critical, hand them straight to the audio thread
+    i2cA2dp.setQueue(static_cast<ThreadAudio *>(static_cast<AppContext *>(ctx)->threadAudio)->commandQueue());
+    // MP3 cues are decoded at low priority, ahead of being played
+    Mp3Cache::begin(this, EventCueDecode);
+
+    const ThreadConfig &config = static_cast<AppContext *>(ctx)->threadAppConfig;
     _taskHandle = xTaskCreateStaticPinnedToCore(
         [](void *instance)
         { static_cast<ThreadBase *>(instance)->run(); },
         TASK_NAME,
         TASK_STACK_SIZE, // This stack size can be checked & adjusted by reading the Stack Highwater
         this,
-        TASK_PRIORITY, // Priority, with 3 (configMAX_PRIORITIES - 1) being the highest, and 0 being the lowest.
+        config.priority,
         xStack,
         &xTaskBuffer,
-        RUNNING_CORE);
+        config.core);
+    TaskProfiler::add(_taskHandle, TASK_STACK_SIZE);
 }
 
 void ThreadApp::setup(void)
@@ -141,22 +239,35 @@ void ThreadApp::setup(void)
     // LOG_TRACE("on core ", xPortGetCoreID(), ", xPortGetFreeHeapSize()=", xPortGetFreeHeapSize());
     configASSERT(_instance && _instance->context());
 
-    xTaskCreatePinnedToCore(
+    bool result = startTimer(EventProfile, PROFILE_INTERVAL_MS, true);
+    configASSERT(result);
+    result = startTimer(EventTraceDrain, TRACE_DRAIN_INTERVAL_MS, true);
+    configASSERT(result);
+    result = startTimer(EventStatus, STATUS_INTERVAL_MS, true);
+    configASSERT(result);
+
+    taskInitHandle = xTaskCreateStaticPinnedToCore(
         [](void *_instance)
         {
             configASSERT(_instance);
             LOG_TRACE("taskDelayInit() on core ", xPortGetCoreID(), ", xPortGetFreeHeapSize()=", xPortGetFreeHeapSize());
             ThreadApp *instance = static_cast<ThreadApp *>(_instance);
+            TaskProfiler::add(xTaskGetCurrentTaskHandle(), TASK_INIT_STACK_SIZE);
             instance->delayInit();
             // vTaskDelay(pdMS_TO_TICKS(100));        // delay 100ms
-            vTaskDelete(instance->taskInitHandle); // init completed => delete itself
+            TaskProfiler::remove(xTaskGetCurrentTaskHandle());
+#ifdef HEAP_MONITOR
+            HeapMonitor::markInitDone();
+#endif
+            vTaskDelete(NULL); // init completed => delete itself
         },
         TASK_INIT_NAME,
         TASK_INIT_STACK_SIZE, // This stack size can be checked & adjusted by reading the Stack Highwater
         this,
         TASK_INIT_PRIORITY, // Priority, with 3 (configMAX_PRIORITIES - 1) being the highest, and 0 being the lowest.
-        &taskInitHandle,
-        ARDUINO_RUNNING_CORE);
+        xInitStack,
+        &xInitTaskBuffer,
+        static_cast<AppContext *>(context())->threadAppConfig.core);
 }
 
 void ThreadApp::run(void)
@@ -170,8 +281,9 @@ void ThreadApp::delayInit(void)
 {
     LOG_TRACE("on core ", xPortGetCoreID(), ", xPortGetFreeHeapSize()=", xPortGetFreeHeapSize());
 
-    bool initSoundBuffer = soundBuffer.init();
-    configASSERT(initSoundBuffer);
+    ThreadAudio *threadAudio = ThreadAudio::instance();
+    configASSERT(threadAudio);
+    threadAudio->setA2dpSource(&a2dpSource);
 
     a2dpSource.set_auto_reconnect(true);
     a2dpSource.set_local_name(LOCAL_DEVICE_NAME);
@@ -190,57 +302,31 @@ void ThreadApp::delayInit(void)
     // a2dpSource.set_pin_code();
     a2dpSource.set_volume(80);
 
-    a2dpSource.write_data(&soundBuffer);
+#ifdef RENDER_CHECK
+    // before the A2DP stack pulls data and before any I2C command
+    RenderCheck::run(Serial);
+#endif
+    a2dpSource.write_data(threadAudio->soundBuffer());
 
+    a2dpSource.set_event_stack_size(BT_APP_TASK_STACK_SIZE);
     a2dpSource.start(TARGET_DEVICE_NAME);
+    TaskProfiler::add(a2dpSource.get_app_task_handle(), BT_APP_TASK_STACK_SIZE);
 
-    bool rst = i2cA2dp.begin(I2C_DEV_ADDR);
-    LOG_TRACE("i2cA2dp.begin(0x", DebugLogBase::HEX, I2C_DEV_ADDR, ") returns ", rst);
+    if (!i2cA2dp.begin(I2C_DEV_ADDR))
+    {
+        LOG_TRACE("i2cA2dp.begin(0x", DebugLogBase::HEX, I2C_DEV_ADDR, ") failed");
+    }
 
     // vTaskDelay(pdMS_TO_TICKS(100));
 }
 
+// called on the Bluetooth task: defer bookkeeping and logging to this thread
 void ThreadApp::onAudioStateChanged(esp_a2d_audio_state_t state, void *obj)
 {
-    switch (state)
-    {
-    case ESP_A2D_AUDIO_STATE_REMOTE_SUSPEND: // audio stream datapath suspended by remote device
-        LOG_TRACE("ESP_A2D_AUDIO_STATE_REMOTE_SUSPEND");
-        break;
-    case ESP_A2D_AUDIO_STATE_STOPPED: // audio stream datapath stopped
-        LOG_TRACE("ESP_A2D_AUDIO_STATE_STOPPED");
-        break;
-    case ESP_A2D_AUDIO_STATE_STARTED: // audio stream datapath started
-        LOG_TRACE("ESP_A2D_AUDIO_STATE_STARTED");
-        break;
-    default:
-        LOG_TRACE("unknown state=", state);
-        break;
-    }
+    postEvent(EventA2dpAudioState, state);
 }
 
 void ThreadApp::onConnectionStateChanged(esp_a2d_connection_state_t state, void *obj)
 {
-    switch (state)
-    {
-    case ESP_A2D_CONNECTION_STATE_DISCONNECTED: // connection released
-        LOG_TRACE("ESP_A2D_CONNECTION_STATE_DISCONNECTED");
-        isA2dpConnected = false;
-        i2cA2dp.setA2dpConnectionStatus(false);
-        break;
-    case ESP_A2D_CONNECTION_STATE_CONNECTING: // connecting remote device
-        LOG_TRACE("ESP_A2D_CONNECTION_STATE_CONNECTING");
-        break;
-    case ESP_A2D_CONNECTION_STATE_CONNECTED: // connection established
-        LOG_TRACE("ESP_A2D_CONNECTION_STATE_CONNECTED");
-        isA2dpConnected = true;
-        i2cA2dp.setA2dpConnectionStatus(true);
-        break;
-    case ESP_A2D_CONNECTION_STATE_DISCONNECTING: //!< disconnecting remote device
-        LOG_TRACE("ESP_A2D_CONNECTION_STATE_DISCONNECTING");
-        break;
-    default:
-        LOG_TRACE("unknown state=", state);
-        break;
-    }
+    postEvent(EventA2dpConnectionState, state);
 }
@@ -18,13 +18,11 @@
  * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #pragma once
-#include <map>
 #include <Wire.h>
 #include "../lib/ESP32-A2DP/src/BluetoothA2DPSource.h"
 
 #include "../ArduProf.h"
 #include "../peripheral/i2c/I2cA2dp.h"
-#include "../data/SoundBuffer.h"
 #include "../../AppEvent.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -41,7 +39,12 @@ public:
 
 protected:
     typedef void (ThreadApp::*handlerFunc)(const Message &);
-    std::map<int16_t, handlerFunc> handlerMap;
+    typedef struct _HandlerMap
+    {
+        int16_t event;
+        handlerFunc func;
+    } HandlerMap;
+    static const HandlerMap handlerMap[]; // static table: lookup never allocates
 
     virtual void onMessage(const Message &msg);
     virtual void run(void);
@@ -51,11 +54,8 @@ private:
     static ThreadApp *_instance;
     TaskHandle_t taskInitHandle;
 
-    bool isA2dpConnected;
     BluetoothA2DPSource a2dpSource;
 
-    SoundBuffer soundBuffer;
-
     I2cA2dp i2cA2dp;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -68,6 +68,11 @@ private:
     ///////////////////////////////////////////////////////////////////////////
     // event handler
     ///////////////////////////////////////////////////////////////////////////
-    __EVENT_FUNC_DECLARATION(EventI2c)
+    __EVENT_FUNC_DECLARATION(EventA2dpConnectionState)
+    __EVENT_FUNC_DECLARATION(EventA2dpAudioState)
+    __EVENT_FUNC_DECLARATION(EventProfile)
+    __EVENT_FUNC_DECLARATION(EventTraceDrain)
+    __EVENT_FUNC_DECLARATION(EventStatus)
+    __EVENT_FUNC_DECLARATION(EventCueDecode)
     __EVENT_FUNC_DECLARATION(EventNull) // void handlerEventNull(const Message &msg);
 };
\ No newline at end of file
@@ -0,0 +1,261 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "../peripheral/i2c/I2cA2dp.h"
+#include "../peripheral/i2c/I2cCommand.h"
+#include "../peripheral/i2c/I2cStatus.h"
+#include "../debug/TaskProfiler.h"
+#include "../debug/CommandRecorder.h"
+#include "../../AppContext.h"
+#include "../../AppEvent.h"
+#include "ThreadAudio.h"
+
+ThreadAudio *ThreadAudio::_instance = nullptr;
+
+////////////////////////////////////////////////////////////////////////////////////////////
+// Thread
+////////////////////////////////////////////////////////////////////////////////////////////
+#define TASK_NAME "ThreadAudio"
+#define TASK_STACK_SIZE 4096
+#define TASK_QUEUE_SIZE 8     // message queue size for audio task: A2DP connection changes
+#define COMMAND_QUEUE_SIZE 32 // I2C commands from I2cA2dp
+
+static uint8_t ucQueueStorageArea[TASK_QUEUE_SIZE * sizeof(Message)];
+static StaticQueue_t xStaticQueue;
+
+static uint8_t ucCommandStorageArea[COMMAND_QUEUE_SIZE * sizeof(I2cA2dp::CommandMessage)];
+static StaticQueue_t xCommandQueue;
+
+static StackType_t xStack[TASK_STACK_SIZE];
+static StaticTask_t xTaskBuffer;
+
+////////////////////////////////////////////////////////////////////////////////////////////
+const ThreadAudio::HandlerMap ThreadAudio::handlerMap[] = {
+    __EVENT_MAP(ThreadAudio, EventA2dpConnectionState),
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////
+ThreadAudio::ThreadAudio() : ThreadBase(TASK_QUEUE_SIZE, ucQueueStorageArea, &xStaticQueue),
+                             isA2dpConnected(false),
+                             _a2dpSource(nullptr),
+                             _commandQueue(COMMAND_QUEUE_SIZE, ucCommandStorageArea, &xCommandQueue),
+                             _queueSet(xQueueCreateSet(TASK_QUEUE_SIZE + COMMAND_QUEUE_SIZE)),
+                             _soundBuffer()
+{
+    _instance = this;
+
+    configASSERT(_queueSet != NULL);
+    BaseType_t result = xQueueAddToSet(_queue, _queueSet);
+    configASSERT(result == pdPASS);
+    result = xQueueAddToSet(_commandQueue.queue(), _queueSet);
+    configASSERT(result == pdPASS);
+}
+
+///////////////////////////////////////////////////////////////////////
+// msg.event is the I2cCommand, the parameters were validated by I2cA2dp
+void ThreadAudio::onCommand(const I2cA2dp::CommandMessage &msg)
+{
+    int16_t command = msg.event;
+    const I2cA2dp::Frame *frame = msg.get<I2cA2dp::Frame>();
+    const PoolBlock *block = msg.get<PoolBlock>(); // owned by this thread, released below
+    I2cA2dp::ParamPool &pool = I2cA2dp::paramPool();
+    const uint8_t *param = frame ? frame->param : (block ? pool.data(block->handle) : nullptr);
+    uint16_t length = frame ? frame->length : (block ? block->length : 0);
+    if (param == nullptr)
+    {
+        LOG_TRACE("i2c command without parameters, command=", command);
+        return;
+    }
+
+    switch (command)
+    {
+    case I2cCommand::PlaySound:
+    {
+        // param = {volume, sound, CueLatency sequence}
+        if (isA2dpConnected && length == 3)
+        {
+            if (_a2dpSource)
+            {
+                _a2dpSource->set_volume(param[0]);
+            }
+            _soundBuffer.updateSoundSignal(param[1], param[2]);
+            I2cStatus::markApplied();
+            I2cStatus::setPattern(param[1]);
+            CommandRecorder::record(EventI2c, command, _soundBuffer.streamFrame(), param, length);
+        }
+        break;
+    }
+
+    case I2cCommand::PlayTimeline:
+    {
+        const I2cParam::Timeline *timeline = reinterpret_cast<const I2cParam::Timeline *>(param);
+        if (isA2dpConnected && block && _soundBuffer.setTimeline(*timeline))
+        {
+            I2cStatus::markApplied();
+            I2cStatus::setTimelineSequence(timeline->sequence);
+            CommandRecorder::record(EventI2c, command, _soundBuffer.streamFrame(), param, length);
+        }
+        break;
+    }
+
+    case I2cCommand::PlayAt:
+    {
+        // param = stream frame (4 bytes), cue, gain
+        uint32_t streamFrame;
+        memcpy(&streamFrame, param, sizeof(streamFrame));
+        if (isA2dpConnected && length == 6 && _soundBuffer.scheduleCue(streamFrame, param[4], param[5]))
+        {
+            I2cStatus::markApplied();
+            CommandRecorder::record(EventI2c, command, _soundBuffer.streamFrame(), param, length);
+        }
+        break;
+    }
+
+    case I2cCommand::DefinePattern:
+    {
+        const I2cParam::Pattern *pattern = reinterpret_cast<const I2cParam::Pattern *>(param);
+        if (block && _soundBuffer.definePattern(*pattern))
+        {
+            CommandRecorder::record(EventI2c, command, _soundBuffer.streamFrame(), param, length);
+        }
+        break;
+    }
+
+    case I2cCommand::PlayPattern:
+    {
+        // param = id, repeat; an id which has not been defined is ignored
+        if (isA2dpConnected && length == 2 && _soundBuffer.playPattern(param[0], param[1]))
+        {
+            I2cStatus::markApplied();
+            CommandRecorder::record(EventI2c, command, _soundBuffer.streamFrame(), param, length);
+        }
+        break;
+    }
+
+    default:
+        LOG_TRACE("unsupported i2c command=", command);
+        break;
+    }
+
+    if (block)
+    {
+        pool.release(block->handle);
+    }
+}
+
+__EVENT_FUNC_DEFINITION(ThreadAudio, EventA2dpConnectionState, msg) // void ThreadAudio::handlerEventA2dpConnectionState(const Message &msg)
+{
+    esp_a2d_connection_state_t state = (esp_a2d_connection_state_t)msg.iParam;
+    if (state == ESP_A2D_CONNECTION_STATE_CONNECTED)
+    {
+        isA2dpConnected = true;
+    }
+    else if (state == ESP_A2D_CONNECTION_STATE_DISCONNECTED)
+    {
+        isA2dpConnected = false;
+    }
+    CommandRecorder::record(msg.event, state, _soundBuffer.streamFrame());
+}
+
+///////////////////////////////////////////////////////////////////////
+void ThreadAudio::onMessage(const Message &msg)
+{
+    handlerFunc func = nullptr;
+    for (size_t i = 0; i < dim(handlerMap); i++)
+    {
+        if (handlerMap[i].event == msg.event)
+        {
+            func = handlerMap[i].func;
+            break;
+        }
+    }
+
+    if (func)
+    {
+        (this->*func)(msg);
+    }
+    else
+    {
+        LOG_TRACE("Unsupported event = ", msg.event, ", iParam = ", msg.iParam, ", uParam = ", msg.uParam, ", lParam = ", msg.lParam);
+    }
+}
+
+// as ThreadBase::messageLoop(), waiting on the queue set: a message of either
+// queue is received from the queue the set returns, in the order they were posted
+void ThreadAudio::messageLoop(TickType_t xTicksToWait)
+{
+    xTicksToWait = std::min(xTicksToWait, _timer.ticksToWait(xTaskGetTickCount()));
+    QueueSetMemberHandle_t member = xQueueSelectFromSet(_queueSet, xTicksToWait);
+    if (member == _commandQueue.queue())
+    {
+        I2cA2dp::CommandMessage command;
+        if (_commandQueue.receive(command, 0))
+        {
+            onCommand(command);
+        }
+    }
+    else if (member == _queue)
+    {
+        Message msg;
+        if (xQueueReceive(_queue, (void *)&msg, 0) == pdTRUE)
+        {
+            dispatchMessage(msg);
+        }
+    }
+
+    Message msg;
+    while (_timer.poll(xTaskGetTickCount(), msg))
+    {
+        dispatchMessage(msg);
+    }
+}
+
+void ThreadAudio::start(void *ctx)
+{
+    configASSERT(ctx);
+    _context = ctx;
+
+    // the sound buffer must be ready before ThreadApp hands it to the A2DP source
+    bool initSoundBuffer = _soundBuffer.init();
+    configASSERT(initSoundBuffer);
+
+    const ThreadConfig &config = static_cast<AppContext *>(ctx)->threadAudioConfig;
+    _taskHandle = xTaskCreateStaticPinnedToCore(
+        [](void *instance)
+        { static_cast<ThreadBase *>(instance)->run(); },
+        TASK_NAME,
+        TASK_STACK_SIZE, // This stack size can be checked & adjusted by reading the Stack Highwater
+        this,
+        config.priority,
+        xStack,
+        &xTaskBuffer,
+        config.core);
+    TaskProfiler::add(_taskHandle, TASK_STACK_SIZE);
+}
+
+void ThreadAudio::setup(void)
+{
+    // nothing to delay: ThreadApp owns the slow Bluetooth/I2C initialisation
+}
+
+void ThreadAudio::run(void)
+{
+    LOG_TRACE("on core ", xPortGetCoreID(), ", xPortGetFreeHeapSize()=", xPortGetFreeHeapSize());
+    ThreadBase::run();
+}
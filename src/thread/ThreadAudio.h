@@ -0,0 +1,100 @@
+/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+#include "../lib/ESP32-A2DP/src/BluetoothA2DPSource.h"
+
+#include "../ArduProf.h"
+#include "../data/SoundBuffer.h"
+#include "../peripheral/i2c/I2cA2dp.h"
+#include "../../AppEvent.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// ThreadAudio runs at high priority and handles the time-critical audio path
+// only: sound updates and volume changes requested by the I2C master. The
+// commands of I2cA2dp come through their own typed queue, waited on together
+// with the message queue of the thread through a queue set.
+///////////////////////////////////////////////////////////////////////////////
+class ThreadAudio : public ThreadBase
+{
+public:
+    ThreadAudio();
+    virtual void start(void *);
+
+    static ThreadAudio *instance(void)
+    {
+        return _instance;
+    }
+
+    SoundBuffer *soundBuffer(void)
+    {
+        return &_soundBuffer;
+    }
+
+    void setA2dpSource(BluetoothA2DPSource *a2dpSource)
+    {
+        _a2dpSource = a2dpSource;
+    }
+
+    I2cA2dp::CommandQueue *commandQueue(void)
+    {
+        return &_commandQueue;
+    }
+
+    // messages and commands waiting for messageLoop()
+    UBaseType_t messagesWaiting(void)
+    {
+        return uxQueueMessagesWaiting(_queueSet);
+    }
+
+    virtual void messageLoop(TickType_t xTicksToWait = portMAX_DELAY);
+
+protected:
+    typedef void (ThreadAudio::*handlerFunc)(const Message &);
+    typedef struct _HandlerMap
+    {
+        int16_t event;
+        handlerFunc func;
+    } HandlerMap;
+    static const HandlerMap handlerMap[]; // static table: lookup never allocates
+
+    virtual void onMessage(const Message &msg);
+    virtual void onCommand(const I2cA2dp::CommandMessage &msg);
+    virtual void run(void);
+
+private:
+    ///////////////////////////////////////////////////////////////////////////
+    static ThreadAudio *_instance;
+
+    bool isA2dpConnected;
+    BluetoothA2DPSource *_a2dpSource;
+
+    I2cA2dp::CommandQueue _commandQueue;
+    QueueSetHandle_t _queueSet;
+
+    SoundBuffer _soundBuffer;
+
+    ///////////////////////////////////////////////////////////////////////////
+    virtual void setup(void);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // event handler
+    ///////////////////////////////////////////////////////////////////////////
+    __EVENT_FUNC_DECLARATION(EventA2dpConnectionState)
+};
@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+# Copyright 2023 teamprof.net@gmail.com
+# SPDX-License-Identifier: MIT
+"""Compile cue sounds into a packed, indexed cue bundle (src/data/CueBundleDef.h).
+
+Each cue is given as ID=PATH, ID being an I2cParam::Cue value. PATH may be
+  - an audio file (.mp3, .wav, ...), decoded by ffmpeg to signed 8-bit mono;
+    leading silence is trimmed and the peak is normalised
+  - a .raw file of signed 8-bit mono samples, taken as is
+  - a .h/.c file with a C array of signed 8-bit samples (as made by xxd -i), taken as is
+Every cue is then cut (with a short fade out) or padded with silence to the
+slot length, and stored as 8-bit PCM or, with --format adpcm, as 4-bit
+IMA-ADPCM (AdpcmSoundData, about half the size). With --format mp3, PATH must
+be a 44.1 kHz .mp3 file, stored as is and decoded on the device by Mp3Cache
+(which trims, normalises and cuts it the same way). With --rate below 44100, the
+8-bit cues are low-pass filtered and stored at that rate, to be upsampled by
+ResampledSoundData. For both, the SNR of the played output against the 8-bit
+44.1 kHz cue is printed. The bundle is written as a C++ header with a
+constexpr index (--header) and/or as a binary image (--bin).
+
+example, with the clips of data/:
+  python3 tools/asset_compiler.py --header src/data/CueBundle.h \\
+      1=data/soundEdgePool.mp3 2=data/soundLeftLane.mp3 3=data/soundMiddleLane.mp3 \\
+      4=data/soundRightLane.mp3 5=data/error.mp3
+"""
+import argparse
+import math
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+
+import resampler_table
+
+VERSION = 1
+ALIGN = 4
+MAGIC = b"CUEB"
+HEADER = struct.Struct("<4sHH")     # CueBundleHeader
+ENTRY = struct.Struct("<BBHIII")    # CueBundleEntry
+FORMAT_S8 = 0
+FORMAT_IMA_ADPCM = 1
+FORMAT_MP3 = 2
+FORMATS = {"s8": FORMAT_S8, "adpcm": FORMAT_IMA_ADPCM, "mp3": FORMAT_MP3}
+FORMAT_NAMES = {FORMAT_S8: "CueFormatS8", FORMAT_IMA_ADPCM: "CueFormatImaAdpcm", FORMAT_MP3: "CueFormatMp3"}
+
+MP3_RATES = {3: (44100, 48000, 32000), 2: (22050, 24000, 16000), 0: (11025, 12000, 8000)}  # by MPEG version
+MP3_BITRATES = {3: (0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320),
+                2: (0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160)}
+
+ADPCM_BLOCK_SAMPLES = 256                   # AdpcmSoundData::BLOCK_SAMPLES
+ADPCM_BLOCK_SIZE = 4 + ADPCM_BLOCK_SAMPLES // 2
+ADPCM_STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+ADPCM_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+SAMPLE_RATE = 44100
+SLOT_LENGTH = 4410  # SoundBuffer::SAMPLING_PER_SLOT
+FADE_LENGTH = 88    # 2ms
+TRIM_THRESHOLD = 2
+
+LICENSE = """/* Copyright 2023 teamprof.net@gmail.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ * software and associated documentation files (the "Software"), to deal in the Software
+ * without restriction, including without limitation the rights to use, copy, modify,
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+"""
+
+
+def to_signed(values):
+    return [v - 256 if v > 127 else v for v in values]
+
+
+def decode_audio(path, rate):
+    cmd = ["ffmpeg", "-v", "error", "-i", path, "-f", "s8", "-ac", "1", "-ar", str(rate), "-"]
+    try:
+        pcm = subprocess.run(cmd, check=True, stdout=subprocess.PIPE).stdout
+    except FileNotFoundError:
+        raise SystemExit("ffmpeg is required to decode %s" % path)
+    return to_signed(pcm)
+
+
+def read_c_array(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("{", text.index("[]")) + 1:text.index("}", text.index("[]"))]
+    body = re.sub(r"/\*.*?\*/|//[^\n]*", "", body, flags=re.S)
+    return to_signed([int(v, 0) & 0xff for v in body.replace(",", " ").split()])
+
+
+def trim(samples, threshold):
+    start = 0
+    while start < len(samples) and abs(samples[start]) < threshold:
+        start += 1
+    return samples[start:]
+
+
+def normalise(samples):
+    peak = max([abs(v) for v in samples] + [1])
+    return [max(-128, min(127, round(v * 127 / peak))) for v in samples]
+
+
+def fit(samples, length):
+    if len(samples) > length:
+        samples = samples[:length]
+        for i in range(FADE_LENGTH):
+            samples[length - 1 - i] = int(samples[length - 1 - i] * i / FADE_LENGTH)
+    return samples + [0] * (length - len(samples))
+
+
+def load(path):
+    """Returns the cue at SAMPLE_RATE, fitted to one slot."""
+    ext = os.path.splitext(path)[1].lower()
+    if ext in (".h", ".c"):
+        samples = read_c_array(path)
+    elif ext == ".raw":
+        with open(path, "rb") as f:
+            samples = to_signed(f.read())
+    else:
+        samples = normalise(trim(decode_audio(path, SAMPLE_RATE), TRIM_THRESHOLD))
+    return fit(samples, SLOT_LENGTH)
+
+
+def stored_length(rate):
+    """Samples stored for one slot at rate, with the taps needed by the last frames."""
+    if rate == SAMPLE_RATE:
+        return SLOT_LENGTH
+    return -(-SLOT_LENGTH * rate // SAMPLE_RATE) + resampler_table.TAPS // 2
+
+
+def downsample(samples, rate, length, half_width=16):
+    """Low-pass filters and decimates SAMPLE_RATE samples to rate (windowed sinc)."""
+    ratio = SAMPLE_RATE / rate
+    cutoff = 0.45 / ratio  # in cycles per input sample
+    reach = int(half_width * ratio)
+    out = []
+    for j in range(length):
+        center = j * ratio
+        acc = 0.0
+        for n in range(max(0, int(center) - reach), min(len(samples), int(center) + reach + 1)):
+            t = n - center
+            x = 2 * cutoff * t
+            sinc = 2 * cutoff if x == 0 else math.sin(math.pi * x) / (math.pi * t)
+            window = 0.42 + 0.5 * math.cos(math.pi * t / (reach + 1)) + 0.08 * math.cos(2 * math.pi * t / (reach + 1))
+            acc += samples[n] * sinc * window
+        out.append(max(-128, min(127, int(round(acc)))))
+    return out
+
+
+def upsample(samples, rate, count):
+    """Output of ResampledSoundData::getData() for frames 0..count-1."""
+    phase_bits = resampler_table.PHASES.bit_length() - 1
+    taps = resampler_table.TAPS
+    coefs = resampler_table.table()
+    step = (rate << 32) // SAMPLE_RATE
+    out = []
+    for pos in range(count):
+        x = pos * step + (1 << (31 - phase_bits))
+        first = (x >> 32) - (taps // 2 - 1)
+        coef = coefs[(x & 0xffffffff) >> (32 - phase_bits)]
+        acc = sum(samples[n] * coef[k] for k, n in enumerate(range(first, first + taps)) if 0 <= n < len(samples))
+        out.append(max(-32768, min(32767, (acc * 127 + (1 << 14)) >> 15)))
+    return out
+
+
+def adpcm_step(predictor, index, nibble):
+    """One sample of the decoder, as AdpcmSoundData::decodeBlock(); returns (predictor, index)."""
+    step = ADPCM_STEPS[index]
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+    predictor = max(-32768, min(32767, predictor - diff if nibble & 8 else predictor + diff))
+    return predictor, max(0, min(88, index + ADPCM_INDEX[nibble & 7]))
+
+
+def adpcm_encode(samples):
+    """Encodes signed 8-bit samples into AdpcmSoundData blocks, returns (blocks, decoded output)."""
+    samples = samples + [0] * (-len(samples) % ADPCM_BLOCK_SAMPLES)
+    blocks = bytearray()
+    decoded = []
+    predictor, index = 0, 0
+    for start in range(0, len(samples), ADPCM_BLOCK_SAMPLES):
+        blocks += struct.pack("<hBB", predictor, index, 0)
+        nibbles = []
+        for v in samples[start:start + ADPCM_BLOCK_SAMPLES]:
+            # the nibble whose decoded value is the closest to the sample
+            target = v * 256
+            nibble = min(range(16), key=lambda n: abs(adpcm_step(predictor, index, n)[0] - target))
+            predictor, index = adpcm_step(predictor, index, nibble)
+            nibbles.append(nibble)
+            decoded.append((predictor * 127) >> 8)
+        blocks += bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+    return bytes(blocks), decoded
+
+
+def mp3_info(data):
+    """Returns (rate, channels, frames) of an MPEG layer III stream, raises ValueError if it is not one."""
+    pos = 0
+    if data[:3] == b"ID3":
+        pos = 10 + ((data[6] << 21) | (data[7] << 14) | (data[8] << 7) | data[9])
+    rate, channels, frames = 0, 0, 0
+    while pos + 4 <= len(data):
+        b1, b2, b3 = data[pos + 1], data[pos + 2], data[pos + 3]
+        version, layer, bitrate, rate_index = (b1 >> 3) & 3, (b1 >> 1) & 3, b2 >> 4, (b2 >> 2) & 3
+        if data[pos] != 0xff or b1 & 0xe0 != 0xe0 or version == 1 or layer != 1 or bitrate in (0, 15) or rate_index == 3:
+            if frames:
+                break  # trailing tag
+            raise ValueError("no MPEG layer III frame at byte %u" % pos)
+        frame_rate = MP3_RATES[version][rate_index]
+        if frames and frame_rate != rate:
+            raise ValueError("sampling rate changes at byte %u" % pos)
+        rate, channels = frame_rate, 1 if b3 >> 6 == 3 else 2
+        samples = 1152 if version == 3 else 576
+        pos += samples // 8 * MP3_BITRATES[3 if version == 3 else 2][bitrate] * 1000 // rate + ((b2 >> 1) & 1)
+        frames += 1
+    if frames == 0:
+        raise ValueError("empty MPEG stream")
+    return rate, channels, frames
+
+
+def snr(reference, decoded):
+    signal = sum(v * v for v in reference)
+    noise = sum((a - b) ** 2 for a, b in zip(reference, decoded))
+    return float("inf") if noise == 0 else 10 * math.log10(max(signal, 1) / noise)
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def build(cues, rate):
+    """Returns (bundle, index) for cues, a list of (id, format, data)."""
+    offset = align(HEADER.size + ENTRY.size * len(cues))
+    index = []
+    for cue_id, fmt, data in cues:
+        index.append((cue_id, fmt, rate, offset, len(data)))
+        offset = align(offset + len(data))
+
+    bundle = bytearray(offset)
+    HEADER.pack_into(bundle, 0, MAGIC, VERSION, len(cues))
+    for i, (entry, (_, _, data)) in enumerate(zip(index, cues)):
+        cue_id, fmt, entry_rate, entry_offset, entry_length = entry
+        ENTRY.pack_into(bundle, HEADER.size + i * ENTRY.size, cue_id, fmt, 0, entry_rate, entry_offset, entry_length)
+        bundle[entry_offset:entry_offset + entry_length] = data
+    return bytes(bundle), index
+
+
+def validate(bundle):
+    """Checks what SoundBuffer relies on, returns the index read back from the bundle."""
+    magic, version, count = HEADER.unpack_from(bundle, 0)
+    assert magic == MAGIC and version == VERSION, "bad header"
+    assert len(bundle) % ALIGN == 0, "bundle size not aligned"
+    index = [ENTRY.unpack_from(bundle, HEADER.size + i * ENTRY.size) for i in range(count)]
+    end = HEADER.size + ENTRY.size * count
+    ids = set()
+    for cue_id, fmt, _, rate, offset, entry_length in sorted(index, key=lambda e: e[4]):
+        assert cue_id not in ids, "cue %u twice" % cue_id
+        ids.add(cue_id)
+        assert offset % ALIGN == 0, "cue %u: offset not aligned" % cue_id
+        assert offset >= end and offset + entry_length <= len(bundle), "cue %u: out of bounds" % cue_id
+        length = stored_length(rate)
+        if fmt == FORMAT_S8:
+            assert entry_length == length, "cue %u: %u samples instead of %u" % (cue_id, entry_length, length)
+        elif fmt == FORMAT_IMA_ADPCM:
+            assert entry_length % ADPCM_BLOCK_SIZE == 0, "cue %u: partial ADPCM block" % cue_id
+            blocks = entry_length // ADPCM_BLOCK_SIZE
+            assert blocks == -(-length // ADPCM_BLOCK_SAMPLES), "cue %u: %u ADPCM blocks for %u samples" % (cue_id, blocks, length)
+        elif fmt == FORMAT_MP3:
+            mp3_rate = mp3_info(bundle[offset:offset + entry_length])[0]
+            assert mp3_rate == rate == SAMPLE_RATE, "cue %u: MP3 at %u Hz" % (cue_id, mp3_rate)
+        else:
+            assert False, "cue %u: unknown format" % cue_id
+        end = offset + entry_length
+    return index
+
+
+def c_bytes(data, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def write_header(path, bundle, index, command):
+    entries = ",\n".join("    {%u, %s, 0, %u, %u, %u}" % (cue_id, FORMAT_NAMES[fmt], rate, offset, length)
+                         for cue_id, fmt, rate, offset, length in index)
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(LICENSE)
+        f.write("#pragma once\n")
+        f.write('#include "./CueBundleDef.h"\n\n')
+        f.write("// generated by tools/asset_compiler.py, do not edit:\n// %s\n\n" % command)
+        f.write("static constexpr CueBundleEntry cueBundleIndex[] = {\n%s};\n\n" % entries)
+        for i, (cue_id, _, _, _, _) in enumerate(index):
+            f.write('static_assert(cueFitsSlot(cueBundleIndex[%u]), "cue %u does not fill one slot");\n' % (i, cue_id))
+        f.write("\n")
+        f.write("alignas(CUE_BUNDLE_ALIGN) static const uint8_t cueBundleData[] = {\n%s};\n" % c_bytes(bundle))
+        f.write("static const uint32_t cueBundleSize = %u;\n" % len(bundle))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("cues", nargs="+", metavar="ID=PATH", help="cue id (I2cParam::Cue) and its source")
+    parser.add_argument("--header", help="C++ header to write, e.g. src/data/CueBundle.h")
+    parser.add_argument("--bin", help="binary bundle to write")
+    parser.add_argument("--format", choices=sorted(FORMATS), default="s8", help="storage of the cues (default %(default)s)")
+    parser.add_argument("--rate", type=int, default=SAMPLE_RATE,
+                        help="stored sampling rate, 8000..%(default)s, 8-bit only (default %(default)s)")
+    args = parser.parse_args()
+    if not args.header and not args.bin:
+        parser.error("nothing to write, give --header and/or --bin")
+    if not 8000 <= args.rate <= SAMPLE_RATE or (args.rate != SAMPLE_RATE and args.format != "s8"):
+        parser.error("unsupported rate %u for format %s" % (args.rate, args.format))
+    length = stored_length(args.rate)
+
+    cues = []
+    for arg in args.cues:
+        cue_id, _, path = arg.partition("=")
+        if FORMATS[args.format] == FORMAT_MP3:
+            if os.path.splitext(path)[1].lower() != ".mp3":
+                parser.error("%s: --format mp3 takes .mp3 files" % path)
+            with open(path, "rb") as f:
+                data = f.read()
+            try:
+                mp3_rate, channels, frames = mp3_info(data)
+            except ValueError as e:
+                parser.error("%s: %s" % (path, e))
+            if mp3_rate != SAMPLE_RATE:
+                parser.error("%s: %u Hz, the device decodes %u Hz only" % (path, mp3_rate, SAMPLE_RATE))
+            print("cue %s: %u bytes, %u MP3 frames, %u channel(s)" % (cue_id, len(data), frames, channels))
+            cues.append((int(cue_id, 0), FORMAT_MP3, data))
+            continue
+        samples = load(path)
+        reference = [v * 127 for v in samples]
+        if FORMATS[args.format] == FORMAT_IMA_ADPCM:
+            data, decoded = adpcm_encode(samples)
+            print("cue %s: %u bytes, SNR %.1f dB against 8-bit PCM" % (cue_id, len(data), snr(reference, decoded)))
+        elif args.rate != SAMPLE_RATE:
+            stored = downsample(samples, args.rate, length)
+            data = bytes(v & 0xff for v in stored)
+            decoded = upsample(stored, args.rate, SLOT_LENGTH)
+            print("cue %s: %u bytes at %u Hz, SNR %.1f dB against 8-bit PCM at %u Hz" % (
+                cue_id, len(data), args.rate, snr(reference, decoded), SAMPLE_RATE))
+        else:
+            data = bytes(v & 0xff for v in samples)
+        cues.append((int(cue_id, 0), FORMATS[args.format], data))
+    bundle, index = build(cues, args.rate)
+    assert [tuple(e[:2]) + tuple(e[3:]) for e in validate(bundle)] == index
+
+    if args.header:
+        command = " ".join(["python3", "tools/asset_compiler.py"] + [shlex.quote(a) for a in sys.argv[1:]])
+        write_header(args.header, bundle, index, command)
+    if args.bin:
+        with open(args.bin, "wb") as f:
+            f.write(bundle)
+    print("%u cues, %u bytes" % (len(index), len(bundle)))
+
+
+if __name__ == "__main__":
+    main()
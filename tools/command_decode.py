@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+# Copyright 2023 teamprof.net@gmail.com
+# SPDX-License-Identifier: MIT
+"""Decode a binary CommandRecorder dump (src/debug/CommandRecorder.h).
+
+Send 'r' on the serial port of the ESP32 and capture the output to a file.
+Each line gives the stream frame at which the command reached the sound
+buffer, which is enough to re-issue the same sequence (e.g. with PlayAt) on
+a bench board and compare the audio. The host build replays a dump on the
+PC (host/tools/command_replay.cpp).
+
+usage: command_decode.py capture.bin
+"""
+import argparse
+import struct
+import sys
+
+HEADER = struct.Struct("<2sBBHHI")                  # CommandDumpHeader
+# CommandRecord per dump version: MAX_PARAM was 26 bytes in version 1, which
+# cut DefinePattern; version 2 keeps every command whole
+RECORDS = {
+    1: struct.Struct("<IIBBBB26s"),
+    2: struct.Struct("<IIBBBB66s"),
+}
+
+EVENT_I2C = 100
+EVENT_A2DP_CONNECTION_STATE = 200
+
+COMMANDS = {
+    3: "PlaySound",
+    5: "PlayTimeline",
+    11: "PlayAt",
+    12: "PlayUrgent",
+    14: "SetTone",
+    15: "DefinePattern",
+    16: "PlayPattern",
+}
+CONNECTION_STATES = ["disconnected", "connecting", "connected", "disconnecting"]
+
+
+def find_dump(data):
+    offset = data.find(b"CR")
+    while offset >= 0:
+        if offset + HEADER.size <= len(data):
+            _, version, record_size, count, _, _ = HEADER.unpack_from(data, offset)
+            record = RECORDS.get(version)
+            if record and record_size == record.size and offset + HEADER.size + count * record.size <= len(data):
+                return offset
+        offset = data.find(b"CR", offset + 1)
+    return -1
+
+
+def describe(event, command, param):
+    if event == EVENT_A2DP_CONNECTION_STATE:
+        state = CONNECTION_STATES[command] if command < len(CONNECTION_STATES) else str(command)
+        return "A2DP %s" % state
+    name = COMMANDS.get(command, "command %u" % command)
+    if command == 3:
+        return "%s volume=%u sound=%u sequence=%u" % (name, param[0], param[1], param[2])
+    if command == 5:
+        slots = " ".join("%u:%u" % (param[i], param[i + 1]) for i in range(3, len(param) - 1, 2))
+        return "%s sequence=%u repeat=%u slots=[%s]" % (name, param[0], param[1], slots)
+    if command == 11:
+        frame, cue, gain = struct.unpack_from("<IBB", param)
+        return "%s frame=%u cue=%u gain=%u" % (name, frame, cue, gain)
+    if command == 12:
+        return "%s cue=%u gain=%u priority=%u" % (name, param[0], param[1], param[2])
+    if command == 14:
+        tone, frequency, waveform, gain, attack, decay, sustain, release, fm_frequency, fm_index = struct.unpack_from("<BHBBBBBBHB", param)
+        return "%s id=%u frequency=%u waveform=%u gain=%u adsr=%u/%u/%u%%/%u fm=%u/%u" % (
+            name, tone, frequency, waveform, gain, attack, decay, sustain, release, fm_frequency, fm_index)
+    if command == 15:
+        # a version 1 record keeps the first 6 steps only
+        steps = " ".join("%u:%u:%u:%u" % tuple(param[i:i + 4]) for i in range(2, len(param) - 3, 4))
+        return "%s id=%u steps=%u [%s]" % (name, param[0], param[1], steps)
+    if command == 16:
+        return "%s id=%u repeat=%u" % (name, param[0], param[1])
+    return "%s param=%s" % (name, param.hex())
+
+
+def decode(data, out):
+    offset = find_dump(data)
+    if offset < 0:
+        raise ValueError("no CommandRecorder dump found")
+    _, version, _, count, _, total = HEADER.unpack_from(data, offset)
+    record = RECORDS[version]
+    offset += HEADER.size
+
+    for _ in range(count):
+        stream_frame, time_us, event, command, length, _, param = record.unpack_from(data, offset)
+        offset += record.size
+        out.write("%10u [T %u.%06u] %s\n" % (stream_frame, time_us // 1000000, time_us % 1000000,
+                                             describe(event, command, param[:length])))
+
+    out.write("# %u records, %u overwritten\n" % (count, total - count))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary capture containing a CommandRecorder dump")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+    decode(data, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# Copyright 2023 teamprof.net@gmail.com
+# SPDX-License-Identifier: MIT
+"""Generate the polyphase filter table of ResampledSoundData (src/data/ResamplerTable.h).
+
+The kernel is a Blackman windowed sinc in units of input samples, so one table
+serves every upsampling ratio. Each of the PHASES rows holds the TAPS Q15
+coefficients for an output frame falling at phase / PHASES between two input
+samples, normalised to a DC gain of exactly 1.
+
+usage: resampler_table.py [--header src/data/ResamplerTable.h]
+"""
+import argparse
+import math
+import os
+
+PHASES = 64
+TAPS = 8
+CUTOFF = 0.45  # in cycles per input sample, a bit below Nyquist for the transition band
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "data", "ResamplerTable.h")
+
+
+def kernel(t):
+    if abs(t) >= TAPS / 2:
+        return 0.0
+    x = 2 * CUTOFF * t
+    sinc = 1.0 if x == 0 else math.sin(math.pi * x) / (math.pi * x)
+    w = (t + TAPS / 2) / TAPS
+    window = 0.42 - 0.5 * math.cos(2 * math.pi * w) + 0.08 * math.cos(4 * math.pi * w)
+    return sinc * window
+
+
+def table():
+    """Rows of TAPS Q15 coefficients, tap k applies to input sample i - TAPS / 2 + 1 + k."""
+    rows = []
+    for phase in range(PHASES):
+        frac = phase / PHASES
+        h = [kernel(k - (TAPS // 2 - 1) - frac) for k in range(TAPS)]
+        total = sum(h)
+        row = [int(round(v / total * 32768)) for v in h]
+        row[TAPS // 2 - 1 + (1 if frac >= 0.5 else 0)] += 32768 - sum(row)  # exact DC gain
+        rows.append(row)
+    return rows
+
+
+def write_header(path):
+    from asset_compiler import LICENSE
+    rows = ",\n".join("    {%s}" % ", ".join("%d" % v for v in row) for row in table())
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(LICENSE)
+        f.write("#pragma once\n#include <stdint.h>\n\n")
+        f.write("// generated by tools/resampler_table.py, do not edit\n")
+        f.write("// Blackman windowed sinc, cutoff %.2f cycles per input sample, Q15\n\n" % CUTOFF)
+        f.write("static const int32_t RESAMPLER_PHASES = %u;\n" % PHASES)
+        f.write("static const int32_t RESAMPLER_TAPS = %u;\n\n" % TAPS)
+        f.write("static const int16_t resamplerTable[RESAMPLER_PHASES][RESAMPLER_TAPS] = {\n%s};\n" % rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="header to write")
+    args = parser.parse_args()
+    write_header(args.header)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# Copyright 2023 teamprof.net@gmail.com
+# SPDX-License-Identifier: MIT
+"""Decode a binary TraceLog dump (src/debug/TraceLog.h).
+
+Send 't' on the serial port of the ESP32 and capture the output to a file,
+e.g. "python3 -m serial.tools.miniterm ... > capture.bin". The capture may
+contain text logs around the dump, the decoder looks for the "TL" header.
+
+usage: trace_decode.py capture.bin [--header src/debug/TraceLog.h]
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+VERSION = 1
+HEADER = struct.Struct("<2sBBHHI")  # TraceDumpHeader
+RECORD = struct.Struct("<IIHH3I")   # TraceRecord
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "debug", "TraceLog.h")
+
+
+def load_formats(path):
+    """Returns the format strings of TRACE_FORMAT_LIST, indexed by TraceId."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    start = text.index("#define TRACE_FORMAT_LIST")
+    end = text.index("\n\n", start)
+    return [fmt for _, fmt in re.findall(r'X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)', text[start:end])]
+
+
+def find_dump(data):
+    offset = data.find(b"TL")
+    while offset >= 0:
+        if offset + HEADER.size <= len(data):
+            _, version, record_size, count, _, _ = HEADER.unpack_from(data, offset)
+            if version == VERSION and record_size == RECORD.size and offset + HEADER.size + count * RECORD.size <= len(data):
+                return offset
+        offset = data.find(b"TL", offset + 1)
+    return -1
+
+
+def decode(data, formats, out):
+    offset = find_dump(data)
+    if offset < 0:
+        raise ValueError("no TraceLog dump found")
+    _, _, _, count, _, dropped = HEADER.unpack_from(data, offset)
+    offset += HEADER.size
+
+    skipped = 0
+    for _ in range(count):
+        sequence, timestamp, trace_id, _, *args = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        if sequence == 0:
+            skipped += 1
+            continue
+        if trace_id < len(formats):
+            fmt = formats[trace_id]
+            text = fmt % tuple(args[: fmt.count("%") - 2 * fmt.count("%%")])
+        else:
+            text = "unknown id=%u args=%s" % (trace_id, args)
+        out.write("%8u [T %u.%06u] %s\n" % (sequence, timestamp // 1000000, timestamp % 1000000, text))
+
+    out.write("# %u records, %u incomplete, %u dropped\n" % (count, skipped, dropped))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="binary capture containing a TraceLog dump")
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="TraceLog.h providing TRACE_FORMAT_LIST")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+    decode(data, load_formats(args.header), sys.stdout)
+
+
+if __name__ == "__main__":
+    main()